@@ -0,0 +1,347 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+// Lists of the FHoudiniApi function pointers, used to generate wrappers around them
+// (see FHoudiniApiStats and FHoudiniApiRecorder).
+// Needs to be updated when HoudiniApi.h is regenerated.
+
+// Functions that communicate with the session
+#define HOUDINI_API_SESSION_FUNCTIONS(X) \
+	X(AddAttribute) \
+	X(AddGroup) \
+	X(BindCustomImplementation) \
+	X(CancelPDGCook) \
+	X(CheckForSpecificErrors) \
+	X(Cleanup) \
+	X(ClearConnectionError) \
+	X(CloseSession) \
+	X(CommitGeo) \
+	X(CommitWorkitems) \
+	X(ComposeChildNodeList) \
+	X(ComposeNodeCookResult) \
+	X(ComposeObjectList) \
+	X(ConnectNodeInput) \
+	X(ConvertMatrixToEuler) \
+	X(ConvertMatrixToQuat) \
+	X(ConvertTransform) \
+	X(ConvertTransformEulerToMatrix) \
+	X(ConvertTransformQuatToMatrix) \
+	X(CookNode) \
+	X(CookOptions_AreEqual) \
+	X(CookPDG) \
+	X(CreateCustomSession) \
+	X(CreateHeightFieldInput) \
+	X(CreateHeightfieldInputVolumeNode) \
+	X(CreateInProcessSession) \
+	X(CreateInputNode) \
+	X(CreateNode) \
+	X(CreateThriftNamedPipeSession) \
+	X(CreateThriftSocketSession) \
+	X(CreateWorkitem) \
+	X(DeleteAttribute) \
+	X(DeleteGroup) \
+	X(DeleteNode) \
+	X(DirtyPDGNode) \
+	X(DisconnectNodeInput) \
+	X(DisconnectNodeOutputsAt) \
+	X(ExtractImageToFile) \
+	X(ExtractImageToMemory) \
+	X(GeoInfo_GetGroupCountByType) \
+	X(GetActiveCacheCount) \
+	X(GetActiveCacheNames) \
+	X(GetAssetDefinitionParmCounts) \
+	X(GetAssetDefinitionParmInfos) \
+	X(GetAssetDefinitionParmValues) \
+	X(GetAssetInfo) \
+	X(GetAttributeFloat64ArrayData) \
+	X(GetAttributeFloat64Data) \
+	X(GetAttributeFloatArrayData) \
+	X(GetAttributeFloatData) \
+	X(GetAttributeInfo) \
+	X(GetAttributeInt64ArrayData) \
+	X(GetAttributeInt64Data) \
+	X(GetAttributeIntArrayData) \
+	X(GetAttributeIntData) \
+	X(GetAttributeNames) \
+	X(GetAttributeStringArrayData) \
+	X(GetAttributeStringData) \
+	X(GetAvailableAssetCount) \
+	X(GetAvailableAssets) \
+	X(GetBoxInfo) \
+	X(GetCacheProperty) \
+	X(GetComposedChildNodeList) \
+	X(GetComposedNodeCookResult) \
+	X(GetComposedObjectList) \
+	X(GetComposedObjectTransforms) \
+	X(GetConnectionError) \
+	X(GetConnectionErrorLength) \
+	X(GetCookingCurrentCount) \
+	X(GetCookingTotalCount) \
+	X(GetCurveCounts) \
+	X(GetCurveInfo) \
+	X(GetCurveKnots) \
+	X(GetCurveOrders) \
+	X(GetDisplayGeoInfo) \
+	X(GetEnvInt) \
+	X(GetFaceCounts) \
+	X(GetFirstVolumeTile) \
+	X(GetGeoInfo) \
+	X(GetGeoSize) \
+	X(GetGroupCountOnPackedInstancePart) \
+	X(GetGroupMembership) \
+	X(GetGroupMembershipOnPackedInstancePart) \
+	X(GetGroupNames) \
+	X(GetGroupNamesOnPackedInstancePart) \
+	X(GetHIPFileNodeCount) \
+	X(GetHIPFileNodeIds) \
+	X(GetHandleBindingInfo) \
+	X(GetHandleInfo) \
+	X(GetHeightFieldData) \
+	X(GetImageFilePath) \
+	X(GetImageInfo) \
+	X(GetImageMemoryBuffer) \
+	X(GetImagePlaneCount) \
+	X(GetImagePlanes) \
+	X(GetInstanceTransformsOnPart) \
+	X(GetInstancedObjectIds) \
+	X(GetInstancedPartIds) \
+	X(GetInstancerPartTransforms) \
+	X(GetManagerNodeId) \
+	X(GetMaterialInfo) \
+	X(GetMaterialNodeIdsOnFaces) \
+	X(GetNextVolumeTile) \
+	X(GetNodeInfo) \
+	X(GetNodeInputName) \
+	X(GetNodeOutputName) \
+	X(GetNodePath) \
+	X(GetNumWorkitems) \
+	X(GetObjectInfo) \
+	X(GetObjectTransform) \
+	X(GetOutputNodeId) \
+	X(GetPDGEvents) \
+	X(GetPDGGraphContextId) \
+	X(GetPDGGraphContexts) \
+	X(GetPDGState) \
+	X(GetParameters) \
+	X(GetParmChoiceLists) \
+	X(GetParmExpression) \
+	X(GetParmFile) \
+	X(GetParmFloatValue) \
+	X(GetParmFloatValues) \
+	X(GetParmIdFromName) \
+	X(GetParmInfo) \
+	X(GetParmInfoFromName) \
+	X(GetParmIntValue) \
+	X(GetParmIntValues) \
+	X(GetParmNodeValue) \
+	X(GetParmStringValue) \
+	X(GetParmStringValues) \
+	X(GetParmTagName) \
+	X(GetParmTagValue) \
+	X(GetParmWithTag) \
+	X(GetPartInfo) \
+	X(GetPreset) \
+	X(GetPresetBufLength) \
+	X(GetServerEnvInt) \
+	X(GetServerEnvString) \
+	X(GetServerEnvVarCount) \
+	X(GetServerEnvVarList) \
+	X(GetSessionEnvInt) \
+	X(GetSessionSyncInfo) \
+	X(GetSphereInfo) \
+	X(GetStatus) \
+	X(GetStatusString) \
+	X(GetStatusStringBufLength) \
+	X(GetString) \
+	X(GetStringBatch) \
+	X(GetStringBatchSize) \
+	X(GetStringBufLength) \
+	X(GetSupportedImageFileFormatCount) \
+	X(GetSupportedImageFileFormats) \
+	X(GetTime) \
+	X(GetTimelineOptions) \
+	X(GetTotalCookCount) \
+	X(GetUseHoudiniTime) \
+	X(GetVertexList) \
+	X(GetViewport) \
+	X(GetVolumeBounds) \
+	X(GetVolumeInfo) \
+	X(GetVolumeTileFloatData) \
+	X(GetVolumeTileIntData) \
+	X(GetVolumeVisualInfo) \
+	X(GetVolumeVoxelFloatData) \
+	X(GetVolumeVoxelIntData) \
+	X(GetWorkitemDataLength) \
+	X(GetWorkitemFloatData) \
+	X(GetWorkitemInfo) \
+	X(GetWorkitemIntData) \
+	X(GetWorkitemResultInfo) \
+	X(GetWorkitemStringData) \
+	X(GetWorkitems) \
+	X(Initialize) \
+	X(InsertMultiparmInstance) \
+	X(Interrupt) \
+	X(IsInitialized) \
+	X(IsNodeValid) \
+	X(IsSessionValid) \
+	X(LoadAssetLibraryFromFile) \
+	X(LoadAssetLibraryFromMemory) \
+	X(LoadGeoFromFile) \
+	X(LoadGeoFromMemory) \
+	X(LoadHIPFile) \
+	X(LoadNodeFromFile) \
+	X(MergeHIPFile) \
+	X(ParmHasExpression) \
+	X(ParmHasTag) \
+	X(ParmInfo_GetFloatValueCount) \
+	X(ParmInfo_GetIntValueCount) \
+	X(ParmInfo_GetStringValueCount) \
+	X(ParmInfo_IsFloat) \
+	X(ParmInfo_IsInt) \
+	X(ParmInfo_IsNode) \
+	X(ParmInfo_IsNonValue) \
+	X(ParmInfo_IsPath) \
+	X(ParmInfo_IsString) \
+	X(PartInfo_GetAttributeCountByOwner) \
+	X(PartInfo_GetElementCountByAttributeOwner) \
+	X(PartInfo_GetElementCountByGroupType) \
+	X(PausePDGCook) \
+	X(PythonThreadInterpreterLock) \
+	X(QueryNodeInput) \
+	X(QueryNodeOutputConnectedCount) \
+	X(QueryNodeOutputConnectedNodes) \
+	X(RemoveCustomString) \
+	X(RemoveMultiparmInstance) \
+	X(RemoveParmExpression) \
+	X(RenameNode) \
+	X(RenderCOPToImage) \
+	X(RenderTextureToImage) \
+	X(ResetSimulation) \
+	X(RevertGeo) \
+	X(RevertParmToDefault) \
+	X(RevertParmToDefaults) \
+	X(SaveGeoToFile) \
+	X(SaveGeoToMemory) \
+	X(SaveHIPFile) \
+	X(SaveNodeToFile) \
+	X(SetAnimCurve) \
+	X(SetAttributeFloat64Data) \
+	X(SetAttributeFloatData) \
+	X(SetAttributeInt64Data) \
+	X(SetAttributeIntData) \
+	X(SetAttributeStringData) \
+	X(SetCacheProperty) \
+	X(SetCurveCounts) \
+	X(SetCurveInfo) \
+	X(SetCurveKnots) \
+	X(SetCurveOrders) \
+	X(SetCustomString) \
+	X(SetFaceCounts) \
+	X(SetGroupMembership) \
+	X(SetHeightFieldData) \
+	X(SetImageInfo) \
+	X(SetNodeDisplay) \
+	X(SetObjectTransform) \
+	X(SetParmExpression) \
+	X(SetParmFloatValue) \
+	X(SetParmFloatValues) \
+	X(SetParmIntValue) \
+	X(SetParmIntValues) \
+	X(SetParmNodeValue) \
+	X(SetParmStringValue) \
+	X(SetPartInfo) \
+	X(SetPreset) \
+	X(SetServerEnvInt) \
+	X(SetServerEnvString) \
+	X(SetSessionSync) \
+	X(SetSessionSyncInfo) \
+	X(SetTime) \
+	X(SetTimelineOptions) \
+	X(SetTransformAnimCurve) \
+	X(SetUseHoudiniTime) \
+	X(SetVertexList) \
+	X(SetViewport) \
+	X(SetVolumeInfo) \
+	X(SetVolumeTileFloatData) \
+	X(SetVolumeTileIntData) \
+	X(SetVolumeVoxelFloatData) \
+	X(SetVolumeVoxelIntData) \
+	X(SetWorkitemFloatData) \
+	X(SetWorkitemIntData) \
+	X(SetWorkitemStringData) \
+	X(StartThriftNamedPipeServer) \
+	X(StartThriftSocketServer)
+
+// Local helpers creating/initializing the HAPI structs
+#define HOUDINI_API_STRUCT_FUNCTIONS(X) \
+	X(AssetInfo_Create) \
+	X(AssetInfo_Init) \
+	X(AttributeInfo_Create) \
+	X(AttributeInfo_Init) \
+	X(CookOptions_Create) \
+	X(CookOptions_Init) \
+	X(CurveInfo_Create) \
+	X(CurveInfo_Init) \
+	X(GeoInfo_Create) \
+	X(GeoInfo_Init) \
+	X(HandleBindingInfo_Create) \
+	X(HandleBindingInfo_Init) \
+	X(HandleInfo_Create) \
+	X(HandleInfo_Init) \
+	X(ImageFileFormat_Create) \
+	X(ImageFileFormat_Init) \
+	X(ImageInfo_Create) \
+	X(ImageInfo_Init) \
+	X(Keyframe_Create) \
+	X(Keyframe_Init) \
+	X(MaterialInfo_Create) \
+	X(MaterialInfo_Init) \
+	X(NodeInfo_Create) \
+	X(NodeInfo_Init) \
+	X(ObjectInfo_Create) \
+	X(ObjectInfo_Init) \
+	X(ParmChoiceInfo_Create) \
+	X(ParmChoiceInfo_Init) \
+	X(ParmInfo_Create) \
+	X(ParmInfo_Init) \
+	X(PartInfo_Create) \
+	X(PartInfo_Init) \
+	X(SessionSyncInfo_Create) \
+	X(ThriftServerOptions_Create) \
+	X(ThriftServerOptions_Init) \
+	X(TimelineOptions_Create) \
+	X(TimelineOptions_Init) \
+	X(TransformEuler_Create) \
+	X(TransformEuler_Init) \
+	X(Transform_Create) \
+	X(Transform_Init) \
+	X(Viewport_Create) \
+	X(VolumeInfo_Create) \
+	X(VolumeInfo_Init) \
+	X(VolumeTileInfo_Create) \
+	X(VolumeTileInfo_Init)
@@ -0,0 +1,152 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Features installing wrappers on the FHoudiniApi function pointers.
+// Layers are chained in this order: the first one is the closest to HAPI.
+enum class EHoudiniApiHookLayer : uint8
+{
+	// HAPI call recording/replay (FHoudiniApiRecorder)
+	Recorder = 0,
+	// HAPI call instrumentation (FHoudiniApiStats)
+	Stats,
+
+	Count
+};
+
+// Owns the original pointer of an FHoudiniApi function and the wrappers installed on it.
+// The function pointer is always set to the outermost installed wrapper, and each wrapper calls
+// GetNext() for its layer, which is either the next installed wrapper or the original function.
+// Layers can then be installed and removed in any order without breaking the chain.
+// Must be called from the game thread.
+template<typename TFunctionPtr, TFunctionPtr* TApiFunction>
+struct THoudiniApiHook
+{
+	static TFunctionPtr GetNext(const EHoudiniApiHookLayer& InLayer)
+	{
+		return Next[(int32)InLayer];
+	}
+
+	static void Install(const EHoudiniApiHookLayer& InLayer, TFunctionPtr InWrapper)
+	{
+		if (!HasWrappers())
+		{
+			Original = *TApiFunction;
+		}
+		else if (*TApiFunction != GetOutermost())
+		{
+			// The pointer has been reset since our wrappers were installed (HAPI was reloaded):
+			// the new pointer is the original one, our previous wrappers aren't in use anymore
+			Original = *TApiFunction;
+			ResetWrappers();
+		}
+
+		Wrappers[(int32)InLayer] = InWrapper;
+		UpdateChain();
+	}
+
+	static void Uninstall(const EHoudiniApiHookLayer& InLayer)
+	{
+		if (!Wrappers[(int32)InLayer])
+			return;
+
+		if (*TApiFunction != GetOutermost())
+		{
+			// The pointer has been reset since our wrappers were installed, leave it as is
+			ResetWrappers();
+			return;
+		}
+
+		Wrappers[(int32)InLayer] = nullptr;
+		UpdateChain();
+	}
+
+	static bool IsInstalled(const EHoudiniApiHookLayer& InLayer)
+	{
+		return Wrappers[(int32)InLayer] != nullptr;
+	}
+
+private:
+
+	static bool HasWrappers()
+	{
+		for (int32 Layer = 0; Layer < (int32)EHoudiniApiHookLayer::Count; Layer++)
+		{
+			if (Wrappers[Layer])
+				return true;
+		}
+
+		return false;
+	}
+
+	static TFunctionPtr GetOutermost()
+	{
+		for (int32 Layer = (int32)EHoudiniApiHookLayer::Count - 1; Layer >= 0; Layer--)
+		{
+			if (Wrappers[Layer])
+				return Wrappers[Layer];
+		}
+
+		return Original;
+	}
+
+	static void ResetWrappers()
+	{
+		for (int32 Layer = 0; Layer < (int32)EHoudiniApiHookLayer::Count; Layer++)
+			Wrappers[Layer] = nullptr;
+	}
+
+	// Links each layer to the next installed one, and sets the function pointer to the outermost wrapper.
+	// The Next pointers stay valid for the wrappers that are being removed, in case they're still running on another thread.
+	static void UpdateChain()
+	{
+		TFunctionPtr Current = Original;
+		for (int32 Layer = 0; Layer < (int32)EHoudiniApiHookLayer::Count; Layer++)
+		{
+			Next[Layer] = Current;
+			if (Wrappers[Layer])
+				Current = Wrappers[Layer];
+		}
+
+		*TApiFunction = Current;
+	}
+
+	static TFunctionPtr Original;
+	static TFunctionPtr Wrappers[(int32)EHoudiniApiHookLayer::Count];
+	static TFunctionPtr Next[(int32)EHoudiniApiHookLayer::Count];
+};
+
+template<typename TFunctionPtr, TFunctionPtr* TApiFunction>
+TFunctionPtr THoudiniApiHook<TFunctionPtr, TApiFunction>::Original = nullptr;
+
+template<typename TFunctionPtr, TFunctionPtr* TApiFunction>
+TFunctionPtr THoudiniApiHook<TFunctionPtr, TApiFunction>::Wrappers[(int32)EHoudiniApiHookLayer::Count] = {};
+
+template<typename TFunctionPtr, TFunctionPtr* TApiFunction>
+TFunctionPtr THoudiniApiHook<TFunctionPtr, TApiFunction>::Next[(int32)EHoudiniApiHookLayer::Count] = {};
@@ -0,0 +1,714 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniApiRecorder.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniApiFunctions.h"
+#include "HoudiniApiHooks.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+
+#include <cstring>
+
+// Trace file header
+#define HOUDINI_API_TRACE_MAGIC 0x43525448
+#define HOUDINI_API_TRACE_VERSION 3
+
+// When replaying, number of recorded calls that can be skipped to find the requested function
+#define HOUDINI_API_REPLAY_MAX_SKIPPED_CALLS 64
+
+// Collects the input hash and the output buffers of a HAPI call from its arguments
+struct FHoudiniApiCallArguments
+{
+	TArray<FHoudiniApiRecorder::FOutputBuffer, TInlineAllocator<4>> Outputs;
+	uint32 InputHash = 0;
+	int32 TupleSize = 1;
+	// Indicates if the following int arguments give the size of the last output
+	bool bLastOutputHasCount = false;
+
+	void Visit() {}
+
+	template<typename TArg, typename... TRest>
+	void Visit(const TArg& InArg, const TRest&... InRest)
+	{
+		VisitArg(InArg);
+		Visit(InRest...);
+	}
+
+	// Values
+	template<typename TArg>
+	void VisitArg(const TArg& InArg)
+	{
+		// Only hash plain values, structs may contain uninitialized padding
+		if (TIsArithmetic<TArg>::Value || TIsEnum<TArg>::Value)
+			InputHash = FCrc::MemCrc32(&InArg, sizeof(TArg), InputHash);
+	}
+
+	void VisitArg(const int& InValue)
+	{
+		InputHash = FCrc::MemCrc32(&InValue, sizeof(int), InputHash);
+		if (bLastOutputHasCount)
+			Outputs.Last().Count = FMath::Max(InValue, 0);
+	}
+
+	void VisitArg(const char* InString)
+	{
+		if (InString)
+			InputHash = FCrc::MemCrc32(InString, (int32)strlen(InString), InputHash);
+
+		bLastOutputHasCount = false;
+	}
+
+	// Input pointers
+	template<typename TElement>
+	void VisitArg(const TElement* const& InPointer)
+	{
+		bLastOutputHasCount = false;
+	}
+
+	void VisitArg(const char** InStrings) { bLastOutputHasCount = false; }
+	void VisitArg(void* InPointer) { bLastOutputHasCount = false; }
+
+	void VisitArg(const HAPI_AttributeInfo* InAttributeInfo)
+	{
+		if (InAttributeInfo)
+			TupleSize = FMath::Max(InAttributeInfo->tupleSize, 1);
+
+		bLastOutputHasCount = false;
+	}
+
+	// Outputs
+	template<typename TElement>
+	void VisitArg(TElement* const& InPointer)
+	{
+		AddOutput(InPointer, sizeof(TElement));
+		bLastOutputHasCount = true;
+	}
+
+	void VisitArg(HAPI_Session* InSession)
+	{
+		AddOutput(InSession, sizeof(HAPI_Session));
+		bLastOutputHasCount = false;
+	}
+
+	void VisitArg(HAPI_AttributeInfo* InAttributeInfo)
+	{
+		if (InAttributeInfo)
+			TupleSize = FMath::Max(InAttributeInfo->tupleSize, 1);
+
+		AddOutput(InAttributeInfo, sizeof(HAPI_AttributeInfo));
+		bLastOutputHasCount = false;
+	}
+
+	void AddOutput(void* InData, const int32& InElementSize)
+	{
+		FHoudiniApiRecorder::FOutputBuffer Output;
+		Output.Data = InData;
+		Output.ElementSize = InElementSize;
+		Output.Count = InData ? 1 : 0;
+		Outputs.Add(Output);
+	}
+
+	// Applies the function specific sizes
+	void Finalize(const uint8& InFunctionFlags)
+	{
+		if (InFunctionFlags & FHoudiniApiRecorder::TupleArrays)
+		{
+			// The first output is the attribute info, the following ones are the data arrays
+			for (int32 Idx = 1; Idx < Outputs.Num(); Idx++)
+				Outputs[Idx].Count *= TupleSize;
+		}
+
+		if ((InFunctionFlags & FHoudiniApiRecorder::PDGGraphContexts) && Outputs.Num() == 3)
+		{
+			Outputs[1].Count = Outputs[2].Count;
+		}
+
+		for (auto& Output : Outputs)
+		{
+			if (!Output.Data)
+				Output.Count = 0;
+		}
+	}
+};
+
+// Stores the return value of a HAPI call
+template<typename TReturn>
+struct THoudiniApiReturnValue
+{
+	THoudiniApiReturnValue() { FMemory::Memzero(&Value, sizeof(TReturn)); }
+
+	template<typename TFunction, typename... TArgs>
+	void Call(TFunction InFunction, TArgs... InArgs) { Value = InFunction(InArgs...); }
+
+	void* GetData() { return &Value; }
+	int32 GetSize() const { return sizeof(TReturn); }
+	TReturn Get() const { return Value; }
+
+	void SetReplayResult(const bool& bInSuccess) {}
+
+	TReturn Value;
+};
+
+template<>
+void THoudiniApiReturnValue<HAPI_Result>::SetReplayResult(const bool& bInSuccess)
+{
+	Value = bInSuccess ? HAPI_RESULT_SUCCESS : HAPI_RESULT_FAILURE;
+}
+
+template<>
+struct THoudiniApiReturnValue<void>
+{
+	template<typename TFunction, typename... TArgs>
+	void Call(TFunction InFunction, TArgs... InArgs) { InFunction(InArgs...); }
+
+	void* GetData() { return nullptr; }
+	int32 GetSize() const { return 0; }
+	void Get() const {}
+
+	void SetReplayResult(const bool& bInSuccess) {}
+};
+
+// Indicates that the HAPI library was loaded when the replay started
+static bool bReplayHasHAPILibrary = false;
+
+// Wrapper installed on an FHoudiniApi function pointer while recording or replaying,
+// in the Recorder layer of its THoudiniApiHook
+template<typename TFunctionPtr, TFunctionPtr* TApiFunction>
+struct THoudiniApiRecorderWrapper;
+
+template<typename TReturn, typename... TArgs, TReturn(**TApiFunction)(TArgs...)>
+struct THoudiniApiRecorderWrapper<TReturn(*)(TArgs...), TApiFunction>
+{
+	typedef TReturn(*FFunctionPtr)(TArgs...);
+	typedef THoudiniApiHook<FFunctionPtr, TApiFunction> FHook;
+
+	// Calls the original function and writes the call to the trace
+	static TReturn Record(TArgs... InArgs)
+	{
+		THoudiniApiReturnValue<TReturn> ReturnValue;
+		ReturnValue.Call(FHook::GetNext(EHoudiniApiHookLayer::Recorder), InArgs...);
+
+		// Visit the arguments after the call, as the output sizes can depend on it (attribute info)
+		FHoudiniApiCallArguments Arguments;
+		Arguments.Visit(InArgs...);
+		Arguments.Finalize(FHoudiniApiRecorder::GetFunctionFlags(FunctionIndex));
+		FHoudiniApiRecorder::RecordCall(
+			FunctionIndex, Arguments.InputHash, ReturnValue.GetData(), ReturnValue.GetSize(), Arguments.Outputs);
+
+		return ReturnValue.Get();
+	}
+
+	// Serves the call from the trace
+	static TReturn Replay(TArgs... InArgs)
+	{
+		const uint8 Flags = FHoudiniApiRecorder::GetFunctionFlags(FunctionIndex);
+
+		FHoudiniApiCallArguments Arguments;
+		Arguments.Visit(InArgs...);
+		Arguments.Finalize(Flags);
+
+		THoudiniApiReturnValue<TReturn> ReturnValue;
+		if (!FHoudiniApiRecorder::ReplayCall(
+			FunctionIndex, Arguments.InputHash, ReturnValue.GetData(), ReturnValue.GetSize(), Arguments.Outputs))
+		{
+			ReturnValue.SetReplayResult((Flags & FHoudiniApiRecorder::SessionControl) != 0);
+		}
+
+		return ReturnValue.Get();
+	}
+
+	// Struct helpers aren't recorded, use HAPI if available or zero the structs
+	static TReturn ReplayStruct(TArgs... InArgs)
+	{
+		THoudiniApiReturnValue<TReturn> ReturnValue;
+		if (bReplayHasHAPILibrary)
+		{
+			ReturnValue.Call(FHook::GetNext(EHoudiniApiHookLayer::Recorder), InArgs...);
+		}
+		else
+		{
+			FHoudiniApiCallArguments Arguments;
+			Arguments.Visit(InArgs...);
+			for (auto& Output : Arguments.Outputs)
+			{
+				if (Output.Data)
+					FMemory::Memzero(Output.Data, Output.ElementSize);
+			}
+		}
+
+		return ReturnValue.Get();
+	}
+
+	static void Install(const int32& InFunctionIndex, FFunctionPtr InFunction)
+	{
+		FunctionIndex = InFunctionIndex;
+		FHook::Install(EHoudiniApiHookLayer::Recorder, InFunction);
+	}
+
+	static void Uninstall()
+	{
+		FHook::Uninstall(EHoudiniApiHookLayer::Recorder);
+	}
+
+	static int32 FunctionIndex;
+};
+
+template<typename TReturn, typename... TArgs, TReturn(**TApiFunction)(TArgs...)>
+int32 THoudiniApiRecorderWrapper<TReturn(*)(TArgs...), TApiFunction>::FunctionIndex = INDEX_NONE;
+
+#define HOUDINI_API_RECORDER_WRAPPER(FunctionName) \
+	THoudiniApiRecorderWrapper<FHoudiniApi::FunctionName##FuncPtr, &FHoudiniApi::FunctionName>
+
+TArray<FString>
+FHoudiniApiRecorder::FunctionNames;
+
+TArray<uint8>
+FHoudiniApiRecorder::FunctionFlags;
+
+FArchive*
+FHoudiniApiRecorder::TraceWriter = nullptr;
+
+TArray<uint8>
+FHoudiniApiRecorder::TraceData;
+
+TArray<FHoudiniApiRecorder::FRecordedCall>
+FHoudiniApiRecorder::RecordedCalls;
+
+TArray<TArray<int32>>
+FHoudiniApiRecorder::CallStreams;
+
+TArray<int32>
+FHoudiniApiRecorder::StreamPositions;
+
+int32
+FHoudiniApiRecorder::SkippedCalls = 0;
+
+int32
+FHoudiniApiRecorder::DivergentCalls = 0;
+
+FCriticalSection
+FHoudiniApiRecorder::TraceCriticalSection;
+
+bool
+FHoudiniApiRecorder::bRecording = false;
+
+bool
+FHoudiniApiRecorder::bReplaying = false;
+
+void
+FHoudiniApiRecorder::InitializeFunctions()
+{
+	if (FunctionNames.Num() > 0)
+		return;
+
+#define HOUDINI_API_RECORDER_ADD_NAME(FunctionName) \
+	FunctionNames.Add(TEXT(#FunctionName));
+	HOUDINI_API_SESSION_FUNCTIONS(HOUDINI_API_RECORDER_ADD_NAME)
+	HOUDINI_API_STRUCT_FUNCTIONS(HOUDINI_API_RECORDER_ADD_NAME)
+#undef HOUDINI_API_RECORDER_ADD_NAME
+
+	static const TSet<FString> SessionControlFunctions = {
+		TEXT("IsSessionValid"), TEXT("IsInitialized"), TEXT("Initialize"), TEXT("Cleanup"), TEXT("CloseSession"),
+		TEXT("CreateInProcessSession"), TEXT("CreateThriftSocketSession"), TEXT("CreateThriftNamedPipeSession"),
+		TEXT("StartThriftSocketServer"), TEXT("StartThriftNamedPipeServer"), TEXT("ClearConnectionError"), TEXT("Interrupt") };
+
+	FunctionFlags.SetNumZeroed(FunctionNames.Num());
+	for (int32 Idx = 0; Idx < FunctionNames.Num(); Idx++)
+	{
+		const FString& Name = FunctionNames[Idx];
+		if (Name.StartsWith(TEXT("GetAttribute")) && Name.EndsWith(TEXT("Data")) && !Name.EndsWith(TEXT("ArrayData")))
+			FunctionFlags[Idx] |= TupleArrays;
+
+		if (SessionControlFunctions.Contains(Name))
+			FunctionFlags[Idx] |= SessionControl;
+
+		if (Name.Equals(TEXT("GetPDGGraphContexts")))
+			FunctionFlags[Idx] |= PDGGraphContexts;
+	}
+}
+
+int32
+FHoudiniApiRecorder::GetCurrentStream()
+{
+	// The game thread calls are made in a deterministic order, whatever session they use.
+	// With the session pool, each session has its own scheduler thread: their calls are
+	// interleaved in any order, so they're stored in one stream per session.
+	if (IsInGameThread())
+		return 0;
+
+	return 1 + FMath::Clamp(FHoudiniEngine::GetCurrentSessionIndex(), 0, 254);
+}
+
+uint8
+FHoudiniApiRecorder::GetFunctionFlags(const int32& InFunctionIndex)
+{
+	return FunctionFlags.IsValidIndex(InFunctionIndex) ? FunctionFlags[InFunctionIndex] : None;
+}
+
+bool
+FHoudiniApiRecorder::StartRecording(const FString& InFilePath)
+{
+	if (bRecording || bReplaying)
+	{
+		HOUDINI_LOG_WARNING(TEXT("HAPI recorder: already recording or replaying."));
+		return false;
+	}
+
+	if (!FHoudiniApi::IsHAPIInitialized())
+	{
+		HOUDINI_LOG_WARNING(TEXT("HAPI recorder: HAPI is not initialized, the calls can't be recorded."));
+		return false;
+	}
+
+	InitializeFunctions();
+
+	TraceWriter = IFileManager::Get().CreateFileWriter(*InFilePath);
+	if (!TraceWriter)
+	{
+		HOUDINI_LOG_ERROR(TEXT("HAPI recorder: could not create %s."), *InFilePath);
+		return false;
+	}
+
+	// Header: the function names are stored so traces stay valid if the function list changes
+	uint32 Magic = HOUDINI_API_TRACE_MAGIC;
+	uint32 Version = HOUDINI_API_TRACE_VERSION;
+	*TraceWriter << Magic << Version << FunctionNames;
+
+	int32 FunctionIndex = 0;
+#define HOUDINI_API_RECORDER_INSTALL(FunctionName) \
+	HOUDINI_API_RECORDER_WRAPPER(FunctionName)::Install(FunctionIndex++, &HOUDINI_API_RECORDER_WRAPPER(FunctionName)::Record);
+	HOUDINI_API_SESSION_FUNCTIONS(HOUDINI_API_RECORDER_INSTALL)
+#undef HOUDINI_API_RECORDER_INSTALL
+
+	bRecording = true;
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI recorder: recording to %s."), *InFilePath);
+	return true;
+}
+
+void
+FHoudiniApiRecorder::StopRecording()
+{
+	if (!bRecording)
+		return;
+
+#define HOUDINI_API_RECORDER_UNINSTALL(FunctionName) \
+	HOUDINI_API_RECORDER_WRAPPER(FunctionName)::Uninstall();
+	HOUDINI_API_SESSION_FUNCTIONS(HOUDINI_API_RECORDER_UNINSTALL)
+#undef HOUDINI_API_RECORDER_UNINSTALL
+
+	FScopeLock ScopeLock(&TraceCriticalSection);
+	bRecording = false;
+	if (TraceWriter)
+	{
+		TraceWriter->Close();
+		delete TraceWriter;
+		TraceWriter = nullptr;
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI recorder: recording stopped."));
+}
+
+bool
+FHoudiniApiRecorder::IsRecording()
+{
+	return bRecording;
+}
+
+void
+FHoudiniApiRecorder::RecordCall(
+	const int32& InFunctionIndex, const uint32& InInputHash,
+	const void* InReturnValue, const int32& InReturnSize,
+	const TArray<FOutputBuffer, TInlineAllocator<4>>& InOutputs)
+{
+	FScopeLock ScopeLock(&TraceCriticalSection);
+	if (!TraceWriter)
+		return;
+
+	uint8 Stream = (uint8)GetCurrentStream();
+	uint16 FunctionIndex = (uint16)InFunctionIndex;
+	uint32 InputHash = InInputHash;
+	uint8 ReturnSize = (uint8)InReturnSize;
+	*TraceWriter << Stream << FunctionIndex << InputHash << ReturnSize;
+	if (ReturnSize > 0)
+		TraceWriter->Serialize(const_cast<void*>(InReturnValue), ReturnSize);
+
+	uint8 NumOutputs = (uint8)InOutputs.Num();
+	*TraceWriter << NumOutputs;
+	for (const FOutputBuffer& Output : InOutputs)
+	{
+		// Large attribute arrays can exceed 2GB
+		int64 Size = (int64)Output.ElementSize * (int64)Output.Count;
+		*TraceWriter << Size;
+		if (Size > 0)
+			TraceWriter->Serialize(Output.Data, Size);
+	}
+}
+
+bool
+FHoudiniApiRecorder::LoadTrace(const FString& InFilePath)
+{
+	TraceData.Empty();
+	RecordedCalls.Empty();
+	CallStreams.Empty();
+
+	if (!FFileHelper::LoadFileToArray(TraceData, *InFilePath))
+	{
+		HOUDINI_LOG_ERROR(TEXT("HAPI recorder: could not read %s."), *InFilePath);
+		return false;
+	}
+
+	FMemoryReader Reader(TraceData);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	TArray<FString> RecordedFunctionNames;
+	Reader << Magic << Version;
+	if (Magic != HOUDINI_API_TRACE_MAGIC || Version != HOUDINI_API_TRACE_VERSION)
+	{
+		HOUDINI_LOG_ERROR(TEXT("HAPI recorder: %s is not a valid HAPI trace."), *InFilePath);
+		return false;
+	}
+
+	Reader << RecordedFunctionNames;
+	if (Reader.IsError())
+	{
+		HOUDINI_LOG_ERROR(TEXT("HAPI recorder: %s is not a valid HAPI trace."), *InFilePath);
+		return false;
+	}
+
+	// Map the recorded functions to the current ones
+	TArray<int32> FunctionRemap;
+	FunctionRemap.SetNum(RecordedFunctionNames.Num());
+	for (int32 Idx = 0; Idx < RecordedFunctionNames.Num(); Idx++)
+		FunctionRemap[Idx] = FunctionNames.IndexOfByKey(RecordedFunctionNames[Idx]);
+
+	// Skips a recorded buffer, Seek() asserts if the position is past the end of the trace
+	auto SkipBuffer = [&Reader](const int64& InSize)
+	{
+		if (Reader.IsError() || InSize < 0 || Reader.Tell() + InSize > TraceData.Num())
+			return false;
+
+		Reader.Seek(Reader.Tell() + InSize);
+		return true;
+	};
+
+	while (!Reader.AtEnd() && !Reader.IsError())
+	{
+		uint8 Stream = 0;
+		uint16 FunctionIndex = 0;
+		uint8 ReturnSize = 0;
+		FRecordedCall Call;
+		Reader << Stream << FunctionIndex << Call.InputHash << ReturnSize;
+
+		Call.FunctionIndex = FunctionRemap.IsValidIndex(FunctionIndex) ? FunctionRemap[FunctionIndex] : INDEX_NONE;
+		Call.ReturnOffset = (int32)Reader.Tell();
+		Call.ReturnSize = ReturnSize;
+		bool bValidCall = SkipBuffer(ReturnSize);
+
+		uint8 NumOutputs = 0;
+		if (bValidCall)
+			Reader << NumOutputs;
+
+		for (int32 Idx = 0; Idx < NumOutputs && bValidCall; Idx++)
+		{
+			int64 Size = 0;
+			Reader << Size;
+			Call.Outputs.Add(TPair<int32, int32>((int32)Reader.Tell(), (int32)Size));
+			bValidCall = SkipBuffer(Size);
+		}
+
+		if (!bValidCall || Reader.IsError())
+		{
+			HOUDINI_LOG_WARNING(TEXT("HAPI recorder: %s is truncated, ignoring the last call."), *InFilePath);
+			break;
+		}
+
+		if (!CallStreams.IsValidIndex(Stream))
+			CallStreams.SetNum(Stream + 1);
+		CallStreams[Stream].Add(RecordedCalls.Add(MoveTemp(Call)));
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI recorder: loaded %d calls (%d on the game thread) in %d streams from %s."),
+		RecordedCalls.Num(), CallStreams.Num() > 0 ? CallStreams[0].Num() : 0, CallStreams.Num(), *InFilePath);
+
+	return true;
+}
+
+bool
+FHoudiniApiRecorder::StartReplay(const FString& InFilePath)
+{
+	if (bRecording || bReplaying)
+	{
+		HOUDINI_LOG_WARNING(TEXT("HAPI recorder: already recording or replaying."));
+		return false;
+	}
+
+	InitializeFunctions();
+	if (!LoadTrace(InFilePath))
+		return false;
+
+	StreamPositions.Init(0, CallStreams.Num());
+	SkippedCalls = 0;
+	DivergentCalls = 0;
+	bReplayHasHAPILibrary = FHoudiniApi::IsHAPIInitialized();
+
+	int32 FunctionIndex = 0;
+#define HOUDINI_API_RECORDER_INSTALL_REPLAY(FunctionName) \
+	HOUDINI_API_RECORDER_WRAPPER(FunctionName)::Install(FunctionIndex++, &HOUDINI_API_RECORDER_WRAPPER(FunctionName)::Replay);
+#define HOUDINI_API_RECORDER_INSTALL_REPLAY_STRUCT(FunctionName) \
+	HOUDINI_API_RECORDER_WRAPPER(FunctionName)::Install(FunctionIndex++, &HOUDINI_API_RECORDER_WRAPPER(FunctionName)::ReplayStruct);
+	HOUDINI_API_SESSION_FUNCTIONS(HOUDINI_API_RECORDER_INSTALL_REPLAY)
+	HOUDINI_API_STRUCT_FUNCTIONS(HOUDINI_API_RECORDER_INSTALL_REPLAY_STRUCT)
+#undef HOUDINI_API_RECORDER_INSTALL_REPLAY
+#undef HOUDINI_API_RECORDER_INSTALL_REPLAY_STRUCT
+
+	bReplaying = true;
+	return true;
+}
+
+void
+FHoudiniApiRecorder::StopReplay()
+{
+	if (!bReplaying)
+		return;
+
+#define HOUDINI_API_RECORDER_UNINSTALL(FunctionName) \
+	HOUDINI_API_RECORDER_WRAPPER(FunctionName)::Uninstall();
+	HOUDINI_API_SESSION_FUNCTIONS(HOUDINI_API_RECORDER_UNINSTALL)
+	HOUDINI_API_STRUCT_FUNCTIONS(HOUDINI_API_RECORDER_UNINSTALL)
+#undef HOUDINI_API_RECORDER_UNINSTALL
+
+	FScopeLock ScopeLock(&TraceCriticalSection);
+	bReplaying = false;
+
+	int32 ReplayedCalls = 0;
+	for (const int32& Position : StreamPositions)
+		ReplayedCalls += Position;
+
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI recorder: replay stopped, %d/%d calls replayed, %d skipped, %d with different inputs."),
+		ReplayedCalls, RecordedCalls.Num(), SkippedCalls, DivergentCalls);
+
+	TraceData.Empty();
+	RecordedCalls.Empty();
+	CallStreams.Empty();
+	StreamPositions.Empty();
+}
+
+bool
+FHoudiniApiRecorder::IsReplaying()
+{
+	return bReplaying;
+}
+
+bool
+FHoudiniApiRecorder::ReplayCall(
+	const int32& InFunctionIndex, const uint32& InInputHash,
+	void* OutReturnValue, const int32& InReturnSize,
+	const TArray<FOutputBuffer, TInlineAllocator<4>>& InOutputs)
+{
+	FScopeLock ScopeLock(&TraceCriticalSection);
+
+	const int32 Stream = GetCurrentStream();
+	if (!CallStreams.IsValidIndex(Stream))
+	{
+		HOUDINI_LOG_WARNING(TEXT("HAPI recorder: no calls were recorded for session %d."), Stream - 1);
+		return false;
+	}
+
+	const TArray<int32>& Calls = CallStreams[Stream];
+	int32& Position = StreamPositions[Stream];
+
+	// Look for the next call to that function, allowing a few calls to be skipped
+	for (int32 Search = Position; Search < Calls.Num() && Search <= Position + HOUDINI_API_REPLAY_MAX_SKIPPED_CALLS; Search++)
+	{
+		const FRecordedCall& Call = RecordedCalls[Calls[Search]];
+		if (Call.FunctionIndex != InFunctionIndex)
+			continue;
+
+		SkippedCalls += Search - Position;
+		Position = Search + 1;
+
+		if (Call.InputHash != InInputHash)
+		{
+			if (DivergentCalls++ < 10)
+			{
+				HOUDINI_LOG_WARNING(TEXT("HAPI recorder: %s was called with different inputs than recorded."),
+					*FunctionNames[InFunctionIndex]);
+			}
+		}
+
+		if (OutReturnValue && Call.ReturnSize == InReturnSize)
+			FMemory::Memcpy(OutReturnValue, &TraceData[Call.ReturnOffset], InReturnSize);
+
+		for (int32 Idx = 0; Idx < InOutputs.Num() && Idx < Call.Outputs.Num(); Idx++)
+		{
+			const FOutputBuffer& Output = InOutputs[Idx];
+			const int64 Size = FMath::Min((int64)Output.ElementSize * (int64)Output.Count, (int64)Call.Outputs[Idx].Value);
+			if (Output.Data && Size > 0)
+				FMemory::Memcpy(Output.Data, &TraceData[Call.Outputs[Idx].Key], Size);
+		}
+
+		return true;
+	}
+
+	HOUDINI_LOG_WARNING(TEXT("HAPI recorder: no recorded call found for %s."),
+		FunctionNames.IsValidIndex(InFunctionIndex) ? *FunctionNames[InFunctionIndex] : TEXT("Unknown"));
+
+	return false;
+}
+
+static void
+HoudiniApiRecordCommand(const TArray<FString>& Args)
+{
+	const FString Command = Args.Num() > 0 ? Args[0] : FString();
+	if (Command.Equals(TEXT("Start"), ESearchCase::IgnoreCase) && Args.Num() > 1)
+	{
+		FHoudiniApiRecorder::StartRecording(Args[1]);
+	}
+	else if (Command.Equals(TEXT("Stop"), ESearchCase::IgnoreCase))
+	{
+		FHoudiniApiRecorder::StopRecording();
+	}
+	else
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("Usage: Houdini.ApiRecord Start <FilePath> | Stop"));
+	}
+}
+
+static FAutoConsoleCommand CCmdHoudiniApiRecord(
+	TEXT("Houdini.ApiRecord"),
+	TEXT("Records the HAPI calls to a trace file, that can be replayed with the Replay session type.\n")
+	TEXT("Houdini.ApiRecord Start <FilePath>: starts recording.\n")
+	TEXT("Houdini.ApiRecord Stop: stops recording.\n"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&HoudiniApiRecordCommand));
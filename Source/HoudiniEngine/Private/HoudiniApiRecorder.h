@@ -0,0 +1,128 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Records the HAPI calls to a binary trace, and replays them without a Houdini session.
+//
+// When recording, every FHoudiniApi function communicating with the session is wrapped, and each call is
+// written to the trace with a hash of its input arguments, its return value and the content of its output buffers.
+// Following HAPI's conventions, non-const pointer arguments are considered as outputs,
+// their size is given by the last int argument following them (start/length or count).
+//
+// When replaying, the FHoudiniApi functions are replaced by functions serving the recorded calls in order.
+// Calls made on the game thread and on the scheduler thread of each session are recorded and replayed as separate streams.
+// A replay session can be started by using the Replay session type in the runtime settings,
+// recording is controlled with the Houdini.ApiRecord console command or with -HoudiniApiRecord=<file>.
+class HOUDINIENGINE_API FHoudiniApiRecorder
+{
+	public:
+
+		// An argument buffer, filled by the HAPI call.
+		struct FOutputBuffer
+		{
+			void* Data = nullptr;
+			int32 ElementSize = 0;
+			int32 Count = 1;
+		};
+
+		static bool StartRecording(const FString& InFilePath);
+		static void StopRecording();
+		static bool IsRecording();
+
+		static bool StartReplay(const FString& InFilePath);
+		static void StopReplay();
+		static bool IsReplaying();
+
+		// Writes a call to the trace, used by the recording wrappers.
+		static void RecordCall(
+			const int32& InFunctionIndex, const uint32& InInputHash,
+			const void* InReturnValue, const int32& InReturnSize,
+			const TArray<FOutputBuffer, TInlineAllocator<4>>& InOutputs);
+
+		// Serves a recorded call, used by the replay functions.
+		// Returns false if no matching call was found in the trace.
+		static bool ReplayCall(
+			const int32& InFunctionIndex, const uint32& InInputHash,
+			void* OutReturnValue, const int32& InReturnSize,
+			const TArray<FOutputBuffer, TInlineAllocator<4>>& InOutputs);
+
+		// Flags for the functions that need special handling
+		enum EFunctionFlags : uint8
+		{
+			None = 0,
+			// Output arrays are sized by the attribute info's tuple size
+			TupleArrays = 1 << 0,
+			// Session control functions, succeed when replaying even if they weren't recorded
+			SessionControl = 1 << 1,
+			// HAPI_GetPDGGraphContexts: the names array is sized by the last count argument
+			PDGGraphContexts = 1 << 2
+		};
+
+		static uint8 GetFunctionFlags(const int32& InFunctionIndex);
+
+	private:
+
+		struct FRecordedCall
+		{
+			int32 FunctionIndex = INDEX_NONE;
+			uint32 InputHash = 0;
+			int32 ReturnOffset = 0;
+			int32 ReturnSize = 0;
+			TArray<TPair<int32, int32>> Outputs;
+		};
+
+		// Fills the function names and flags.
+		static void InitializeFunctions();
+
+		// Stream of the calls made by the calling thread: 0 for the game thread,
+		// 1 + the session index for the other threads (one scheduler thread per session).
+		static int32 GetCurrentStream();
+
+		static bool LoadTrace(const FString& InFilePath);
+
+		static TArray<FString> FunctionNames;
+		static TArray<uint8> FunctionFlags;
+
+		// Recording
+		static FArchive* TraceWriter;
+
+		// Replay
+		static TArray<uint8> TraceData;
+		static TArray<FRecordedCall> RecordedCalls;
+		// Indices of the calls recorded in each stream (see GetCurrentStream), and the current position in them
+		static TArray<TArray<int32>> CallStreams;
+		static TArray<int32> StreamPositions;
+		static int32 SkippedCalls;
+		static int32 DivergentCalls;
+
+		static FCriticalSection TraceCriticalSection;
+
+		static bool bRecording;
+		static bool bReplaying;
+};
@@ -0,0 +1,449 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniApiStats.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniApiFunctions.h"
+#include "HoudiniApiHooks.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+#include <cstring>
+
+UE_TRACE_CHANNEL_DEFINE(HoudiniApiChannel)
+
+// Estimates the size of the data passed to/retrieved from a HAPI function, by looking at its arguments:
+// strings are counted by their length, and arrays by their element size multiplied
+// by the last int argument following them (HAPI array functions end with a start/length or count).
+struct FHoudiniApiPayloadEstimator
+{
+	int64 Bytes = 0;
+	int64 ElementSize = 0;
+	int64 ElementCount = 0;
+	int64 TupleSize = 1;
+
+	int64 GetPayloadBytes() const { return Bytes + ElementSize * ElementCount * TupleSize; }
+
+	void Visit() {}
+
+	template<typename TArg, typename... TRest>
+	void Visit(const TArg& InArg, const TRest&... InRest)
+	{
+		VisitArg(InArg);
+		Visit(InRest...);
+	}
+
+	// Non-array arguments
+	template<typename TArg>
+	void VisitArg(const TArg& InArg) {}
+
+	void VisitArg(const HAPI_Session* InSession) {}
+	void VisitArg(HAPI_Session* InSession) {}
+	void VisitArg(void* InPointer) {}
+
+	void VisitArg(const int& InValue)
+	{
+		if (ElementSize > 0)
+			ElementCount = FMath::Max(InValue, 0);
+	}
+
+	void VisitArg(const char* InString)
+	{
+		if (InString)
+			Bytes += (int64)strlen(InString);
+	}
+
+	void VisitArg(const HAPI_AttributeInfo* InAttributeInfo)
+	{
+		if (InAttributeInfo)
+			TupleSize = FMath::Max(InAttributeInfo->tupleSize, 1);
+	}
+
+	void VisitArg(HAPI_AttributeInfo* InAttributeInfo)
+	{
+		VisitArg((const HAPI_AttributeInfo*)InAttributeInfo);
+	}
+
+	// Arrays
+	template<typename TElement>
+	void VisitArg(TElement* const& InArray)
+	{
+		Bytes += ElementSize * ElementCount * TupleSize;
+		ElementSize = sizeof(TElement);
+		ElementCount = 0;
+	}
+};
+
+// Records the time spent in a HAPI function
+struct FHoudiniApiCallScope
+{
+	FHoudiniApiCallScope(const int32& InFunctionIndex, const int64& InPayloadBytes)
+		: FunctionIndex(InFunctionIndex)
+		, PayloadBytes(InPayloadBytes)
+		, bTraced(false)
+	{
+#if CPUPROFILERTRACE_ENABLED
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(HoudiniApiChannel))
+		{
+			FCpuProfilerTrace::OutputBeginDynamicEvent(FHoudiniApiStats::GetFunctionName(FunctionIndex));
+			bTraced = true;
+		}
+#endif
+		StartTime = FPlatformTime::Seconds();
+	}
+
+	~FHoudiniApiCallScope()
+	{
+		FHoudiniApiStats::RecordCall(FunctionIndex, FPlatformTime::Seconds() - StartTime, PayloadBytes);
+#if CPUPROFILERTRACE_ENABLED
+		if (bTraced)
+			FCpuProfilerTrace::OutputEndEvent();
+#endif
+	}
+
+	int32 FunctionIndex;
+	int64 PayloadBytes;
+	bool bTraced;
+	double StartTime;
+};
+
+// Wrapper installed on an FHoudiniApi function pointer, in the Stats layer of its THoudiniApiHook
+template<typename TFunctionPtr, TFunctionPtr* TApiFunction>
+struct THoudiniApiStatsWrapper;
+
+template<typename TReturn, typename... TArgs, TReturn(**TApiFunction)(TArgs...)>
+struct THoudiniApiStatsWrapper<TReturn(*)(TArgs...), TApiFunction>
+{
+	typedef THoudiniApiHook<TReturn(*)(TArgs...), TApiFunction> FHook;
+
+	static TReturn Call(TArgs... InArgs)
+	{
+		FHoudiniApiPayloadEstimator Estimator;
+		Estimator.Visit(InArgs...);
+
+		FHoudiniApiCallScope CallScope(FunctionIndex, Estimator.GetPayloadBytes());
+		return FHook::GetNext(EHoudiniApiHookLayer::Stats)(InArgs...);
+	}
+
+	static void Install(const int32& InFunctionIndex)
+	{
+		FunctionIndex = InFunctionIndex;
+		FHook::Install(EHoudiniApiHookLayer::Stats, &Call);
+	}
+
+	static void Uninstall()
+	{
+		FHook::Uninstall(EHoudiniApiHookLayer::Stats);
+	}
+
+	static int32 FunctionIndex;
+};
+
+template<typename TReturn, typename... TArgs, TReturn(**TApiFunction)(TArgs...)>
+int32 THoudiniApiStatsWrapper<TReturn(*)(TArgs...), TApiFunction>::FunctionIndex = INDEX_NONE;
+
+#define HOUDINI_API_STATS_WRAPPER(FunctionName) \
+	THoudiniApiStatsWrapper<FHoudiniApi::FunctionName##FuncPtr, &FHoudiniApi::FunctionName>
+
+TArray<const TCHAR*>
+FHoudiniApiStats::FunctionNames;
+
+TMap<FString, TArray<FHoudiniApiStats::FFunctionStats>>
+FHoudiniApiStats::ContextStats;
+
+FCriticalSection
+FHoudiniApiStats::StatsCriticalSection;
+
+bool
+FHoudiniApiStats::bEnabled = false;
+
+void
+FHoudiniApiStats::Start()
+{
+	// Already running, the other threads may be recording calls
+	if (bEnabled)
+		return;
+
+	if (!FHoudiniApi::IsHAPIInitialized())
+	{
+		HOUDINI_LOG_WARNING(TEXT("HAPI stats: HAPI is not initialized, the calls can't be instrumented."));
+		return;
+	}
+
+	// The function names never change, only fill them once
+	if (FunctionNames.Num() <= 0)
+	{
+#define HOUDINI_API_STATS_ADD_NAME(FunctionName) \
+		FunctionNames.Add(TEXT(#FunctionName));
+		HOUDINI_API_SESSION_FUNCTIONS(HOUDINI_API_STATS_ADD_NAME)
+#undef HOUDINI_API_STATS_ADD_NAME
+	}
+
+	int32 FunctionIndex = 0;
+#define HOUDINI_API_STATS_INSTALL(FunctionName) \
+	HOUDINI_API_STATS_WRAPPER(FunctionName)::Install(FunctionIndex++);
+	HOUDINI_API_SESSION_FUNCTIONS(HOUDINI_API_STATS_INSTALL)
+#undef HOUDINI_API_STATS_INSTALL
+
+	bEnabled = true;
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI stats: instrumenting %d functions."), FunctionNames.Num());
+}
+
+void
+FHoudiniApiStats::Stop()
+{
+	if (!bEnabled)
+		return;
+
+#define HOUDINI_API_STATS_UNINSTALL(FunctionName) \
+	HOUDINI_API_STATS_WRAPPER(FunctionName)::Uninstall();
+	HOUDINI_API_SESSION_FUNCTIONS(HOUDINI_API_STATS_UNINSTALL)
+#undef HOUDINI_API_STATS_UNINSTALL
+
+	bEnabled = false;
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI stats: instrumentation stopped."));
+}
+
+bool
+FHoudiniApiStats::IsEnabled()
+{
+	return bEnabled;
+}
+
+void
+FHoudiniApiStats::Reset()
+{
+	FScopeLock ScopeLock(&StatsCriticalSection);
+	ContextStats.Empty();
+}
+
+void
+FHoudiniApiStats::RecordCall(const int32& InFunctionIndex, const double& InTime, const int64& InPayloadBytes)
+{
+	if (!FunctionNames.IsValidIndex(InFunctionIndex))
+		return;
+
+	// Find the histogram bucket: <10us, <100us, <1ms, <10ms, <100ms, <1s, >=1s
+	int32 Bucket = 0;
+	double BucketLimit = 0.00001;
+	while (Bucket < NumTimeBuckets - 1 && InTime >= BucketLimit)
+	{
+		Bucket++;
+		BucketLimit *= 10.0;
+	}
+
+	FScopeLock ScopeLock(&StatsCriticalSection);
+	TArray<FFunctionStats>& FunctionStats = ContextStats.FindOrAdd(GetCurrentContext());
+	if (FunctionStats.Num() != FunctionNames.Num())
+		FunctionStats.SetNum(FunctionNames.Num());
+
+	FFunctionStats& Stats = FunctionStats[InFunctionIndex];
+	Stats.CallCount++;
+	Stats.TotalTime += InTime;
+	Stats.MaxTime = FMath::Max(Stats.MaxTime, InTime);
+	Stats.PayloadBytes += InPayloadBytes;
+	Stats.TimeHistogram[Bucket]++;
+}
+
+const TCHAR*
+FHoudiniApiStats::GetFunctionName(const int32& InFunctionIndex)
+{
+	return FunctionNames.IsValidIndex(InFunctionIndex) ? FunctionNames[InFunctionIndex] : TEXT("Unknown");
+}
+
+static FString&
+GetThreadApiStatsContext()
+{
+	static thread_local FString Context;
+	return Context;
+}
+
+const FString&
+FHoudiniApiStats::GetCurrentContext()
+{
+	return GetThreadApiStatsContext();
+}
+
+void
+FHoudiniApiStats::SetCurrentContext(const FString& InContext)
+{
+	GetThreadApiStatsContext() = InContext;
+}
+
+void
+FHoudiniApiStats::PrintStats(const int32& InMaxFunctions)
+{
+	FScopeLock ScopeLock(&StatsCriticalSection);
+
+	// Aggregate the stats of all the contexts
+	TArray<FFunctionStats> TotalStats;
+	TotalStats.SetNum(FunctionNames.Num());
+	for (auto& CurrentContext : ContextStats)
+	{
+		double ContextTime = 0.0;
+		int64 ContextCalls = 0;
+		int64 ContextBytes = 0;
+		for (int32 Idx = 0; Idx < CurrentContext.Value.Num() && Idx < TotalStats.Num(); Idx++)
+		{
+			const FFunctionStats& Stats = CurrentContext.Value[Idx];
+			FFunctionStats& Total = TotalStats[Idx];
+			Total.CallCount += Stats.CallCount;
+			Total.TotalTime += Stats.TotalTime;
+			Total.MaxTime = FMath::Max(Total.MaxTime, Stats.MaxTime);
+			Total.PayloadBytes += Stats.PayloadBytes;
+			for (int32 Bucket = 0; Bucket < NumTimeBuckets; Bucket++)
+				Total.TimeHistogram[Bucket] += Stats.TimeHistogram[Bucket];
+
+			ContextTime += Stats.TotalTime;
+			ContextCalls += Stats.CallCount;
+			ContextBytes += Stats.PayloadBytes;
+		}
+
+		HOUDINI_LOG_MESSAGE(TEXT("HAPI stats: [%s] %lld calls, %.3fs, %lld bytes"),
+			CurrentContext.Key.IsEmpty() ? TEXT("None") : *CurrentContext.Key, ContextCalls, ContextTime, ContextBytes);
+	}
+
+	// Sort the functions by total time
+	TArray<int32> SortedIndices;
+	for (int32 Idx = 0; Idx < TotalStats.Num(); Idx++)
+	{
+		if (TotalStats[Idx].CallCount > 0)
+			SortedIndices.Add(Idx);
+	}
+
+	SortedIndices.Sort([&TotalStats](const int32& A, const int32& B) { return TotalStats[A].TotalTime > TotalStats[B].TotalTime; });
+
+	for (int32 Idx = 0; Idx < SortedIndices.Num() && Idx < InMaxFunctions; Idx++)
+	{
+		const FFunctionStats& Stats = TotalStats[SortedIndices[Idx]];
+		HOUDINI_LOG_MESSAGE(TEXT("HAPI stats: %-40s %8lld calls, total %9.3fms, avg %8.3fms, max %8.3fms, %lld bytes"),
+			FunctionNames[SortedIndices[Idx]], Stats.CallCount,
+			Stats.TotalTime * 1000.0, Stats.TotalTime * 1000.0 / Stats.CallCount, Stats.MaxTime * 1000.0,
+			Stats.PayloadBytes);
+	}
+}
+
+bool
+FHoudiniApiStats::DumpStatsToCSV(const FString& InFilePath, FString& OutWrittenFilePath)
+{
+	OutWrittenFilePath = InFilePath;
+	if (OutWrittenFilePath.IsEmpty())
+	{
+		OutWrittenFilePath = FPaths::Combine(
+			FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"),
+			FString::Printf(TEXT("HoudiniApiStats-%s.csv"), *FDateTime::Now().ToString()));
+	}
+
+	FString CSV = TEXT("Context,Function,Calls,TotalMs,AvgMs,MaxMs,PayloadBytes,<10us,<100us,<1ms,<10ms,<100ms,<1s,>=1s\n");
+	{
+		FScopeLock ScopeLock(&StatsCriticalSection);
+		for (auto& CurrentContext : ContextStats)
+		{
+			for (int32 Idx = 0; Idx < CurrentContext.Value.Num() && Idx < FunctionNames.Num(); Idx++)
+			{
+				const FFunctionStats& Stats = CurrentContext.Value[Idx];
+				if (Stats.CallCount <= 0)
+					continue;
+
+				CSV += FString::Printf(TEXT("\"%s\",%s,%lld,%f,%f,%f,%lld"),
+					*CurrentContext.Key, FunctionNames[Idx], Stats.CallCount,
+					Stats.TotalTime * 1000.0, Stats.TotalTime * 1000.0 / Stats.CallCount, Stats.MaxTime * 1000.0,
+					Stats.PayloadBytes);
+
+				for (int32 Bucket = 0; Bucket < NumTimeBuckets; Bucket++)
+					CSV += FString::Printf(TEXT(",%lld"), Stats.TimeHistogram[Bucket]);
+
+				CSV += TEXT("\n");
+			}
+		}
+	}
+
+	return FFileHelper::SaveStringToFile(CSV, *OutWrittenFilePath);
+}
+
+FHoudiniApiStatsContextScope::FHoudiniApiStatsContextScope(const TCHAR* InPhase, const FString& InAssetName)
+	: bActive(FHoudiniApiStats::IsEnabled())
+{
+	if (!bActive)
+		return;
+
+	PreviousContext = FHoudiniApiStats::GetCurrentContext();
+	FHoudiniApiStats::SetCurrentContext(FString::Printf(TEXT("%s|%s"), InPhase, *InAssetName));
+}
+
+FHoudiniApiStatsContextScope::~FHoudiniApiStatsContextScope()
+{
+	if (bActive)
+		FHoudiniApiStats::SetCurrentContext(PreviousContext);
+}
+
+static void
+HoudiniApiStatsCommand(const TArray<FString>& Args)
+{
+	const FString Command = Args.Num() > 0 ? Args[0] : FString();
+	if (Command.Equals(TEXT("Start"), ESearchCase::IgnoreCase))
+	{
+		FHoudiniApiStats::Start();
+	}
+	else if (Command.Equals(TEXT("Stop"), ESearchCase::IgnoreCase))
+	{
+		FHoudiniApiStats::Stop();
+	}
+	else if (Command.Equals(TEXT("Reset"), ESearchCase::IgnoreCase))
+	{
+		FHoudiniApiStats::Reset();
+	}
+	else if (Command.Equals(TEXT("Dump"), ESearchCase::IgnoreCase))
+	{
+		FString WrittenFilePath;
+		if (FHoudiniApiStats::DumpStatsToCSV(Args.Num() > 1 ? Args[1] : FString(), WrittenFilePath))
+			HOUDINI_LOG_MESSAGE(TEXT("HAPI stats: written to %s"), *WrittenFilePath);
+		else
+			HOUDINI_LOG_WARNING(TEXT("HAPI stats: failed to write %s"), *WrittenFilePath);
+	}
+	else
+	{
+		FHoudiniApiStats::PrintStats(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 20);
+	}
+}
+
+static FAutoConsoleCommand CCmdHoudiniApiStats(
+	TEXT("Houdini.ApiStats"),
+	TEXT("HAPI call instrumentation.\n")
+	TEXT("Houdini.ApiStats Start: instruments the HAPI calls.\n")
+	TEXT("Houdini.ApiStats Stop: stops the instrumentation.\n")
+	TEXT("Houdini.ApiStats Reset: empties the recorded stats.\n")
+	TEXT("Houdini.ApiStats Dump [FilePath]: writes the recorded stats to a CSV file.\n")
+	TEXT("Houdini.ApiStats [Print] [Count]: prints the recorded stats to the log.\n"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&HoudiniApiStatsCommand));
@@ -0,0 +1,109 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Opt-in instrumentation of the HAPI calls.
+// When started, every FHoudiniApi function pointer that communicates with the session is replaced by a wrapper
+// recording call counts, wall time histograms and estimated payload bytes, per function and per context.
+// The context (phase + asset name) is set via FHoudiniApiStatsContextScope.
+// The calls are also exposed as events on the HoudiniApi Unreal Insights trace channel.
+//
+// Can be controlled with the Houdini.ApiStats console command, or started on load with -HoudiniApiStats.
+class HOUDINIENGINE_API FHoudiniApiStats
+{
+	public:
+
+		// Number of buckets in the call time histograms:
+		// <10us, <100us, <1ms, <10ms, <100ms, <1s, >=1s
+		static const int32 NumTimeBuckets = 7;
+
+		struct FFunctionStats
+		{
+			int64 CallCount = 0;
+			double TotalTime = 0.0;
+			double MaxTime = 0.0;
+			int64 PayloadBytes = 0;
+			int64 TimeHistogram[NumTimeBuckets] = { 0 };
+		};
+
+		// Installs the instrumentation wrappers on the FHoudiniApi function pointers.
+		static void Start();
+
+		// Restores the original FHoudiniApi function pointers.
+		static void Stop();
+
+		// Indicates if the instrumentation wrappers are installed.
+		static bool IsEnabled();
+
+		// Empties the recorded stats.
+		static void Reset();
+
+		// Prints a summary of the recorded stats to the log.
+		static void PrintStats(const int32& InMaxFunctions = 20);
+
+		// Writes all the recorded stats to a CSV file.
+		// If no path is given, the file is written to the project's Saved/HoudiniEngine folder.
+		static bool DumpStatsToCSV(const FString& InFilePath, FString& OutWrittenFilePath);
+
+		// Records a call to a HAPI function, used by the wrappers.
+		static void RecordCall(const int32& InFunctionIndex, const double& InTime, const int64& InPayloadBytes);
+
+		// Returns the name of the instrumented function at the given index.
+		static const TCHAR* GetFunctionName(const int32& InFunctionIndex);
+
+		// Current context on this thread.
+		static const FString& GetCurrentContext();
+		static void SetCurrentContext(const FString& InContext);
+
+	private:
+
+		// Function names, per function index.
+		static TArray<const TCHAR*> FunctionNames;
+
+		// Recorded stats, per context and per function index.
+		static TMap<FString, TArray<FFunctionStats>> ContextStats;
+
+		// Protects ContextStats, HAPI calls are made from multiple threads.
+		static FCriticalSection StatsCriticalSection;
+
+		static bool bEnabled;
+};
+
+// Sets the context of the HAPI calls made on this thread for the lifetime of this object.
+// Does nothing if the instrumentation isn't enabled.
+struct HOUDINIENGINE_API FHoudiniApiStatsContextScope
+{
+	FHoudiniApiStatsContextScope(const TCHAR* InPhase, const FString& InAssetName);
+	~FHoudiniApiStatsContextScope();
+
+	private:
+
+		bool bActive;
+		FString PreviousContext;
+};
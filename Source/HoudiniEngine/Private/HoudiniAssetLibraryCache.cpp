@@ -0,0 +1,157 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniAssetLibraryCache.h"
+
+#include "HoudiniAsset.h"
+#include "HoudiniEngine.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/ScopeLock.h"
+
+TMap<TPair<int32, FString>, FHoudiniAssetLibraryCache::FCachedAssetLibrary>
+FHoudiniAssetLibraryCache::CachedLibraries;
+
+FCriticalSection
+FHoudiniAssetLibraryCache::CacheCriticalSection;
+
+FString
+FHoudiniAssetLibraryCache::GetFileKey(const FString& InAssetFileName)
+{
+	// Expanded HDAs are directories, their content can't be identified cheaply
+	IFileManager& FileManager = IFileManager::Get();
+	const int64 FileSize = FileManager.FileSize(*InAssetFileName);
+	if (FileSize < 0)
+		return FString();
+
+	const FDateTime TimeStamp = FileManager.GetTimeStamp(*InAssetFileName);
+	return FString::Printf(TEXT("file|%s|%lld|%lld"), *InAssetFileName, FileSize, TimeStamp.GetTicks());
+}
+
+FString
+FHoudiniAssetLibraryCache::GetMemoryKey(const UHoudiniAsset* InHoudiniAsset)
+{
+	if (!InHoudiniAsset || InHoudiniAsset->GetAssetBytesCount() <= 0)
+		return FString();
+
+	return FString::Printf(TEXT("memory|%u|%016llx"), InHoudiniAsset->GetAssetBytesCount(), InHoudiniAsset->GetAssetBytesHash());
+}
+
+bool
+FHoudiniAssetLibraryCache::FindAssetLibrary(const FString& InKey, HAPI_AssetLibraryId& OutAssetLibraryId)
+{
+	if (InKey.IsEmpty())
+		return false;
+
+	FScopeLock ScopeLock(&CacheCriticalSection);
+	const FCachedAssetLibrary* CachedLibrary = CachedLibraries.Find(
+		TPair<int32, FString>(FHoudiniEngine::GetCurrentSessionIndex(), InKey));
+	if (!CachedLibrary)
+		return false;
+
+	OutAssetLibraryId = CachedLibrary->AssetLibraryId;
+	return true;
+}
+
+void
+FHoudiniAssetLibraryCache::AddAssetLibrary(
+	const FString& InKey, const UHoudiniAsset* InHoudiniAsset, const HAPI_AssetLibraryId& InAssetLibraryId)
+{
+	if (InKey.IsEmpty() || !InHoudiniAsset || InAssetLibraryId < 0)
+		return;
+
+	FScopeLock ScopeLock(&CacheCriticalSection);
+	const int32 SessionIndex = FHoudiniEngine::GetCurrentSessionIndex();
+	const FString AssetPath = InHoudiniAsset->GetPathName();
+
+	// The new library has overwritten the asset's previous definitions in this session
+	for (auto It = CachedLibraries.CreateIterator(); It; ++It)
+	{
+		if (It->Key.Key == SessionIndex && It->Value.AssetPath.Equals(AssetPath))
+			It.RemoveCurrent();
+	}
+
+	FCachedAssetLibrary& CachedLibrary = CachedLibraries.Add(TPair<int32, FString>(SessionIndex, InKey));
+	CachedLibrary.AssetPath = AssetPath;
+	CachedLibrary.AssetLibraryId = InAssetLibraryId;
+}
+
+bool
+FHoudiniAssetLibraryCache::FindAssetNames(const HAPI_AssetLibraryId& InAssetLibraryId, TArray<HAPI_StringHandle>& OutAssetNames)
+{
+	FScopeLock ScopeLock(&CacheCriticalSection);
+	const int32 SessionIndex = FHoudiniEngine::GetCurrentSessionIndex();
+	for (const auto& Pair : CachedLibraries)
+	{
+		if (Pair.Key.Key != SessionIndex || Pair.Value.AssetLibraryId != InAssetLibraryId)
+			continue;
+
+		if (!Pair.Value.bHasAssetNames)
+			return false;
+
+		OutAssetNames = Pair.Value.AssetNames;
+		return true;
+	}
+
+	return false;
+}
+
+void
+FHoudiniAssetLibraryCache::SetAssetNames(const HAPI_AssetLibraryId& InAssetLibraryId, const TArray<HAPI_StringHandle>& InAssetNames)
+{
+	FScopeLock ScopeLock(&CacheCriticalSection);
+	const int32 SessionIndex = FHoudiniEngine::GetCurrentSessionIndex();
+	for (auto& Pair : CachedLibraries)
+	{
+		if (Pair.Key.Key != SessionIndex || Pair.Value.AssetLibraryId != InAssetLibraryId)
+			continue;
+
+		Pair.Value.AssetNames = InAssetNames;
+		Pair.Value.bHasAssetNames = true;
+	}
+}
+
+void
+FHoudiniAssetLibraryCache::Invalidate(const UHoudiniAsset* InHoudiniAsset)
+{
+	if (!InHoudiniAsset)
+		return;
+
+	FScopeLock ScopeLock(&CacheCriticalSection);
+	const FString AssetPath = InHoudiniAsset->GetPathName();
+	for (auto It = CachedLibraries.CreateIterator(); It; ++It)
+	{
+		if (It->Value.AssetPath.Equals(AssetPath))
+			It.RemoveCurrent();
+	}
+}
+
+void
+FHoudiniAssetLibraryCache::Empty()
+{
+	FScopeLock ScopeLock(&CacheCriticalSection);
+	CachedLibraries.Empty();
+}
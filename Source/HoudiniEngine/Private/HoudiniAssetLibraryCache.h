@@ -0,0 +1,84 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "CoreMinimal.h"
+
+class UHoudiniAsset;
+
+// Caches the asset libraries loaded in the Houdini Engine sessions, so an HDA is only loaded once per session
+// instead of on every instantiation (see FHoudiniEngineUtils::LoadHoudiniAsset).
+//
+// Libraries are identified by their content: the path, size and timestamp of the HDA file when loading from file,
+// a hash of the HDA's raw data when loading from memory. Libraries are cached per session of the pool.
+// Loading a new version of an HDA overwrites the previous definitions in the session,
+// so the previously cached libraries for that asset are discarded.
+// The cache is emptied when the sessions are stopped, and should only be used on the game thread.
+class HOUDINIENGINE_API FHoudiniAssetLibraryCache
+{
+	public:
+
+		// Returns the key identifying the HDA file's content, an empty key if the file can't be cached.
+		static FString GetFileKey(const FString& InAssetFileName);
+
+		// Returns the key identifying the HDA's memory copy.
+		static FString GetMemoryKey(const UHoudiniAsset* InHoudiniAsset);
+
+		// Looks for a library already loaded in the current session.
+		static bool FindAssetLibrary(const FString& InKey, HAPI_AssetLibraryId& OutAssetLibraryId);
+
+		// Adds a library that has just been loaded in the current session.
+		static void AddAssetLibrary(const FString& InKey, const UHoudiniAsset* InHoudiniAsset, const HAPI_AssetLibraryId& InAssetLibraryId);
+
+		// Returns the cached asset names of a library loaded in the current session.
+		static bool FindAssetNames(const HAPI_AssetLibraryId& InAssetLibraryId, TArray<HAPI_StringHandle>& OutAssetNames);
+
+		// Sets the asset names of a library loaded in the current session.
+		static void SetAssetNames(const HAPI_AssetLibraryId& InAssetLibraryId, const TArray<HAPI_StringHandle>& InAssetNames);
+
+		// Discards the cached libraries of an asset (in all sessions), needed when the asset is reimported.
+		static void Invalidate(const UHoudiniAsset* InHoudiniAsset);
+
+		// Removes all the cached libraries, needs to be called when the sessions are stopped.
+		static void Empty();
+
+	private:
+
+		struct FCachedAssetLibrary
+		{
+			FString AssetPath;
+			HAPI_AssetLibraryId AssetLibraryId = -1;
+			bool bHasAssetNames = false;
+			TArray<HAPI_StringHandle> AssetNames;
+		};
+
+		// Cached libraries, per session index and key
+		static TMap<TPair<int32, FString>, FCachedAssetLibrary> CachedLibraries;
+
+		static FCriticalSection CacheCriticalSection;
+};
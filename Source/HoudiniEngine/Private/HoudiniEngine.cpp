@@ -28,7 +28,12 @@
 #include "HoudiniEnginePrivatePCH.h"
 
 #include "HoudiniApi.h"
+#include "HoudiniApiRecorder.h"
+#include "HoudiniApiStats.h"
+#include "HoudiniAssetLibraryCache.h"
+#include "HoudiniInputNodeCache.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEngineScheduler.h"
@@ -60,6 +65,9 @@ DEFINE_LOG_CATEGORY( LogHoudiniEngine );
 FHoudiniEngine *
 FHoudiniEngine::HoudiniEngineInstance = nullptr;
 
+// Index of the session used by the HAPI calls made on the current thread
+static thread_local int32 CurrentSessionIndex = 0;
+
 FHoudiniEngine::FHoudiniEngine()
 	: LicenseType(HAPI_LICENSE_NONE)
 	, HoudiniEngineSchedulerThread(nullptr)
@@ -127,6 +135,15 @@ FHoudiniEngine::StartupModule()
 		if ( HAPILibraryHandle )
 		{
 			FHoudiniApi::InitializeHAPI( HAPILibraryHandle );
+
+			// Instrument the HAPI calls if requested
+			if (FParse::Param(FCommandLine::Get(), TEXT("HoudiniApiStats")))
+				FHoudiniApiStats::Start();
+
+			// Record the HAPI calls if requested
+			FString ApiRecordFilePath;
+			if (FParse::Value(FCommandLine::Get(), TEXT("HoudiniApiRecord="), ApiRecordFilePath))
+				FHoudiniApiRecorder::StartRecording(ApiRecordFilePath);
 		}
 		else
 		{
@@ -306,6 +323,9 @@ FHoudiniEngine::ShutdownModule()
 		HoudiniEngineScheduler = nullptr;
 	}
 
+	// Same for the schedulers of the session pool
+	StopSessionPoolSchedulers();
+
 	// Do manager clean up.
 	if (HoudiniEngineManager)
 		HoudiniEngineManager->StopHoudiniTicking();
@@ -321,8 +341,12 @@ FHoudiniEngine::ShutdownModule()
 	{
 		FHoudiniApi::Cleanup(GetSession());
 		FHoudiniApi::CloseSession(GetSession());
+		StopSessionPool();
 	}
 
+	FHoudiniApiStats::Stop();
+	FHoudiniApiRecorder::StopRecording();
+	FHoudiniApiRecorder::StopReplay();
 	FHoudiniApi::FinalizeHAPI();
 
 	FHoudiniEngine::HoudiniEngineInstance = nullptr;
@@ -331,8 +355,14 @@ FHoudiniEngine::ShutdownModule()
 void
 FHoudiniEngine::AddTask(const FHoudiniEngineTask & InTask)
 {
-	if ( HoudiniEngineScheduler )
-		HoudiniEngineScheduler->AddTask(InTask);
+	// Tasks are processed by the scheduler of the session they are added for
+	const int32 SessionIndex = GetCurrentSessionIndex();
+	FHoudiniEngineScheduler* Scheduler = HoudiniEngineScheduler;
+	if (SessionIndex > 0)
+		Scheduler = PoolSchedulers.IsValidIndex(SessionIndex - 1) ? PoolSchedulers[SessionIndex - 1] : nullptr;
+
+	if ( Scheduler )
+		Scheduler->AddTask(InTask);
 
 	FScopeLock ScopeLock(&CriticalSection);
 	FHoudiniEngineTaskInfo TaskInfo;
@@ -342,6 +372,21 @@ FHoudiniEngine::AddTask(const FHoudiniEngineTask & InTask)
 	TaskInfos.Add(InTask.HapiGUID, TaskInfo);
 }
 
+bool
+FHoudiniEngine::InterruptTask(const FGuid& InHapiGUID)
+{
+	if (HoudiniEngineScheduler && HoudiniEngineScheduler->InterruptTask(InHapiGUID))
+		return true;
+
+	for (FHoudiniEngineScheduler* PoolScheduler : PoolSchedulers)
+	{
+		if (PoolScheduler && PoolScheduler->InterruptTask(InHapiGUID))
+			return true;
+	}
+
+	return false;
+}
+
 void
 FHoudiniEngine::AddTaskInfo(const FGuid& InHapiGUID, const FHoudiniEngineTaskInfo & InTaskInfo)
 {
@@ -391,9 +436,46 @@ FHoudiniEngine::GetLibHAPILocation() const
 const HAPI_Session *
 FHoudiniEngine::GetSession() const
 {
+	return GetSession(GetCurrentSessionIndex());
+}
+
+const HAPI_Session*
+FHoudiniEngine::GetSession(const int32& InSessionIndex) const
+{
+	if (InSessionIndex > 0)
+	{
+		FScopeLock ScopeLock(&PoolSessionsCriticalSection);
+
+		// The nodes of a pool session aren't valid in the other sessions, don't fall back to the main session
+		if (!PoolSessions.IsValidIndex(InSessionIndex - 1))
+			return nullptr;
+
+		const HAPI_Session& PoolSession = PoolSessions[InSessionIndex - 1];
+		return PoolSession.type == HAPI_SESSION_MAX ? nullptr : &PoolSession;
+	}
+
 	return Session.type == HAPI_SESSION_MAX ? nullptr : &Session;
 }
 
+int32
+FHoudiniEngine::GetSessionCount() const
+{
+	FScopeLock ScopeLock(&PoolSessionsCriticalSection);
+	return 1 + PoolSessions.Num();
+}
+
+int32
+FHoudiniEngine::GetCurrentSessionIndex()
+{
+	return CurrentSessionIndex;
+}
+
+void
+FHoudiniEngine::SetCurrentSessionIndex(const int32& InSessionIndex)
+{
+	CurrentSessionIndex = InSessionIndex;
+}
+
 HAPI_CookOptions
 FHoudiniEngine::GetDefaultCookOptions()
 {
@@ -426,6 +508,21 @@ FHoudiniEngine::StartSession(HAPI_Session*& SessionPtr,
 	const int32& ServerPort,
 	const FString& ServerHost)
 {
+	// The replay session serves the HAPI calls from a recorded trace, and doesn't need the HAPI library
+	if (SessionType == EHoudiniRuntimeSettingsSessionType::HRSST_Replay)
+	{
+		if (!FHoudiniApiRecorder::IsReplaying())
+		{
+			const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+			if (!FHoudiniApiRecorder::StartReplay(HoudiniRuntimeSettings->SessionReplayFilePath))
+				return false;
+		}
+	}
+	else if (FHoudiniApiRecorder::IsReplaying())
+	{
+		FHoudiniApiRecorder::StopReplay();
+	}
+
 	// HAPI needs to be initialized
 	if (!FHoudiniApi::IsHAPIInitialized())
 		return false;
@@ -516,6 +613,17 @@ FHoudiniEngine::StartSession(HAPI_Session*& SessionPtr,
 			break;
 		}
 
+		case EHoudiniRuntimeSettingsSessionType::HRSST_Replay:
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("Session type set to Replay, HAPI calls are served from the recorded trace."));
+			SessionPtr->type = HAPI_SESSION_CUSTOM1;
+			SessionPtr->id = 0;
+			SessionResult = HAPI_RESULT_SUCCESS;
+			// Disable session sync
+			bEnableSessionSync = false;
+			break;
+		}
+
 		// As of Unreal 4.19, InProcess sessions are not supported anymore
 		case EHoudiniRuntimeSettingsSessionType::HRSST_InProcess:			
 		default:
@@ -582,6 +690,7 @@ FHoudiniEngine::SessionSyncConnect(
 
 	case EHoudiniRuntimeSettingsSessionType::HRSST_None:
 	case EHoudiniRuntimeSettingsSessionType::HRSST_InProcess:
+	case EHoudiniRuntimeSettingsSessionType::HRSST_Replay:
 	default:
 		HOUDINI_LOG_ERROR(TEXT("Unsupported Houdini Engine Session Sync Type!!"));
 		bEnableSessionSync = false;
@@ -666,23 +775,7 @@ FHoudiniEngine::InitializeHAPISession()
 			TEXT("This could cause instabilities and crashes when using the Houdini Engine plugin"));
 	}
 
-	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-
-	// Default CookOptions
-	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-
-	bool bUseCookingThread = true;
-	HAPI_Result Result = FHoudiniApi::Initialize(
-		&Session,
-		&CookOptions,
-		bUseCookingThread,
-		HoudiniRuntimeSettings->CookingThreadStackSize,
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->HoudiniEnvironmentFiles),
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->OtlSearchPath),
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->DsoSearchPath),
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->ImageDsoSearchPath),
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->AudioDsoSearchPath));
-	
+	HAPI_Result Result = InitializeHAPI(&Session);
 	if (Result == HAPI_RESULT_SUCCESS)
 	{
 		HOUDINI_LOG_MESSAGE(TEXT("Successfully intialized the Houdini Engine module."));
@@ -701,9 +794,6 @@ FHoudiniEngine::InitializeHAPISession()
 		return false;
 	}
 
-	// Let HAPI know we are running inside UE4
-	FHoudiniApi::SetServerEnvString(&Session, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME);
-
 	if (bEnableSessionSync)
 	{
 		// Set the session sync infos if needed
@@ -718,6 +808,195 @@ FHoudiniEngine::InitializeHAPISession()
 	return true;
 }
 
+HAPI_Result
+FHoudiniEngine::InitializeHAPI(const HAPI_Session* InSessionPtr)
+{
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+	// Default CookOptions
+	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
+
+	bool bUseCookingThread = true;
+	HAPI_Result Result = FHoudiniApi::Initialize(
+		InSessionPtr,
+		&CookOptions,
+		bUseCookingThread,
+		HoudiniRuntimeSettings->CookingThreadStackSize,
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->HoudiniEnvironmentFiles),
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->OtlSearchPath),
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->DsoSearchPath),
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->ImageDsoSearchPath),
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->AudioDsoSearchPath));
+
+	if (Result == HAPI_RESULT_SUCCESS || Result == HAPI_RESULT_ALREADY_INITIALIZED)
+	{
+		// Let HAPI know we are running inside UE4
+		FHoudiniApi::SetServerEnvString(InSessionPtr, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME);
+	}
+
+	return Result;
+}
+
+void
+FHoudiniEngine::StartSessionPool(const EHoudiniRuntimeSettingsSessionType& SessionType)
+{
+	StopSessionPool();
+
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+	const int32 PoolSize = FMath::Clamp(HoudiniRuntimeSettings->SessionPoolSize, 1, HAPI_UNREAL_SESSION_POOL_MAX_SIZE);
+	if (PoolSize <= 1)
+		return;
+
+	// The pool relies on automatically started servers
+	if (SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_Socket
+		&& SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe)
+	{
+		HOUDINI_LOG_WARNING(TEXT("The session pool is only supported with socket or named pipe sessions, only the main session will be used."));
+		return;
+	}
+
+	if (bEnableSessionSync)
+	{
+		HOUDINI_LOG_WARNING(TEXT("The session pool is disabled when using Session Sync, only the main session will be used."));
+		return;
+	}
+
+	{
+		// GetSession() returns pointers to the pool sessions, make sure they're never reallocated
+		FScopeLock ScopeLock(&PoolSessionsCriticalSection);
+		PoolSessions.Reserve(HAPI_UNREAL_SESSION_POOL_MAX_SIZE);
+		PoolSessions.SetNum(PoolSize - 1);
+		for (HAPI_Session& PoolSession : PoolSessions)
+		{
+			PoolSession.type = HAPI_SESSION_MAX;
+			PoolSession.id = -1;
+		}
+	}
+
+	PoolSchedulers.SetNumZeroed(PoolSize - 1);
+	PoolSchedulerThreads.SetNumZeroed(PoolSize - 1);
+
+	int32 StartedCount = 1;
+	for (int32 SessionIndex = 1; SessionIndex < PoolSize; SessionIndex++)
+	{
+		// The session is started locally, as the schedulers of the sessions already started are reading PoolSessions
+		HAPI_Session PoolSession;
+		PoolSession.type = HAPI_SESSION_MAX;
+		PoolSession.id = -1;
+
+		// Each pool session uses its own server, StartSession will start it
+		HAPI_Session* PoolSessionPtr = &PoolSession;
+		const bool bMainSessionSync = bEnableSessionSync;
+		bool bSuccess = StartSession(
+			PoolSessionPtr,
+			true,
+			HoudiniRuntimeSettings->AutomaticServerTimeout,
+			SessionType,
+			FString::Printf(TEXT("%s_%d"), *HoudiniRuntimeSettings->ServerPipeName, SessionIndex),
+			HoudiniRuntimeSettings->ServerPort + SessionIndex,
+			HoudiniRuntimeSettings->ServerHost);
+		bEnableSessionSync = bMainSessionSync;
+
+		if (bSuccess)
+		{
+			HAPI_Result Result = InitializeHAPI(PoolSessionPtr);
+			bSuccess = (Result == HAPI_RESULT_SUCCESS || Result == HAPI_RESULT_ALREADY_INITIALIZED);
+		}
+
+		if (!bSuccess)
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to start session %d of the session pool."), SessionIndex);
+			continue;
+		}
+
+		{
+			FScopeLock ScopeLock(&PoolSessionsCriticalSection);
+			PoolSessions[SessionIndex - 1] = PoolSession;
+		}
+
+		// Each session has its own scheduler, so their cooks can overlap
+		FHoudiniEngineScheduler* PoolScheduler = new FHoudiniEngineScheduler(SessionIndex);
+		PoolSchedulers[SessionIndex - 1] = PoolScheduler;
+		PoolSchedulerThreads[SessionIndex - 1] = FRunnableThread::Create(
+			PoolScheduler, *FString::Printf(TEXT("HoudiniSchedulerThread%d"), SessionIndex), 0, TPri_Normal);
+
+		StartedCount++;
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("Started %d of %d Houdini Engine sessions."), StartedCount, PoolSize);
+}
+
+void
+FHoudiniEngine::StopSessionPool()
+{
+	// The scheduler threads must be done with their tasks before their sessions are closed
+	StopSessionPoolSchedulers();
+
+	TArray<HAPI_Session> SessionsToClose;
+	{
+		FScopeLock ScopeLock(&PoolSessionsCriticalSection);
+		SessionsToClose = PoolSessions;
+
+		// Keep the array allocated and invalidate its entries, pointers returned by GetSession() might still be held
+		for (HAPI_Session& PoolSession : PoolSessions)
+		{
+			PoolSession.type = HAPI_SESSION_MAX;
+			PoolSession.id = -1;
+		}
+		PoolSessions.SetNum(0, false);
+	}
+
+	for (HAPI_Session& PoolSession : SessionsToClose)
+	{
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(&PoolSession))
+		{
+			FHoudiniApi::Cleanup(&PoolSession);
+			FHoudiniApi::CloseSession(&PoolSession);
+		}
+	}
+
+	// The nodes still pending delete in these sessions are gone with them.
+	// Their ids must not be deleted in the sessions of a pool started later on.
+	if (FHoudiniEngineRuntime::IsInitialized())
+	{
+		for (int32 SessionIndex = 1; SessionIndex <= SessionsToClose.Num(); SessionIndex++)
+			FHoudiniEngineRuntime::Get().RemoveNodeIdsPendingDeleteInSession(SessionIndex);
+	}
+
+	// The libraries loaded and the input nodes created in the sessions are gone
+	FHoudiniAssetLibraryCache::Empty();
+	FHoudiniInputNodeCache::Empty();
+}
+
+void
+FHoudiniEngine::StopSessionPoolSchedulers()
+{
+	for (FHoudiniEngineScheduler* PoolScheduler : PoolSchedulers)
+	{
+		if (PoolScheduler)
+			PoolScheduler->Stop();
+	}
+
+	for (FRunnableThread* PoolSchedulerThread : PoolSchedulerThreads)
+	{
+		if (!PoolSchedulerThread)
+			continue;
+
+		PoolSchedulerThread->WaitForCompletion();
+		delete PoolSchedulerThread;
+	}
+	PoolSchedulerThreads.Empty();
+
+	for (FHoudiniEngineScheduler* PoolScheduler : PoolSchedulers)
+	{
+		if (!PoolScheduler)
+			continue;
+
+		PoolScheduler->AbortQueuedTasks();
+		delete PoolScheduler;
+	}
+	PoolSchedulers.Empty();
+}
 
 void
 FHoudiniEngine::OnSessionLost()
@@ -727,6 +1006,8 @@ FHoudiniEngine::OnSessionLost()
 	Session.type = HAPI_SESSION_MAX;
 	bEnableSessionSync = false;
 	HoudiniEngineManager->StopHoudiniTicking();
+	FHoudiniAssetLibraryCache::Empty();
+	FHoudiniInputNodeCache::Empty();
 
 	// This indicates that we likely have lost the session due to a crash in HARS/Houdini
 	FString Notification = TEXT("Houdini Engine Session lost!");
@@ -756,6 +1037,8 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 		FHoudiniApi::CloseSession(SessionPtr);
 	}
 
+	StopSessionPool();
+
 	Session.id = -1;
 	Session.type = HAPI_SESSION_MAX;
 	bEnableSessionSync = false;
@@ -804,6 +1087,7 @@ FHoudiniEngine::RestartSession()
 			}
 			else
 			{
+				StartSessionPool(HoudiniRuntimeSettings->SessionType);
 				bSuccess = true;
 			}
 		}
@@ -855,6 +1139,7 @@ FHoudiniEngine::CreateSession(const EHoudiniRuntimeSettingsSessionType& SessionT
 		}
 		else
 		{
+			StartSessionPool(SessionType);
 			bSuccess = true;
 		}
 	}
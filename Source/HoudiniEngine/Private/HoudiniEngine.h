@@ -63,7 +63,17 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		virtual const FString & GetLibHAPILocation() const;
 
 		// Session accessor
+		// Returns the session used by the calling thread (see FHoudiniEngineSessionScope)
 		virtual const HAPI_Session* GetSession() const;
+		// Returns a session of the pool, 0 being the main session
+		const HAPI_Session* GetSession(const int32& InSessionIndex) const;
+
+		// Number of sessions in the pool, including the main session
+		int32 GetSessionCount() const;
+
+		// Index of the session used by HAPI calls made on the calling thread
+		static int32 GetCurrentSessionIndex();
+		static void SetCurrentSessionIndex(const int32& InSessionIndex);
 
 		// Default cook options
 		static HAPI_CookOptions GetDefaultCookOptions();
@@ -105,6 +115,13 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Initialize HAPI
 		bool InitializeHAPISession();
 
+		// Starts the additional sessions of the pool, if enabled in the settings
+		void StartSessionPool(const EHoudiniRuntimeSettingsSessionType& SessionType);
+		// Stops the additional sessions of the pool
+		void StopSessionPool();
+		// Stops and joins the scheduler threads of the pool sessions
+		void StopSessionPoolSchedulers();
+
 		// Indicate to the plugin that the session is now invalid (HAPI has likely crashed...)
 		void OnSessionLost();
 
@@ -121,6 +138,8 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		// Register task for execution.
 		virtual void AddTask(const FHoudiniEngineTask & InTask);
+		// Supersede a pending or running cook task, the task will finish as Aborted.
+		virtual bool InterruptTask(const FGuid& InHapiGUID);
 		// Register task info.
 		virtual void AddTaskInfo(const FGuid& InHapiGUID, const FHoudiniEngineTaskInfo & InTaskInfo);
 		// Remove task info.
@@ -217,6 +236,9 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 	private:
 
+		// Initializes HAPI on the given session, with the cook options and paths from the settings
+		HAPI_Result InitializeHAPI(const HAPI_Session* InSessionPtr);
+
 		// Singleton instance of Houdini Engine.
 		static FHoudiniEngine * HoudiniEngineInstance;
 
@@ -240,6 +262,15 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Scheduler used to schedule HAPI instantiation and cook tasks. 
 		FHoudiniEngineScheduler * HoudiniEngineScheduler;
 
+		// Additional sessions of the pool, session index N uses PoolSessions[N - 1].
+		TArray<HAPI_Session> PoolSessions;
+		// Guards PoolSessions, which is read from the scheduler threads.
+		mutable FCriticalSection PoolSessionsCriticalSection;
+		// Schedulers and threads for the additional sessions (null for the sessions that failed to start),
+		// stopped with the pool.
+		TArray<FHoudiniEngineScheduler*> PoolSchedulers;
+		TArray<FRunnableThread*> PoolSchedulerThreads;
+
 		// Thread used to execute the manager.
 		FRunnableThread * HoudiniEngineManagerThread;
 		// Scheduler used to monitor and process Houdini Asset Components
@@ -305,4 +336,21 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		/** Used to delay notification updates for HAPI asynchronous work. **/
 		double HapiNotificationStarted;
 #endif
-};
\ No newline at end of file
+};
+
+// Routes the HAPI calls made on the current thread to a session of the pool for the lifetime of the scope.
+struct HOUDINIENGINE_API FHoudiniEngineSessionScope
+{
+	FHoudiniEngineSessionScope(const int32& InSessionIndex)
+		: PreviousSessionIndex(FHoudiniEngine::GetCurrentSessionIndex())
+	{
+		FHoudiniEngine::SetCurrentSessionIndex(InSessionIndex);
+	}
+
+	~FHoudiniEngineSessionScope()
+	{
+		FHoudiniEngine::SetCurrentSessionIndex(PreviousSessionIndex);
+	}
+
+	int32 PreviousSessionIndex;
+};
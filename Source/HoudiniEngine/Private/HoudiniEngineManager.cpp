@@ -31,7 +31,12 @@
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniAsset.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniInput.h"
+#include "HoudiniInputObject.h"
+#include "HoudiniOutput.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniInputNodeCache.h"
+#include "HoudiniApiStats.h"
 #include "HoudiniParameterTranslator.h"
 #include "HoudiniPDGManager.h"
 #include "HoudiniInputTranslator.h"
@@ -55,7 +60,7 @@
 
 FHoudiniEngineManager::FHoudiniEngineManager()
 	: CurrentIndex(0)
-	, ComponentCount(0)
+	, bWasCookingEnabled(true)
 	, bMustStopTicking(false)
 	, SyncedHoudiniViewportPivotPosition(FVector::ZeroVector)
 	, SyncedHoudiniViewportQuat(FQuat::Identity)
@@ -65,6 +70,8 @@ FHoudiniEngineManager::FHoudiniEngineManager()
 	, SyncedUnrealViewportLookatPosition(FVector::ZeroVector)
 	, ZeroOffsetValue(0.f)
 	, bOffsetZeroed(false)
+	, NumProxyMeshRefinementsQueued(0)
+	, NumProxyMeshRefinementsDone(0)
 {
 
 }
@@ -127,136 +134,100 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		return true;
 	}
 
-	// Process the current component if possible
-	while (true)
+	// Process as many components as our time budget allows
+	if (FHoudiniEngineRuntime::IsInitialized())
 	{
-		UHoudiniAssetComponent * CurrentComponent = nullptr;
-		if (FHoudiniEngineRuntime::IsInitialized())
-		{
-			FHoudiniEngineRuntime::Get().CleanUpRegisteredHoudiniComponents();
-
-			//FScopeLock ScopeLock(&CriticalSection);
-			ComponentCount = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
-
-			// No work to be done
-			if (ComponentCount <= 0)
-				break;
+		FHoudiniEngineRuntime::Get().CleanUpRegisteredHoudiniComponents();
 
-			// Wrap around if needed
-			if (CurrentIndex >= ComponentCount)
-				CurrentIndex = 0;
-
-			CurrentComponent = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(CurrentIndex);
-			CurrentIndex++;
-		}
-
-		if (!CurrentComponent || !CurrentComponent->IsValidLowLevelFast())
-		{
-			// Invalid component, do not process
-			break;
-		}
-		else if (CurrentComponent->IsPendingKill()
-			|| CurrentComponent->GetAssetState() == EHoudiniAssetState::Deleting)
+		// Pausing or resuming cooking changes how every component is processed
+		const bool bCookingEnabled = FHoudiniEngine::Get().IsCookingEnabled();
+		if (bCookingEnabled != bWasCookingEnabled)
 		{
-			// Component being deleted, do not process
-			break;
+			FHoudiniEngineRuntime::Get().MarkAllHoudiniComponentsForProcessing();
+			bWasCookingEnabled = bCookingEnabled;
 		}
 
-		if (!CurrentComponent->IsFullyLoaded())
+		// With session sync, any asset can be modified on the Houdini side:
+		// every component has to poll its cook count
+		if (FHoudiniEngine::Get().IsSessionSyncEnabled() && FHoudiniEngine::Get().IsSyncWithHoudiniCookEnabled())
+			FHoudiniEngineRuntime::Get().MarkAllHoudiniComponentsForProcessing();
+
+		// Only visit the components marked for processing since the last tick,
+		// and the ones that still had work to do. Idle components are skipped.
+		TSet<TWeakObjectPtr<UHoudiniAssetComponent>> MarkedComponents;
+		FHoudiniEngineRuntime::Get().ConsumeHoudiniComponentsMarkedForProcessing(MarkedComponents);
+		for (const TWeakObjectPtr<UHoudiniAssetComponent>& MarkedComponent : MarkedComponents)
+			ComponentsToProcess.AddUnique(MarkedComponent);
+
+		// A budget of 0 means we only process a single component per tick
+		double TimeBudget = 0.0;
+		const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+		if (HoudiniRuntimeSettings)
+			TimeBudget = FMath::Max(HoudiniRuntimeSettings->ComponentProcessingTimeBudget, 0.0f) / 1000.0;
+
+		const double StartTime = FPlatformTime::Seconds();
+		int32 ProcessedCount = 0;
+		auto HasTimeLeft = [&]()
 		{
-			// Let the component figure out whether it's fully loaded or not.
-			CurrentComponent->HoudiniEngineTick();
-			if (!CurrentComponent->IsFullyLoaded())
-				continue; // We need to wait some more.
-		}
+			if (ProcessedCount <= 0)
+				return true;
 
-		if (!CurrentComponent->IsValidComponent())
-		{
-			// This component is no longer valid. Prevent it from being processed, and remove it.
-			FHoudiniEngineRuntime::Get().UnRegisterHoudiniComponent(CurrentComponent);
-			continue;
-		}
+			if (TimeBudget <= 0.0)
+				return false;
 
-		// We don't want to the template component processing to trigger session creation
-		if (CurrentComponent->GetAssetState() == EHoudiniAssetState::ProcessTemplate)
+			return (FPlatformTime::Seconds() - StartTime) < TimeBudget;
+		};
+
+		// Components that have already been processed during this tick
+		TSet<UHoudiniAssetComponent*> ProcessedComponents;
+		bool bKeepProcessing = true;
+		auto ProcessComponentOnce = [&](const TWeakObjectPtr<UHoudiniAssetComponent>& CurrentPtr)
 		{
-			if (CurrentComponent->IsTemplate() && !CurrentComponent->HasOpenEditor())
+			UHoudiniAssetComponent* CurrentComponent = CurrentPtr.Get();
+			if (!CurrentComponent || !FHoudiniEngineRuntime::Get().IsComponentRegistered(CurrentComponent))
 			{
-				// This component template no longer has an open editor and can be deregistered.
-				// TODO: Replace this polling mechanism with an "On Asset Closed" event if we
-				// can find one that actually works.
-				FHoudiniEngineRuntime::Get().UnRegisterHoudiniComponent(CurrentComponent);
-				continue;
+				RemoveComponentToProcess(CurrentPtr);
+				return;
 			}
 
-			if (CurrentComponent->NeedBlueprintStructureUpdate())
-			{
-				CurrentComponent->OnBlueprintStructureModified();
-			}
+			bool bAlreadyProcessed = false;
+			ProcessedComponents.Add(CurrentComponent, &bAlreadyProcessed);
+			if (bAlreadyProcessed)
+				return;
 
-			if (CurrentComponent->NeedBlueprintUpdate())
-			{
-				CurrentComponent->OnBlueprintModified();
-			}
-
-			if (FHoudiniEngine::Get().IsCookingEnabled())
-			{
-				// Only process component template parameter updates when cooking is enabled.
-				if (CurrentComponent->NeedUpdateParameters() || CurrentComponent->NeedUpdateInputs())
-				{
-					CurrentComponent->OnTemplateParametersChanged();
-				}
-			}
+			ProcessedCount++;
+			bKeepProcessing = TickComponent(CurrentComponent);
+		};
 
-			if (CurrentComponent->NeedOutputUpdate())
-			{
-				// TODO: Transfer template output changes over to the preview instance.
-			}
+		// First, process the components that are in an active state (instantiating, cooking, processing...)
+		// so their progress is not delayed by the other ones.
+		// Processing a component can remove it from ComponentsToProcess, so we iterate on a copy.
+		const TArray<TWeakObjectPtr<UHoudiniAssetComponent>> CurrentComponents = ComponentsToProcess;
+		for (const TWeakObjectPtr<UHoudiniAssetComponent>& CurrentPtr : CurrentComponents)
+		{
+			if (!bKeepProcessing || !HasTimeLeft())
+				break;
 
-			break;
+			if (IsComponentActive(CurrentPtr.Get()))
+				ProcessComponentOnce(CurrentPtr);
 		}
 
-		// See if we should start the default "first" session
-		if(!FHoudiniEngine::Get().GetSession() && !FHoudiniEngine::Get().GetFirstSessionCreated())
+		// Then process the other ones with what's left of our budget, starting where
+		// we stopped on the previous tick so they all get processed eventually
+		const int32 NumComponents = ComponentsToProcess.Num();
+		for (int32 VisitedCount = 0; VisitedCount < NumComponents && ComponentsToProcess.Num() > 0; VisitedCount++)
 		{
-			// Only try to start the default session if we have an "active" HAC
-			if (CurrentComponent->GetAssetState() == EHoudiniAssetState::PreInstantiation
-				|| CurrentComponent->GetAssetState() == EHoudiniAssetState::Instantiating
-				|| CurrentComponent->GetAssetState() == EHoudiniAssetState::PreCook
-				|| CurrentComponent->GetAssetState() == EHoudiniAssetState::Cooking)
-			{
-				FString StatusText = TEXT("Initializing Houdini Engine...");
-				FHoudiniEngine::Get().CreateTaskSlateNotification(FText::FromString(StatusText), true, 4.0f);
-
-				// We want to yield for a bit.
-				//FPlatformProcess::Sleep(0.5f);
-
-				// Indicates that we've tried to start the session once no matter if it failed or succeed
-				FHoudiniEngine::Get().SetFirstSessionCreated(true);
+			if (!bKeepProcessing || !HasTimeLeft())
+				break;
 
-				// Attempt to restart the session
-				if (!FHoudiniEngine::Get().RestartSession())
-				{
-					// We failed to start the session
-					// Stop ticking until it's manually restarted
-					StopHoudiniTicking();
+			CurrentIndex = CurrentIndex % ComponentsToProcess.Num();
+			const TWeakObjectPtr<UHoudiniAssetComponent> CurrentPtr = ComponentsToProcess[CurrentIndex];
+			ProcessComponentOnce(CurrentPtr);
 
-					StatusText = TEXT("Houdini Engine failed to initialize.");
-				}
-				else
-				{
-					StatusText = TEXT("Houdini Engine successfully initialized.");
-				}
-
-				// Finish the notification and display the results
-				FHoudiniEngine::Get().FinishTaskSlateNotification(FText::FromString(StatusText));
-			}
+			// If the component has been removed, the next one has taken its place
+			if (ComponentsToProcess.IsValidIndex(CurrentIndex) && ComponentsToProcess[CurrentIndex] == CurrentPtr)
+				CurrentIndex++;
 		}
-
-		// Process the component
-		// try to catch (apache::thrift::transport::TTransportException * e) for session loss?
-		ProcessComponent(CurrentComponent);
-		break;
 	}
 
 	// Handle Asset delete
@@ -266,17 +237,27 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		for (int32 DeleteIdx = PendingDeleteCount - 1; DeleteIdx >= 0; DeleteIdx--)
 		{
 			HAPI_NodeId NodeIdToDelete = (HAPI_NodeId)FHoudiniEngineRuntime::Get().GetNodeIdsPendingDeleteAt(DeleteIdx);
+			const int32 SessionIndexToDelete = FHoudiniEngineRuntime::Get().GetNodeIdsPendingDeleteSessionIndexAt(DeleteIdx);
 			FGuid HapiDeletionGUID;
-			bool bShouldDeleteParent = FHoudiniEngineRuntime::Get().IsParentNodePendingDelete(NodeIdToDelete);
+			bool bShouldDeleteParent = FHoudiniEngineRuntime::Get().IsParentNodePendingDelete(NodeIdToDelete, SessionIndexToDelete);
+
+			// The node has to be deleted in the session it was created in
+			FHoudiniEngineSessionScope SessionScope(SessionIndexToDelete);
 			if (StartTaskAssetDelete(NodeIdToDelete, HapiDeletionGUID, bShouldDeleteParent))
 			{
 				FHoudiniEngineRuntime::Get().RemoveNodeIdPendingDeleteAt(DeleteIdx);
 				if (bShouldDeleteParent)
-					FHoudiniEngineRuntime::Get().RemoveParentNodePendingDelete(NodeIdToDelete);
+					FHoudiniEngineRuntime::Get().RemoveParentNodePendingDelete(NodeIdToDelete, SessionIndexToDelete);
+
+				// Forget the node in the input node cache, this releases the shared input node it was merging if any
+				FHoudiniInputNodeCache::RemoveNode(NodeIdToDelete);
 			}
 		}
 	}
 
+	// Refine the queued proxy meshes with our refinement budget
+	TickProxyMeshRefinementQueue();
+
 	// Update PDG Contexts and asset link if needed
 	PDGManager.Update();
 
@@ -312,6 +293,193 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 	return true;
 }
 
+bool
+FHoudiniEngineManager::TickComponent(UHoudiniAssetComponent* CurrentComponent)
+{
+	if (!CurrentComponent || !CurrentComponent->IsValidLowLevelFast())
+	{
+		// Invalid component, do not process
+		return true;
+	}
+	else if (CurrentComponent->IsPendingKill()
+		|| CurrentComponent->GetAssetState() == EHoudiniAssetState::Deleting)
+	{
+		// Component being deleted, do not process
+		RemoveComponentToProcess(CurrentComponent);
+		return true;
+	}
+
+	if (!CurrentComponent->IsFullyLoaded())
+	{
+		// Let the component figure out whether it's fully loaded or not.
+		CurrentComponent->HoudiniEngineTick();
+		if (!CurrentComponent->IsFullyLoaded())
+			return true; // We need to wait some more.
+	}
+
+	if (!CurrentComponent->IsValidComponent())
+	{
+		// This component is no longer valid. Prevent it from being processed, and remove it.
+		FHoudiniEngineRuntime::Get().UnRegisterHoudiniComponent(CurrentComponent);
+		RemoveComponentToProcess(CurrentComponent);
+		return true;
+	}
+
+	// We don't want to the template component processing to trigger session creation
+	if (CurrentComponent->GetAssetState() == EHoudiniAssetState::ProcessTemplate)
+	{
+		if (CurrentComponent->IsTemplate() && !CurrentComponent->HasOpenEditor())
+		{
+			// This component template no longer has an open editor and can be deregistered.
+			// TODO: Replace this polling mechanism with an "On Asset Closed" event if we
+			// can find one that actually works.
+			FHoudiniEngineRuntime::Get().UnRegisterHoudiniComponent(CurrentComponent);
+			RemoveComponentToProcess(CurrentComponent);
+			return true;
+		}
+
+		if (CurrentComponent->NeedBlueprintStructureUpdate())
+		{
+			CurrentComponent->OnBlueprintStructureModified();
+		}
+
+		if (CurrentComponent->NeedBlueprintUpdate())
+		{
+			CurrentComponent->OnBlueprintModified();
+		}
+
+		if (FHoudiniEngine::Get().IsCookingEnabled())
+		{
+			// Only process component template parameter updates when cooking is enabled.
+			if (CurrentComponent->NeedUpdateParameters() || CurrentComponent->NeedUpdateInputs())
+			{
+				CurrentComponent->OnTemplateParametersChanged();
+			}
+		}
+
+		if (CurrentComponent->NeedOutputUpdate())
+		{
+			// TODO: Transfer template output changes over to the preview instance.
+		}
+
+		return true;
+	}
+
+	// See if we should start the default "first" session
+	bool bKeepProcessing = true;
+	if(!FHoudiniEngine::Get().GetSession() && !FHoudiniEngine::Get().GetFirstSessionCreated())
+	{
+		// Only try to start the default session if we have an "active" HAC
+		if (CurrentComponent->GetAssetState() == EHoudiniAssetState::PreInstantiation
+			|| CurrentComponent->GetAssetState() == EHoudiniAssetState::Instantiating
+			|| CurrentComponent->GetAssetState() == EHoudiniAssetState::PreCook
+			|| CurrentComponent->GetAssetState() == EHoudiniAssetState::Cooking)
+		{
+			FString StatusText = TEXT("Initializing Houdini Engine...");
+			FHoudiniEngine::Get().CreateTaskSlateNotification(FText::FromString(StatusText), true, 4.0f);
+
+			// We want to yield for a bit.
+			//FPlatformProcess::Sleep(0.5f);
+
+			// Indicates that we've tried to start the session once no matter if it failed or succeed
+			FHoudiniEngine::Get().SetFirstSessionCreated(true);
+
+			// Attempt to restart the session
+			if (!FHoudiniEngine::Get().RestartSession())
+			{
+				// We failed to start the session
+				// Stop ticking until it's manually restarted
+				StopHoudiniTicking();
+				bKeepProcessing = false;
+
+				StatusText = TEXT("Houdini Engine failed to initialize.");
+			}
+			else
+			{
+				StatusText = TEXT("Houdini Engine successfully initialized.");
+			}
+
+			// Finish the notification and display the results
+			FHoudiniEngine::Get().FinishTaskSlateNotification(FText::FromString(StatusText));
+		}
+	}
+
+	// Process the component
+	// try to catch (apache::thrift::transport::TTransportException * e) for session loss?
+	ProcessComponent(CurrentComponent);
+
+	// Keep the components that still have work to do, the others won't be visited until they're marked again
+	if (NeedsProcessing(CurrentComponent))
+		ComponentsToProcess.AddUnique(CurrentComponent);
+	else
+		RemoveComponentToProcess(CurrentComponent);
+
+	return bKeepProcessing;
+}
+
+bool
+FHoudiniEngineManager::IsComponentActive(UHoudiniAssetComponent* HAC)
+{
+	if (!HAC || HAC->IsPendingKill())
+		return false;
+
+	switch (HAC->GetAssetState())
+	{
+		case EHoudiniAssetState::PreInstantiation:
+		case EHoudiniAssetState::Instantiating:
+		case EHoudiniAssetState::PreCook:
+		case EHoudiniAssetState::Cooking:
+		case EHoudiniAssetState::PostCook:
+		case EHoudiniAssetState::PreProcess:
+		case EHoudiniAssetState::Processing:
+		case EHoudiniAssetState::NeedRebuild:
+		case EHoudiniAssetState::NeedDelete:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+void
+FHoudiniEngineManager::RemoveComponentToProcess(const TWeakObjectPtr<UHoudiniAssetComponent>& InComponent)
+{
+	const int32 FoundIndex = ComponentsToProcess.Find(InComponent);
+	if (FoundIndex == INDEX_NONE)
+		return;
+
+	ComponentsToProcess.RemoveAt(FoundIndex);
+
+	// Components before the current one have shifted down
+	if (FoundIndex < CurrentIndex)
+		CurrentIndex--;
+}
+
+bool
+FHoudiniEngineManager::NeedsProcessing(UHoudiniAssetComponent* HAC)
+{
+	if (!HAC || HAC->IsPendingKill())
+		return false;
+
+	if (IsComponentActive(HAC))
+		return true;
+
+	if (!HAC->IsFullyLoaded() || HAC->GetAssetState() == EHoudiniAssetState::ProcessTemplate)
+		return true;
+
+	if (HAC->NeedUpdate() || HAC->NeedTransformUpdate() || HAC->NeedOutputUpdate())
+		return true;
+
+	// World inputs have to poll the actors they reference for changes
+	for (const UHoudiniInput* CurrentInput : HAC->Inputs)
+	{
+		if (IsValid(CurrentInput) && CurrentInput->GetInputType() == EHoudiniInputType::World)
+			return true;
+	}
+
+	return false;
+}
+
 void
 FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 {
@@ -324,6 +492,13 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 	if (!HAC->GetHoudiniAsset())
 		return;
 
+	// Attribute the HAPI calls made while processing this component to its current state
+	FHoudiniApiStatsContextScope ApiStatsScope(
+		FHoudiniApiStats::IsEnabled() ? *UEnum::GetValueAsString(HAC->GetAssetState()) : TEXT(""), HAC->GetName());
+
+	// Route the HAPI calls and the tasks to the HAC's session
+	FHoudiniEngineSessionScope SessionScope(HAC->GetSessionIndex());
+
 	// If cooking is paused, stay in the current state until cooking's resumed
 	if (!FHoudiniEngine::Get().IsCookingEnabled())
 	{
@@ -378,9 +553,14 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			if (HAC->NeedsToWaitForInputHoudiniAssets())
 				break;
 
+			// Pick the session the HDA will be instantiated in
+			HAC->SessionIndex = SelectSessionIndex(HAC);
+			FHoudiniEngine::SetCurrentSessionIndex(HAC->SessionIndex);
+
 			FGuid TaskGuid;
 			UHoudiniAsset* HoudiniAsset = HAC->GetHoudiniAsset();
-			if (StartTaskAssetInstantiation(HoudiniAsset, HAC->GetDisplayName(), TaskGuid))
+			EHoudiniEngineTaskPriority Priority = GetTaskPriority(HAC, EHoudiniEngineTaskType::AssetInstantiation);
+			if (StartTaskAssetInstantiation(HoudiniAsset, HAC->GetDisplayName(), Priority, TaskGuid))
 			{
 				// Update the HAC's state
 				HAC->AssetState = EHoudiniAssetState::Instantiating;
@@ -422,6 +602,16 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			if (HAC->NeedsToWaitForInputHoudiniAssets())
 				break;
 
+			// Nodes can only be connected within a session, if an input HDA lives in another session
+			// (the input was changed after instantiation), rebuild the HDA in the input's session
+			const int32 RequiredSessionIndex = GetRequiredSessionIndex(HAC);
+			if (RequiredSessionIndex != INDEX_NONE && RequiredSessionIndex != HAC->GetSessionIndex())
+			{
+				HOUDINI_LOG_MESSAGE(TEXT("%s: moving to session %d to be connected to its inputs."), *HAC->GetName(), RequiredSessionIndex);
+				HAC->AssetState = EHoudiniAssetState::NeedRebuild;
+				break;
+			}
+
 			HAC->OnPrePreCook();
 			// Update all the HAPI nodes, parameters, inputs etc...
 			PreCook(HAC);
@@ -432,7 +622,8 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			if (IsCookingEnabledForHoudiniAsset(HAC))
 			{
 				FGuid TaskGUID = HAC->GetHapiGUID();
-				if ( StartTaskAssetCooking(HAC->GetAssetId(), HAC->GetDisplayName(), TaskGUID) )
+				EHoudiniEngineTaskPriority Priority = GetTaskPriority(HAC, EHoudiniEngineTaskType::AssetCooking);
+				if ( StartTaskAssetCooking(HAC->GetAssetId(), HAC->GetDisplayName(), Priority, TaskGUID) )
 				{
 					// Updates the HAC's state
 					HAC->AssetState = EHoudiniAssetState::Cooking;
@@ -454,6 +645,11 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 		case EHoudiniAssetState::Cooking:
 		{
+			// If parameters have been modified since the cook started, its result is already stale.
+			// Interrupt it so we can go back to PreCook and cook the latest values instead.
+			if (HAC->NeedUpdateParameters())
+				FHoudiniEngine::Get().InterruptTask(HAC->GetHapiGUID());
+
 			EHoudiniAssetState NewState = EHoudiniAssetState::Cooking;
 			bool state = UpdateCooking(HAC, NewState);
 			if (state)
@@ -572,8 +768,97 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 
 
+EHoudiniEngineTaskPriority
+FHoudiniEngineManager::GetTaskPriority(UHoudiniAssetComponent* HAC, const EHoudiniEngineTaskType& TaskType) const
+{
+	// Components that have just been loaded are cooked in the background,
+	// so they don't delay the cooks triggered by the user
+	if (!HAC || HAC->HasBeenLoaded())
+		return EHoudiniEngineTaskPriority::Background;
+
+	// Cooks triggered by parameter/input changes should be processed asap
+	if (TaskType == EHoudiniEngineTaskType::AssetCooking)
+		return EHoudiniEngineTaskPriority::Interactive;
+
+	return EHoudiniEngineTaskPriority::Normal;
+}
+
+int32
+FHoudiniEngineManager::GetRequiredSessionIndex(UHoudiniAssetComponent* HAC)
+{
+	if (!HAC || HAC->IsPendingKill())
+		return INDEX_NONE;
+
+	// PDG contexts are only updated on the main session
+	if (HAC->GetPDGAssetLink())
+		return 0;
+
+	for (UHoudiniInput* CurrentInput : HAC->Inputs)
+	{
+		if (!CurrentInput || CurrentInput->IsPendingKill())
+			continue;
+
+		EHoudiniInputType CurrentInputType = CurrentInput->GetInputType();
+		if (CurrentInputType != EHoudiniInputType::Asset && CurrentInputType != EHoudiniInputType::World)
+			continue;
+
+		TArray<UHoudiniInputObject*>* ObjectArray = CurrentInput->GetHoudiniInputObjectArray(CurrentInputType);
+		if (!ObjectArray)
+			continue;
+
+		for (UHoudiniInputObject* CurrentInputObject : *ObjectArray)
+		{
+			UHoudiniAssetComponent* InputHAC = CurrentInputObject
+				? Cast<UHoudiniAssetComponent>(CurrentInputObject->GetObject())
+				: nullptr;
+
+			if (InputHAC && InputHAC != HAC && InputHAC->GetAssetId() >= 0)
+				return InputHAC->GetSessionIndex();
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+int32
+FHoudiniEngineManager::SelectSessionIndex(UHoudiniAssetComponent* HAC)
+{
+	FHoudiniEngine& HoudiniEngine = FHoudiniEngine::Get();
+	const int32 SessionCount = HoudiniEngine.GetSessionCount();
+	if (SessionCount <= 1)
+		return 0;
+
+	const int32 RequiredSessionIndex = GetRequiredSessionIndex(HAC);
+	if (RequiredSessionIndex != INDEX_NONE)
+		return RequiredSessionIndex;
+
+	// Count the instantiated HDAs in each session
+	TArray<int32> SessionLoads;
+	SessionLoads.SetNumZeroed(SessionCount);
+	const int32 ComponentCount = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
+	for (int32 Idx = 0; Idx < ComponentCount; Idx++)
+	{
+		UHoudiniAssetComponent* CurrentHAC = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(Idx);
+		if (!CurrentHAC || CurrentHAC == HAC || CurrentHAC->GetAssetId() < 0)
+			continue;
+
+		if (SessionLoads.IsValidIndex(CurrentHAC->GetSessionIndex()))
+			SessionLoads[CurrentHAC->GetSessionIndex()]++;
+	}
+
+	int32 SelectedIndex = 0;
+	for (int32 SessionIndex = 1; SessionIndex < SessionCount; SessionIndex++)
+	{
+		if (HoudiniEngine.GetSession(SessionIndex) && SessionLoads[SessionIndex] < SessionLoads[SelectedIndex])
+			SelectedIndex = SessionIndex;
+	}
+
+	return SelectedIndex;
+}
+
 bool 
-FHoudiniEngineManager::StartTaskAssetInstantiation(UHoudiniAsset* HoudiniAsset, const FString& DisplayName, FGuid& OutTaskGUID)
+FHoudiniEngineManager::StartTaskAssetInstantiation(
+	UHoudiniAsset* HoudiniAsset, const FString& DisplayName, const EHoudiniEngineTaskPriority& Priority, FGuid& OutTaskGUID)
 {
 	// Make sure we have a valid session before attempting anything
 	if (!FHoudiniEngine::Get().GetSession())
@@ -632,6 +917,7 @@ FHoudiniEngineManager::StartTaskAssetInstantiation(UHoudiniAsset* HoudiniAsset,
 	//Task.bLoadedComponent = bLocalLoadedComponent;
 	Task.AssetLibraryId = AssetLibraryId;
 	Task.AssetHapiName = PickedAssetName;
+	Task.Priority = Priority;
 
 	// Add the task to the stack
 	FHoudiniEngine::Get().AddTask(Task);
@@ -798,7 +1084,8 @@ FHoudiniEngineManager::UpdateInstantiating(UHoudiniAssetComponent* HAC, EHoudini
 }
 
 bool
-FHoudiniEngineManager::StartTaskAssetCooking(const HAPI_NodeId& AssetId, const FString& DisplayName, FGuid& OutTaskGUID)
+FHoudiniEngineManager::StartTaskAssetCooking(
+	const HAPI_NodeId& AssetId, const FString& DisplayName, const EHoudiniEngineTaskPriority& Priority, FGuid& OutTaskGUID)
 {
 	// Make sure we have a valid session before attempting anything
 	if (!FHoudiniEngine::Get().GetSession())
@@ -819,6 +1106,7 @@ FHoudiniEngineManager::StartTaskAssetCooking(const HAPI_NodeId& AssetId, const F
 	FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetCooking, OutTaskGUID);
 	Task.ActorName = DisplayName;
 	Task.AssetId = AssetId;
+	Task.Priority = Priority;
 	FHoudiniEngine::Get().AddTask(Task);
 
 	return true;
@@ -869,6 +1157,14 @@ FHoudiniEngineManager::UpdateCooking(UHoudiniAssetComponent* HAC, EHoudiniAssetS
 		break;
 
 		case EHoudiniEngineTaskState::Aborted:
+		{
+			// The cook has been superseded by newer changes, skip the outputs processing
+			// and go back to PreCook directly to upload the changes and cook again
+			HOUDINI_LOG_MESSAGE(TEXT("   %s Cook superseded - recooking with the latest changes."), *DisplayName);
+			NewState = EHoudiniAssetState::PreCook;
+			return true;
+		}
+
 		case EHoudiniEngineTaskState::FinishedWithFatalError:
 		{
 			HOUDINI_LOG_MESSAGE(TEXT("   %s FinishedCooking with fatal errors - aborting."), *DisplayName);
@@ -1258,20 +1554,192 @@ FHoudiniEngineManager::BuildStaticMeshesForAllHoudiniStaticMeshes(UHoudiniAssetC
 		return;
 	}
 
-#if WITH_EDITOR
-	AActor *Owner = HAC->GetOwner();
-	FString Name = Owner ? Owner->GetName() : HAC->GetName();
+	// Refine the meshes progressively instead of blocking the editor until they are all built
+	QueueProxyMeshRefinement(HAC);
+}
+
+void
+FHoudiniEngineManager::QueueProxyMeshRefinement(UHoudiniAssetComponent* HAC, bool bInDestroyProxies)
+{
+	if (!HAC || HAC->IsPendingKill())
+		return;
+
+	FHoudiniProxyMeshRefinementItem* FoundItem = ProxyMeshRefinementQueue.FindByPredicate(
+		[HAC](const FHoudiniProxyMeshRefinementItem& Item) { return Item.HAC.Get() == HAC; });
+	if (FoundItem)
+	{
+		// The HAC may have been cooked since it was queued, so check all of its outputs again
+		FoundItem->RefinedOutputs.Empty();
+		FoundItem->bDestroyProxies |= bInDestroyProxies;
+		return;
+	}
+
+	FHoudiniProxyMeshRefinementItem NewItem;
+	NewItem.HAC = HAC;
+	NewItem.bDestroyProxies = bInDestroyProxies;
+	ProxyMeshRefinementQueue.Add(NewItem);
+	NumProxyMeshRefinementsQueued++;
+}
+
+void
+FHoudiniEngineManager::DequeueProxyMeshRefinement(UHoudiniAssetComponent* HAC)
+{
+	const int32 NumRemoved = ProxyMeshRefinementQueue.RemoveAllSwap(
+		[HAC](const FHoudiniProxyMeshRefinementItem& Item) { return Item.HAC.Get() == HAC; });
+	NumProxyMeshRefinementsDone += NumRemoved;
+}
+
+bool
+FHoudiniEngineManager::IsProxyMeshRefinementQueued(const UHoudiniAssetComponent* HAC) const
+{
+	return ProxyMeshRefinementQueue.ContainsByPredicate(
+		[HAC](const FHoudiniProxyMeshRefinementItem& Item) { return Item.HAC.Get() == HAC; });
+}
+
+void
+FHoudiniEngineManager::TickProxyMeshRefinementQueue()
+{
+	if (ProxyMeshRefinementQueue.Num() <= 0)
+		return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineManager::TickProxyMeshRefinementQueue);
 
-	FScopedSlowTask Progress(2.0f, FText::FromString(FString::Printf(TEXT("Refining Proxy Mesh to Static Mesh on %s"), *Name)));
-	Progress.MakeDialog();
-	Progress.EnterProgressFrame(1.0f);
+	// A budget of 0 means we only refine a single output per tick
+	double TimeBudget = 0.0;
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (HoudiniRuntimeSettings)
+		TimeBudget = FMath::Max(HoudiniRuntimeSettings->ProxyMeshRefinementTimeBudget, 0.0f) / 1000.0;
+
+	// Prioritize with the active viewport's camera, if we have one
+	FVector ViewLocation = FVector::ZeroVector;
+	bool bHasViewLocation = false;
+#if WITH_EDITOR
+	if (GEditor && GEditor->GetActiveViewport())
+	{
+		FEditorViewportClient* ViewportClient = (FEditorViewportClient*)GEditor->GetActiveViewport()->GetClient();
+		if (ViewportClient)
+		{
+			ViewLocation = ViewportClient->GetViewLocation();
+			bHasViewLocation = true;
+		}
+	}
 #endif
 
-	FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(HAC);
+	const double StartTime = FPlatformTime::Seconds();
+	int32 RefinedCount = 0;
+	while (ProxyMeshRefinementQueue.Num() > 0)
+	{
+		if (RefinedCount > 0 && (TimeBudget <= 0.0 || (FPlatformTime::Seconds() - StartTime) >= TimeBudget))
+			break;
+
+		// Find the HAC with the highest priority, HACs that are being cooked are refined once they are done
+		int32 BestIndex = INDEX_NONE;
+		float BestPriority = 0.0f;
+		for (int32 Index = ProxyMeshRefinementQueue.Num() - 1; Index >= 0; Index--)
+		{
+			UHoudiniAssetComponent* HAC = ProxyMeshRefinementQueue[Index].HAC.Get();
+			if (!HAC || HAC->IsPendingKill())
+			{
+				ProxyMeshRefinementQueue.RemoveAtSwap(Index);
+				NumProxyMeshRefinementsDone++;
+				if (BestIndex == ProxyMeshRefinementQueue.Num())
+					BestIndex = Index;
+				continue;
+			}
+
+			if (IsComponentActive(HAC))
+				continue;
+
+			const float Priority = GetProxyMeshRefinementPriority(HAC, bHasViewLocation ? &ViewLocation : nullptr);
+			if (BestIndex == INDEX_NONE || Priority > BestPriority)
+			{
+				BestIndex = Index;
+				BestPriority = Priority;
+			}
+		}
+
+		if (BestIndex == INDEX_NONE)
+			break;
+
+		RefinedCount++;
+		if (!RefineNextProxyMeshOutput(ProxyMeshRefinementQueue[BestIndex]))
+		{
+			ProxyMeshRefinementQueue.RemoveAtSwap(BestIndex);
+			NumProxyMeshRefinementsDone++;
+		}
+	}
+
+	// Report progress
+	if (ProxyMeshRefinementQueue.Num() > 0)
+	{
+		const FText ProgressText = FText::FromString(FString::Printf(
+			TEXT("Refining proxy meshes (%d / %d)..."), NumProxyMeshRefinementsDone, NumProxyMeshRefinementsQueued));
+		FHoudiniEngine::Get().CreateTaskSlateNotification(ProgressText);
+		FHoudiniEngine::Get().UpdateTaskSlateNotification(ProgressText);
+	}
+	else
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("Refined the proxy meshes of %d Houdini Asset Component(s)."), NumProxyMeshRefinementsDone);
+		FHoudiniEngine::Get().FinishTaskSlateNotification(FText::FromString(TEXT("Finished refining proxy meshes")));
+		NumProxyMeshRefinementsQueued = 0;
+		NumProxyMeshRefinementsDone = 0;
+	}
+}
+
+bool
+FHoudiniEngineManager::RefineNextProxyMeshOutput(FHoudiniProxyMeshRefinementItem& InItem)
+{
+	UHoudiniAssetComponent* HAC = InItem.HAC.Get();
+	if (!HAC || HAC->IsPendingKill())
+		return false;
+
+	// The refinement can read the outputs' parts back, so use the HAC's session
+	FHoudiniEngineSessionScope SessionScope(HAC->GetSessionIndex());
+
+	const int32 NumOutputs = HAC->GetNumOutputs();
+	for (int32 OutputIndex = 0; OutputIndex < NumOutputs; OutputIndex++)
+	{
+		UHoudiniOutput* Output = HAC->GetOutputAt(OutputIndex);
+		if (!Output || Output->IsPendingKill() || InItem.RefinedOutputs.Contains(Output))
+			continue;
+
+		if (Output->GetType() != EHoudiniOutputType::Mesh || !Output->HasAnyCurrentProxy())
+			continue;
+
+		InItem.RefinedOutputs.Add(Output);
+		FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutput(HAC, Output, InItem.bDestroyProxies);
+		return true;
+	}
+
+	// All the outputs are refined, rebuild the instancers so they use the new static meshes
+	if (InItem.RefinedOutputs.Num() > 0)
+		FHoudiniOutputTranslator::UpdateInstancersAfterProxyMeshRefinement(HAC);
+
+	return false;
+}
+
+float
+FHoudiniEngineManager::GetProxyMeshRefinementPriority(const UHoudiniAssetComponent* HAC, const FVector* InViewLocation)
+{
+	if (!HAC)
+		return 0.0f;
+
+	// Approximate the screen size with the ratio of the bounds' radius to their distance to the camera
+	float Priority = 0.0f;
+	if (InViewLocation)
+	{
+		const FBoxSphereBounds& Bounds = HAC->Bounds;
+		const float Distance = FMath::Max3(FVector::Dist(*InViewLocation, Bounds.Origin), Bounds.SphereRadius, 1.0f);
+		Priority = Bounds.SphereRadius / Distance;
+	}
 
 #if WITH_EDITOR
-	Progress.EnterProgressFrame(1.0f);
+	const AActor* Owner = HAC->GetOwner();
+	if (Owner && Owner->IsSelected())
+		Priority += 1.0f;
 #endif
+
+	return Priority;
 }
 
 
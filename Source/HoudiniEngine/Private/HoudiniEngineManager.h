@@ -37,11 +37,14 @@
 
 class UHoudiniAsset;
 class UHoudiniAssetComponent;
+class UHoudiniOutput;
 
 struct FHoudiniEngineTaskInfo;
 struct FGuid;
 
 enum class EHoudiniAssetState : uint8;
+enum class EHoudiniEngineTaskPriority : uint8;
+enum class EHoudiniEngineTaskType : uint8;
 
 class FHoudiniEngineManager
 {
@@ -57,10 +60,33 @@ public:
 	// Updates / Process a component
 	void ProcessComponent(UHoudiniAssetComponent* HAC);
 
+	// Handles loading/validity/template checks for a registered component, then processes it.
+	// Returns false if we should stop processing components for this tick.
+	bool TickComponent(UHoudiniAssetComponent* HAC);
+
+	// Indicates if the component is in an active state (instantiating, cooking, processing...)
+	static bool IsComponentActive(UHoudiniAssetComponent* HAC);
+
+	// Indicates if the component has to be processed again on the next tick:
+	// it is in an active state, has pending updates or needs to poll its world inputs
+	static bool NeedsProcessing(UHoudiniAssetComponent* HAC);
+
 	// Build UStaticMesh for all UHoudiniStaticMesh in a HAC.
-	// This is fired by the OnRefinedMeshesTimerDelegate on a HAC
+	// This is fired by the OnRefinedMeshesTimerDelegate on a HAC, the HAC is added to the refinement queue.
 	void BuildStaticMeshesForAllHoudiniStaticMeshes(UHoudiniAssetComponent* HAC);
 
+	// Adds a HAC to the proxy mesh refinement queue.
+	// The proxy meshes of queued HACs are refined to UStaticMesh on the following ticks, one output at a time,
+	// within the ProxyMeshRefinementTimeBudget. Selected HACs and HACs that are larger on screen are refined first.
+	void QueueProxyMeshRefinement(UHoudiniAssetComponent* HAC, bool bInDestroyProxies=false);
+
+	// Removes a HAC from the refinement queue, its remaining proxies are left as is
+	void DequeueProxyMeshRefinement(UHoudiniAssetComponent* HAC);
+
+	bool IsProxyMeshRefinementQueued(const UHoudiniAssetComponent* HAC) const;
+
+	int32 GetNumQueuedProxyMeshRefinements() const { return ProxyMeshRefinementQueue.Num(); }
+
 	void StartPDGCommandlet()
 	{
 		if (!IsPDGCommandletRunningOrConnected())
@@ -84,13 +110,36 @@ public:
 	
 protected:
 
+	// A HAC waiting in the proxy mesh refinement queue
+	struct FHoudiniProxyMeshRefinementItem
+	{
+		TWeakObjectPtr<UHoudiniAssetComponent> HAC;
+
+		// Outputs of the HAC that have already been refined
+		TSet<TWeakObjectPtr<UHoudiniOutput>> RefinedOutputs;
+
+		bool bDestroyProxies = false;
+	};
+
+	// Refines the queued HACs' proxy meshes until the refinement time budget is exhausted
+	void TickProxyMeshRefinementQueue();
+
+	// Refines the next output of a queued HAC that still has current proxies.
+	// Returns false once all of the HAC's outputs have been refined.
+	bool RefineNextProxyMeshOutput(FHoudiniProxyMeshRefinementItem& InItem);
+
+	// Returns the refinement priority of a HAC: its approximate screen size (at most 1) seen from InViewLocation.
+	// Selected HACs get an additional 1 so that they are refined first.
+	static float GetProxyMeshRefinementPriority(const UHoudiniAssetComponent* HAC, const FVector* InViewLocation);
+
 	// Updates a given task's status
 	// Returns true if the given task's status was properly found
 	bool UpdateTaskStatus(FGuid& OutTaskGUID, FHoudiniEngineTaskInfo& OutTaskInfo);
 
 	// Start a task to instantiate the given HoudiniAsset
 	// Return true if the task was successfully created
-	bool StartTaskAssetInstantiation(UHoudiniAsset* HoudiniAsset, const FString& DisplayName, FGuid& OutTaskGUID);
+	bool StartTaskAssetInstantiation(
+		UHoudiniAsset* HoudiniAsset, const FString& DisplayName, const EHoudiniEngineTaskPriority& Priority, FGuid& OutTaskGUID);
 
 	// Updates progress of the instantiation task
 	// Returns true if a state change should be made
@@ -98,7 +147,19 @@ protected:
 
 	// Start a task to instantiate the Houdini Asset with the given node Id
 	// Returns true if the task was successfully created
-	bool StartTaskAssetCooking(const HAPI_NodeId& AssetId, const FString& DisplayName, FGuid& OutTaskGUID);
+	bool StartTaskAssetCooking(
+		const HAPI_NodeId& AssetId, const FString& DisplayName, const EHoudiniEngineTaskPriority& Priority, FGuid& OutTaskGUID);
+
+	// Returns the priority that should be used for the HAC's instantiation/cook tasks
+	// Loaded components are cooked in the background, user edits are interactive
+	EHoudiniEngineTaskPriority GetTaskPriority(UHoudiniAssetComponent* HAC, const EHoudiniEngineTaskType& TaskType) const;
+
+	// Returns the session the HAC has to use to be connected to its input HDAs, INDEX_NONE if any session can be used
+	static int32 GetRequiredSessionIndex(UHoudiniAssetComponent* HAC);
+
+	// Picks the session of the pool the HAC should be instantiated in
+	// HACs connected by inputs share a session, others go to the least loaded one
+	static int32 SelectSessionIndex(UHoudiniAssetComponent* HAC);
 
 	// Updates progress of the cooking task
 	// Returns true if a state change should be made
@@ -145,11 +206,19 @@ private:
 	// Ticker handle, used for processing HAC.
 	FDelegateHandle TickerHandle;
 
-	// Current position in the array
-	uint32 CurrentIndex;
+	// Removes a component from ComponentsToProcess, keeping CurrentIndex on the same next component
+	void RemoveComponentToProcess(const TWeakObjectPtr<UHoudiniAssetComponent>& InComponent);
+
+	// Position of the next component to process in ComponentsToProcess
+	int32 CurrentIndex;
+
+	// Components that have to be processed: marked for processing, in an active state or with pending updates.
+	// Idle components are not in this array and aren't visited.
+	// New components are appended, so the round robin order stays stable from one tick to the next.
+	TArray<TWeakObjectPtr<UHoudiniAssetComponent>> ComponentsToProcess;
 
-	// Current number of components in the array
-	uint32 ComponentCount;
+	// Cooking state on the previous tick, all components are processed when it changes
+	bool bWasCookingEnabled;
 
 	// Stopping flag. 
 	// Indicates that we should stop ticking asap
@@ -176,4 +245,11 @@ private:
 
 	// Indicates which HACs disable auto-saving
 	TSet<const UHoudiniAssetComponent*> DisableAutoSavingHACs;
+
+	// HACs waiting to have their proxy meshes refined
+	TArray<FHoudiniProxyMeshRefinementItem> ProxyMeshRefinementQueue;
+
+	// Number of HACs added to / removed from the refinement queue since it was last empty, used to report progress
+	int32 NumProxyMeshRefinementsQueued;
+	int32 NumProxyMeshRefinementsDone;
 };
\ No newline at end of file
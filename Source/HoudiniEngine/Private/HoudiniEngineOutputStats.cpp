@@ -57,4 +57,16 @@ void FHoudiniEngineOutputStats::NotifyObjectsReplaced(const FString& ObjectTypeN
 {
 	const int32 Count = OutputObjectsReplaced.FindOrAdd(ObjectTypeName, 0);
 	OutputObjectsReplaced[ObjectTypeName] = Count + NumReplaced;
+}
+
+void FHoudiniEngineOutputStats::NotifyObjectsSkipped(const FString& ObjectTypeName, int32 NumSkipped)
+{
+	const int32 Count = OutputObjectsSkipped.FindOrAdd(ObjectTypeName, 0);
+	OutputObjectsSkipped[ObjectTypeName] = Count + NumSkipped;
+}
+
+int32 FHoudiniEngineOutputStats::GetNumObjectsSkipped(const FString& ObjectTypeName) const
+{
+	const int32* Count = OutputObjectsSkipped.Find(ObjectTypeName);
+	return Count ? *Count : 0;
 }
\ No newline at end of file
@@ -41,6 +41,7 @@ struct HOUDINIENGINE_API FHoudiniEngineOutputStats
 	TMap<FString, int32> OutputObjectsCreated;
 	TMap<FString, int32> OutputObjectsUpdated;
 	TMap<FString, int32> OutputObjectsReplaced;
+	TMap<FString, int32> OutputObjectsSkipped;
 
 	void NotifyPackageCreated(int32 NumCreated);
 	void NotifyPackageUpdated(int32 NumUpdated);
@@ -68,4 +69,19 @@ struct HOUDINIENGINE_API FHoudiniEngineOutputStats
 	{
 		NotifyObjectsReplaced( UEnum::GetValueAsString(EnumValue), NumReplaced );
 	}
+
+	// Objects that were left untouched since they haven't changed
+	void NotifyObjectsSkipped(const FString& ObjectTypeName, int32 NumSkipped);
+	template<typename EnumT>
+	void NotifyObjectsSkipped(EnumT EnumValue, int32 NumSkipped)
+	{
+		NotifyObjectsSkipped( UEnum::GetValueAsString(EnumValue), NumSkipped );
+	}
+
+	int32 GetNumObjectsSkipped(const FString& ObjectTypeName) const;
+	template<typename EnumT>
+	int32 GetNumObjectsSkipped(EnumT EnumValue) const
+	{
+		return GetNumObjectsSkipped( UEnum::GetValueAsString(EnumValue) );
+	}
 };
@@ -157,6 +157,8 @@
 #define HAPI_UNREAL_ATTRIB_MATERIAL_INSTANCE				"unreal_material_instance"
 #define HAPI_UNREAL_ATTRIB_MATERIAL_HOLE					"unreal_material_hole"
 #define HAPI_UNREAL_ATTRIB_MATERIAL_HOLE_INSTANCE			"unreal_material_hole_instance"
+#define HAPI_UNREAL_ATTRIB_MATERIAL_TABLE					"unreal_material_table"
+#define HAPI_UNREAL_ATTRIB_MATERIAL_INDEX					"unreal_material_index"
 #define HAPI_UNREAL_ATTRIB_PHYSICAL_MATERIAL				"unreal_physical_material"
 #define HAPI_UNREAL_ATTRIB_FACE_SMOOTHING_MASK				"unreal_face_smoothing_mask"
 #define HAPI_UNREAL_ATTRIB_LIGHTMAP_RESOLUTION				"unreal_lightmap_resolution"
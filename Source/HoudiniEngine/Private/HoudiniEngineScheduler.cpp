@@ -30,41 +30,43 @@
 #include "HoudiniEngineString.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngine.h"
+#include "HoudiniApiStats.h"
 
-const uint32
-FHoudiniEngineScheduler::InitialTaskSize = 256u;
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
 
 const float
-FHoudiniEngineScheduler::UpdateFrequency = 0.1f;
+FHoudiniEngineScheduler::MinPollInterval = 0.001f;
 
-FHoudiniEngineScheduler::FHoudiniEngineScheduler()
-	: Tasks(nullptr)
-	, PositionWrite(0u)
-	, PositionRead(0u)
-	, bStopping(false)
-{
-	//  Make sure size is power of two.
-	TaskCount = FPlatformMath::RoundUpToPowerOfTwo(FHoudiniEngineScheduler::InitialTaskSize);
+const float
+FHoudiniEngineScheduler::MaxPollInterval = 0.1f;
 
-	if (TaskCount)
-	{
-		// Allocate buffer to store all tasks.
-		Tasks = static_cast<FHoudiniEngineTask *>(FMemory::Malloc(TaskCount * sizeof(FHoudiniEngineTask)));
+const double
+FHoudiniEngineScheduler::NotificationUpdateFrequency = 0.5;
 
-		if (Tasks)
-		{
-			// Zero memory.
-			FMemory::Memset(Tasks, 0x0, TaskCount * sizeof(FHoudiniEngineTask));
-		}
-	}
+FHoudiniEngineScheduler::FTaskLatencyStats
+FHoudiniEngineScheduler::InstantiationLatencyStats[(uint8)EHoudiniEngineTaskPriority::Max];
+
+FHoudiniEngineScheduler::FTaskLatencyStats
+FHoudiniEngineScheduler::CookLatencyStats[(uint8)EHoudiniEngineTaskPriority::Max];
+
+FCriticalSection
+FHoudiniEngineScheduler::LatencyStatsCriticalSection;
+
+FHoudiniEngineScheduler::FHoudiniEngineScheduler(const int32& InSessionIndex)
+	: WakeUpEvent(nullptr)
+	, SessionIndex(InSessionIndex)
+	, bStopping(false)
+{
+	WakeUpEvent = FPlatformProcess::GetSynchEventFromPool(false);
 }
 
 FHoudiniEngineScheduler::~FHoudiniEngineScheduler()
 {
-	if (TaskCount)
+	if (WakeUpEvent)
 	{
-		FMemory::Free(Tasks);
-		Tasks = nullptr;
+		FPlatformProcess::ReturnSynchEventToPool(WakeUpEvent);
+		WakeUpEvent = nullptr;
 	}
 }
 
@@ -94,6 +96,9 @@ FHoudiniEngineScheduler::TaskDescription(
 void
 FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 {
+	const double StartTime = FPlatformTime::Seconds();
+	FHoudiniApiStatsContextScope ApiStatsScope(TEXT("Instantiate"), Task.ActorName);
+
 	FString AssetN;
 	FHoudiniEngineString(Task.AssetHapiName).ToFString(AssetN);
 
@@ -145,7 +150,6 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 	int32 AssetCount = 0;
 	HAPI_NodeId AssetId = -1;
 	std::string AssetNameString;
-	double LastUpdateTime;
 
 	FHoudiniEngineString HoudiniEngineString(Task.AssetHapiName);
 	if (!HoudiniEngineString.ToStdString(AssetNameString))
@@ -162,9 +166,6 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 	// Translate asset name into Unreal string.
 	FString AssetName = ANSI_TO_TCHAR(AssetNameString.c_str());
 
-	// Initialize last update time.
-	LastUpdateTime = FPlatformTime::Seconds();
-
 	// We instantiate without cooking.
 	Result = FHoudiniApi::CreateNode(
 		FHoudiniEngine::Get().GetSession(), -1, &AssetNameString[0], nullptr, false, &AssetId);
@@ -189,67 +190,66 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 	TaskDescription(TaskInfo, Task.ActorName, TEXT("Started Instantiation"));
 	FHoudiniEngine::Get().AddTaskInfo(Task.HapiGUID, TaskInfo);
 
-	// We need to spin until instantiation is finished.
-	while (true)
+	// Wait until instantiation is finished.
+	int32 Status = WaitForCookCompletion(EHoudiniEngineTaskType::AssetInstantiation, AssetId, Task);
+	if (Status == HAPI_STATE_READY)
 	{
-		int Status = HAPI_STATE_STARTING_COOK;
-		HOUDINI_CHECK_ERROR_GET(&Result, FHoudiniApi::GetStatus(
-			FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status));
+		// Cooking has been successful.
+		AddResponseMessageTaskInfo(
+			HAPI_RESULT_SUCCESS, 
+			EHoudiniEngineTaskType::AssetInstantiation,
+			EHoudiniEngineTaskState::Success, AssetId, Task,
+			TEXT("Finished Instantiation."));
+	}
+	else
+	{
+		// There was an error while instantiating.
+		FString CookResultString = FHoudiniEngineUtils::GetCookResult();
+		int32 CookResult = static_cast<int32>(HAPI_RESULT_SUCCESS);
+		FHoudiniApi::GetStatus(FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_RESULT, &CookResult);
 
-		if (Status == HAPI_STATE_READY)
-		{
-			// Cooking has been successful.
-			AddResponseMessageTaskInfo(
-				HAPI_RESULT_SUCCESS, 
-				EHoudiniEngineTaskType::AssetInstantiation,
-				EHoudiniEngineTaskState::Success, AssetId, Task,
-				TEXT("Finished Instantiation."));
+		EHoudiniEngineTaskState TaskStateResult = EHoudiniEngineTaskState::FinishedWithFatalError;
+		if (Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
+			TaskStateResult = EHoudiniEngineTaskState::FinishedWithError;
 
-			break;
-		}
-		else if (Status == HAPI_STATE_READY_WITH_FATAL_ERRORS || Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
-		{
-			// There was an error while instantiating.
-			FString CookResultString = FHoudiniEngineUtils::GetCookResult();
-			int32 CookResult = static_cast<int32>(HAPI_RESULT_SUCCESS);
-			FHoudiniApi::GetStatus(FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_RESULT, &CookResult);
+		AddResponseMessageTaskInfo(
+			static_cast<HAPI_Result>(CookResult), 
+			EHoudiniEngineTaskType::AssetInstantiation,	
+			TaskStateResult,
+			AssetId, Task,
+			FString::Printf(TEXT("Finished Instantiation with Errors: %s"), *CookResultString));
+	}
 
-			EHoudiniEngineTaskState TaskStateResult = EHoudiniEngineTaskState::FinishedWithFatalError;
-			if (Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
-				TaskStateResult = EHoudiniEngineTaskState::FinishedWithError;
+	const double FinishTime = FPlatformTime::Seconds();
+	RecordTaskLatency(Task, StartTime, FinishTime);
 
-			AddResponseMessageTaskInfo(
-				static_cast<HAPI_Result>(CookResult), 
-				EHoudiniEngineTaskType::AssetInstantiation,	
-				TaskStateResult,
-				AssetId, Task,
-				FString::Printf(TEXT("Finished Instantiation with Errors: %s"), *CookResultString));
+	HOUDINI_LOG_MESSAGE(
+		TEXT("HAPI Asynchronous Instantiation Finished for %s in %.3fs (since queued)."),
+		*Task.ActorName, FinishTime - Task.QueuedTime);
+}
 
-			break;
-		}
+void
+FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	FHoudiniApiStatsContextScope ApiStatsScope(TEXT("Cook"), Task.ActorName);
 
-		static const double NotificationUpdateFrequency = 0.5;
-		if ((FPlatformTime::Seconds() - LastUpdateTime) >= NotificationUpdateFrequency)
-		{
-			// Reset update time.
-			LastUpdateTime = FPlatformTime::Seconds();
-			const FString& CookStateMessage = FHoudiniEngineUtils::GetCookState();
+	// Make sure this cook hasn't been superseded by a newer one while it was queued.
+	if (!StartCookTask(Task))
+	{
+		HOUDINI_LOG_MESSAGE(
+			TEXT("HAPI Asynchronous Cooking skipped for %s, AssetId = %d: superseded by a newer cook."),
+			*Task.ActorName, Task.AssetId);
 
-			AddResponseMessageTaskInfo(
-				HAPI_RESULT_SUCCESS,
-				EHoudiniEngineTaskType::AssetInstantiation,
-				EHoudiniEngineTaskState::Working,
-				AssetId, Task, CookStateMessage);
-		}
+		AddResponseMessageTaskInfo(
+			HAPI_RESULT_SUCCESS,
+			EHoudiniEngineTaskType::AssetCooking,
+			EHoudiniEngineTaskState::Aborted,
+			Task.AssetId, Task, TEXT("Cook superseded"));
 
-		// We want to yield.
-		FPlatformProcess::SleepNoStats(UpdateFrequency);
+		return;
 	}
-}
 
-void
-FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
-{
 	if (!FHoudiniEngineUtils::IsInitialized())
 	{
 		HOUDINI_LOG_ERROR(
@@ -257,6 +257,7 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 			*Task.ActorName,
 			*FHoudiniEngineUtils::GetErrorDescription(HAPI_RESULT_NOT_INITIALIZED));
 
+		FinishCookTask(Task);
 		AddResponseMessageTaskInfo(
 			HAPI_RESULT_NOT_INITIALIZED, 
 			EHoudiniEngineTaskType::AssetCooking,
@@ -279,6 +280,7 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		// We have an invalid asset id.
 		HOUDINI_LOG_ERROR(TEXT("TaskCookAsset failed for %s: Invalid Asset Id."), *Task.ActorName);
 
+		FinishCookTask(Task);
 		AddResponseMessageTaskInfo(
 			HAPI_RESULT_FAILURE, 
 			EHoudiniEngineTaskType::AssetCooking,
@@ -293,6 +295,7 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 	Result = FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), AssetId, &CookOptions);
 	if (Result != HAPI_RESULT_SUCCESS)
 	{
+		FinishCookTask(Task);
 		AddResponseMessageTaskInfo(
 			Result, EHoudiniEngineTaskType::AssetCooking,
 			EHoudiniEngineTaskState::FinishedWithFatalError,
@@ -308,46 +311,80 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		EHoudiniEngineTaskState::Working, 
 		AssetId, Task, TEXT("Started Cooking"));
 
-	// Initialize last update time.
+	// Wait until cooking is finished.
+	int32 Status = WaitForCookCompletion(EHoudiniEngineTaskType::AssetCooking, AssetId, Task);
+	const double FinishTime = FPlatformTime::Seconds();
+	const bool bSuperseded = FinishCookTask(Task);
+	if (bSuperseded)
+	{
+		// The cook was interrupted as a newer cook has been requested.
+		AddResponseMessageTaskInfo(
+			HAPI_RESULT_SUCCESS,
+			EHoudiniEngineTaskType::AssetCooking,
+			EHoudiniEngineTaskState::Aborted,
+			AssetId, Task, TEXT("Cook superseded"));
+	}
+	else if (Status == HAPI_STATE_READY)
+	{
+		// Cooking has been successful.
+		AddResponseMessageTaskInfo(
+			HAPI_RESULT_SUCCESS, 
+			EHoudiniEngineTaskType::AssetCooking,
+			EHoudiniEngineTaskState::Success,
+			AssetId, Task, TEXT("Finished Cooking"));
+	}
+	else
+	{
+		EHoudiniEngineTaskState TaskResult = EHoudiniEngineTaskState::FinishedWithFatalError;
+		if (Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
+			TaskResult = EHoudiniEngineTaskState::FinishedWithError;
+
+		// There was an error while cooking.
+		AddResponseMessageTaskInfo(
+			HAPI_RESULT_SUCCESS,
+			EHoudiniEngineTaskType::AssetCooking,
+			TaskResult,
+			AssetId, Task,
+			TEXT("Finished Cooking with Errors"));
+	}
+
+	// Interrupted cooks would skew the latencies
+	if (!bSuperseded)
+		RecordTaskLatency(Task, StartTime, FinishTime);
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("HAPI Asynchronous Cooking Finished for %s in %.3fs (since queued), AssetId = %d"),
+		*Task.ActorName, FinishTime - Task.QueuedTime, AssetId);
+}
+
+int32
+FHoudiniEngineScheduler::WaitForCookCompletion(
+	EHoudiniEngineTaskType TaskType, HAPI_NodeId AssetId, const FHoudiniEngineTask & Task)
+{
+	HAPI_Result Result = HAPI_RESULT_SUCCESS;
 	double LastUpdateTime = FPlatformTime::Seconds();
+	float PollInterval = MinPollInterval;
 
-	// We need to spin until cooking is finished.
 	while (true)
 	{
 		int32 Status = HAPI_STATE_STARTING_COOK;
-		HOUDINI_CHECK_ERROR_GET( &Result, FHoudiniApi::GetStatus(
+		HOUDINI_CHECK_ERROR_GET(&Result, FHoudiniApi::GetStatus(
 			FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status));
 
-		if (Status == HAPI_STATE_READY)
+		if (Result != HAPI_RESULT_SUCCESS)
 		{
-			// Cooking has been successful.
-			AddResponseMessageTaskInfo(
-				HAPI_RESULT_SUCCESS, 
-				EHoudiniEngineTaskType::AssetCooking,
-				EHoudiniEngineTaskState::Success,
-				AssetId, Task, TEXT("Finished Cooking"));
-
-			break;
+			// We can't get the cook state, consider this a fatal error.
+			return HAPI_STATE_READY_WITH_FATAL_ERRORS;
 		}
-		else if (Status == HAPI_STATE_READY_WITH_FATAL_ERRORS || Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
-		{
-			EHoudiniEngineTaskState TaskResult = EHoudiniEngineTaskState::FinishedWithFatalError;
-			if (Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
-				TaskResult = EHoudiniEngineTaskState::FinishedWithError;
 
-			// There was an error while instantiating.
-			AddResponseMessageTaskInfo(
-				HAPI_RESULT_SUCCESS,
-				EHoudiniEngineTaskType::AssetCooking,
-				TaskResult,
-				AssetId, Task,
-				TEXT("Finished Cooking with Errors"));
-
-			break;
+		if (Status == HAPI_STATE_READY
+			|| Status == HAPI_STATE_READY_WITH_FATAL_ERRORS
+			|| Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
+		{
+			return Status;
 		}
 
-		static const double NotificationUpdateFrequency = 0.5;
-		if (FPlatformTime::Seconds() - LastUpdateTime >= NotificationUpdateFrequency)
+		if ((FPlatformTime::Seconds() - LastUpdateTime) >= NotificationUpdateFrequency)
 		{
 			// Reset update time.
 			LastUpdateTime = FPlatformTime::Seconds();
@@ -357,19 +394,22 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 
 			AddResponseMessageTaskInfo(
 				HAPI_RESULT_SUCCESS,
-				EHoudiniEngineTaskType::AssetCooking,
+				TaskType,
 				EHoudiniEngineTaskState::Working,
 				AssetId, Task, CookStateMessage);
 		}
 
-		// We want to yield.
-		FPlatformProcess::SleepNoStats(UpdateFrequency);
+		// Yield, and poll less often the longer the cook takes.
+		FPlatformProcess::SleepNoStats(PollInterval);
+		PollInterval = FMath::Min(PollInterval * 2.0f, MaxPollInterval);
 	}
 }
 
 void
 FHoudiniEngineScheduler::TaskDeleteAsset(const FHoudiniEngineTask & Task)
 {
+	FHoudiniApiStatsContextScope ApiStatsScope(TEXT("Delete"), Task.ActorName);
+
 	HOUDINI_LOG_MESSAGE(
 		TEXT("HAPI Asynchronous Destruction Started for %s. ")
 		TEXT("AssetId = %d"),
@@ -410,31 +450,46 @@ FHoudiniEngineScheduler::AddResponseMessageTaskInfo(
 }
 
 void
-FHoudiniEngineScheduler::ProcessQueuedTasks()
+FHoudiniEngineScheduler::AbortQueuedTasks()
 {
-	while (!bStopping)
+	FHoudiniEngineTask Task;
+	while (DequeueTask(Task))
 	{
-		while (true)
-		{
-			FHoudiniEngineTask Task;
+		// Deletions are fire and forget, nobody is waiting for their task info
+		if (Task.TaskType == EHoudiniEngineTaskType::AssetDeletion)
+			continue;
 
-			{
-				FScopeLock ScopeLock(&CriticalSection);
-
-				// We have no tasks left.
-				if (PositionWrite == PositionRead)
-					break;
+		AddResponseMessageTaskInfo(
+			HAPI_RESULT_FAILURE,
+			Task.TaskType,
+			EHoudiniEngineTaskState::Aborted,
+			Task.AssetId, Task, TEXT("Session stopped"));
+	}
+}
 
-				// Retrieve task.
-				Task = Tasks[PositionRead];
-				PositionRead++;
+bool
+FHoudiniEngineScheduler::DequeueTask(FHoudiniEngineTask & OutTask)
+{
+	for (uint8 PriorityIdx = 0; PriorityIdx < (uint8)EHoudiniEngineTaskPriority::Max; PriorityIdx++)
+	{
+		if (Tasks[PriorityIdx].Dequeue(OutTask))
+			return true;
+	}
 
-				// Wrap around if required.
-				PositionRead &= (TaskCount - 1);
-			}
+	return false;
+}
 
-			bool bTaskProcessed = true;
+void
+FHoudiniEngineScheduler::ProcessQueuedTasks()
+{
+	// All the HAPI calls made by the tasks go to our session
+	FHoudiniEngineSessionScope SessionScope(SessionIndex);
 
+	while (!bStopping)
+	{
+		FHoudiniEngineTask Task;
+		while (!bStopping && DequeueTask(Task))
+		{
 			switch (Task.TaskType)
 			{
 				case EHoudiniEngineTaskType::AssetInstantiation:
@@ -463,19 +518,16 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 
 				default:
 				{
-					bTaskProcessed = false;
 					break;
 				}
 			}
-
-			if (!bTaskProcessed)
-				break;
 		}
 
 		if (FPlatformProcess::SupportsMultithreading())
 		{
-			// We want to yield for a bit.
-			FPlatformProcess::SleepNoStats(UpdateFrequency);
+			// Sleep until a new task is added, or until we're stopped.
+			if (!bStopping && WakeUpEvent)
+				WakeUpEvent->Wait();
 		}
 		else
 		{
@@ -537,60 +589,90 @@ FHoudiniEngineScheduler::TaskProccessAsset(const FHoudiniEngineTask & Task)
 	// TODO: Process results!
 }
 
+bool
+FHoudiniEngineScheduler::StartCookTask(const FHoudiniEngineTask & Task)
+{
+	FScopeLock ScopeLock(&CookTasksCriticalSection);
+
+	if (SupersededTasks.Remove(Task.HapiGUID) > 0)
+		return false;
+
+	RunningCookTaskGUID = Task.HapiGUID;
+	return true;
+}
+
+bool
+FHoudiniEngineScheduler::FinishCookTask(const FHoudiniEngineTask & Task)
+{
+	FScopeLock ScopeLock(&CookTasksCriticalSection);
+
+	RunningCookTaskGUID.Invalidate();
+
+	const FGuid* LatestGUID = LatestCookTasks.Find(Task.AssetId);
+	if (LatestGUID && *LatestGUID == Task.HapiGUID)
+		LatestCookTasks.Remove(Task.AssetId);
+
+	return SupersededTasks.Remove(Task.HapiGUID) > 0;
+}
+
 void
-FHoudiniEngineScheduler::AddTask(const FHoudiniEngineTask & Task)
+FHoudiniEngineScheduler::SupersedeTask(const FGuid & TaskGUID)
 {
-	FScopeLock ScopeLock(&CriticalSection);
+	SupersededTasks.Add(TaskGUID);
 
-	// Check if we need to grow our circular buffer.
-	if (PositionWrite + 1 == PositionRead)
+	if (RunningCookTaskGUID == TaskGUID)
 	{
-		// Calculate next size (next power of two).
-		uint32 NextTaskCount = FPlatformMath::RoundUpToPowerOfTwo(TaskCount + 1);
+		// The cook is running and its result is already stale, interrupt it.
+		FHoudiniApi::Interrupt(FHoudiniEngine::Get().GetSession(SessionIndex));
+	}
+}
 
-		// Allocate new buffer.
-		FHoudiniEngineTask * Buffer = static_cast<FHoudiniEngineTask *>(
-			FMemory::Malloc(NextTaskCount * sizeof(FHoudiniEngineTask)));
+bool
+FHoudiniEngineScheduler::InterruptTask(const FGuid & TaskGUID)
+{
+	if (!TaskGUID.IsValid())
+		return false;
 
-		if (!Buffer)
-			return;
+	FScopeLock ScopeLock(&CookTasksCriticalSection);
 
-		// Zero memory.
-		FMemory::Memset(Buffer, 0x0, NextTaskCount * sizeof(FHoudiniEngineTask));
+	// Only pending/running cook tasks can be superseded
+	if (SupersededTasks.Contains(TaskGUID))
+		return false;
 
-		// Copy elements from old buffer to new one.
-		if (PositionRead < PositionWrite)
-		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (PositionWrite - PositionRead));
+	const HAPI_NodeId* AssetId = LatestCookTasks.FindKey(TaskGUID);
+	if (!AssetId)
+		return false;
 
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = PositionWrite - PositionRead;
-		}
-		else
-		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (TaskCount - PositionRead));
-			FMemory::Memcpy(Buffer + TaskCount - PositionRead, Tasks, sizeof(FHoudiniEngineTask) * PositionWrite);
+	LatestCookTasks.Remove(*AssetId);
+	SupersedeTask(TaskGUID);
 
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = TaskCount - PositionRead + PositionWrite;
-		}
+	return true;
+}
+
+void
+FHoudiniEngineScheduler::AddTask(const FHoudiniEngineTask & Task)
+{
+	if (Task.TaskType == EHoudiniEngineTaskType::AssetCooking)
+	{
+		// Latest cook wins: any older cook for the same node is superseded.
+		FScopeLock ScopeLock(&CookTasksCriticalSection);
 
-		// Deallocate old buffer.
-		FMemory::Free(Tasks);
+		FGuid* PreviousGUID = LatestCookTasks.Find(Task.AssetId);
+		if (PreviousGUID && *PreviousGUID != Task.HapiGUID)
+			SupersedeTask(*PreviousGUID);
 
-		// Bookkeeping.
-		Tasks = Buffer;
-		TaskCount = NextTaskCount;
+		LatestCookTasks.Add(Task.AssetId, Task.HapiGUID);
 	}
 
-	// Store task.
-	Tasks[PositionWrite] = Task;
-	PositionWrite++;
+	uint8 PriorityIdx = FMath::Min((uint8)Task.Priority, (uint8)((uint8)EHoudiniEngineTaskPriority::Max - 1));
+
+	FHoudiniEngineTask QueuedTask = Task;
+	QueuedTask.QueuedTime = FPlatformTime::Seconds();
+	Tasks[PriorityIdx].Enqueue(QueuedTask);
 
-	// Wrap around if required.
-	PositionWrite &= (TaskCount - 1);
+	// Wake up the scheduler thread.
+	if (WakeUpEvent)
+		WakeUpEvent->Trigger();
 }
 
 uint32
@@ -604,6 +686,10 @@ void
 FHoudiniEngineScheduler::Stop()
 {
 	bStopping = true;
+
+	// Make sure the scheduler thread isn't waiting for a task.
+	if (WakeUpEvent)
+		WakeUpEvent->Trigger();
 }
 
 void
@@ -617,3 +703,83 @@ FHoudiniEngineScheduler::GetSingleThreadInterface()
 {
 	return this;
 }
+
+void
+FHoudiniEngineScheduler::RecordTaskLatency(const FHoudiniEngineTask & Task, const double & InStartTime, const double & InFinishTime)
+{
+	FTaskLatencyStats* TypeStats = nullptr;
+	if (Task.TaskType == EHoudiniEngineTaskType::AssetInstantiation)
+		TypeStats = InstantiationLatencyStats;
+	else if (Task.TaskType == EHoudiniEngineTaskType::AssetCooking)
+		TypeStats = CookLatencyStats;
+
+	if (!TypeStats || Task.QueuedTime <= 0.0)
+		return;
+
+	const uint8 PriorityIdx = FMath::Min((uint8)Task.Priority, (uint8)((uint8)EHoudiniEngineTaskPriority::Max - 1));
+	const double QueueTime = InStartTime - Task.QueuedTime;
+	const double Latency = InFinishTime - Task.QueuedTime;
+
+	FScopeLock ScopeLock(&LatencyStatsCriticalSection);
+	FTaskLatencyStats& Stats = TypeStats[PriorityIdx];
+	Stats.TaskCount++;
+	Stats.TotalQueueTime += QueueTime;
+	Stats.MaxQueueTime = FMath::Max(Stats.MaxQueueTime, QueueTime);
+	Stats.TotalLatency += Latency;
+	Stats.MaxLatency = FMath::Max(Stats.MaxLatency, Latency);
+}
+
+void
+FHoudiniEngineScheduler::PrintLatencyStats()
+{
+	static const TCHAR* PriorityNames[] = { TEXT("Interactive"), TEXT("Normal"), TEXT("Background") };
+	static_assert(UE_ARRAY_COUNT(PriorityNames) == (uint8)EHoudiniEngineTaskPriority::Max, "Missing task priority names");
+
+	auto PrintTypeStats = [](const TCHAR* InTypeName, const FTaskLatencyStats* InTypeStats)
+	{
+		for (int32 PriorityIdx = 0; PriorityIdx < (uint8)EHoudiniEngineTaskPriority::Max; PriorityIdx++)
+		{
+			const FTaskLatencyStats& Stats = InTypeStats[PriorityIdx];
+			if (Stats.TaskCount <= 0)
+				continue;
+
+			HOUDINI_LOG_MESSAGE(
+				TEXT("Scheduler latency - %s (%s): %lld tasks, queued avg %.2fms max %.2fms, queue to completion avg %.2fms max %.2fms"),
+				InTypeName, PriorityNames[PriorityIdx], Stats.TaskCount,
+				Stats.TotalQueueTime * 1000.0 / Stats.TaskCount, Stats.MaxQueueTime * 1000.0,
+				Stats.TotalLatency * 1000.0 / Stats.TaskCount, Stats.MaxLatency * 1000.0);
+		}
+	};
+
+	FScopeLock ScopeLock(&LatencyStatsCriticalSection);
+	PrintTypeStats(TEXT("Instantiation"), InstantiationLatencyStats);
+	PrintTypeStats(TEXT("Cook"), CookLatencyStats);
+}
+
+void
+FHoudiniEngineScheduler::ResetLatencyStats()
+{
+	FScopeLock ScopeLock(&LatencyStatsCriticalSection);
+	for (int32 PriorityIdx = 0; PriorityIdx < (uint8)EHoudiniEngineTaskPriority::Max; PriorityIdx++)
+	{
+		InstantiationLatencyStats[PriorityIdx] = FTaskLatencyStats();
+		CookLatencyStats[PriorityIdx] = FTaskLatencyStats();
+	}
+}
+
+static void
+HoudiniSchedulerLatencyCommand(const TArray<FString>& Args)
+{
+	const FString Command = Args.Num() > 0 ? Args[0] : FString();
+	if (Command.Equals(TEXT("Reset"), ESearchCase::IgnoreCase))
+		FHoudiniEngineScheduler::ResetLatencyStats();
+	else
+		FHoudiniEngineScheduler::PrintLatencyStats();
+}
+
+static FAutoConsoleCommand CCmdHoudiniSchedulerLatency(
+	TEXT("Houdini.SchedulerLatency"),
+	TEXT("Queue to completion latency of the instantiation and cook tasks, per priority.\n")
+	TEXT("Houdini.SchedulerLatency Reset: empties the recorded latencies.\n")
+	TEXT("Houdini.SchedulerLatency [Print]: prints the recorded latencies to the log.\n"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&HoudiniSchedulerLatencyCommand));
@@ -30,13 +30,16 @@
 #include "HoudiniEngineTaskInfo.h"
 #include "HAL/Runnable.h"
 #include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
 #include "Misc/SingleThreadRunnable.h"
+#include "Containers/Queue.h"
 
 class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
 {
 public:
 
-	FHoudiniEngineScheduler();
+	// The scheduler processes the tasks of a session of the pool, 0 being the main session.
+	FHoudiniEngineScheduler(const int32& InSessionIndex = 0);
 	virtual ~FHoudiniEngineScheduler();
 
 	// FRunnable methods.
@@ -48,8 +51,18 @@ public:
 	virtual void Tick() override;
 
 	// Adds a task.
+	// Adding a cook task supersedes any pending or running cook task for the same node.
 	void AddTask(const FHoudiniEngineTask & Task);
 
+	// Supersedes a pending or running cook task. 
+	// Pending tasks are dropped, running cooks are interrupted via HAPI_Interrupt.
+	// In both cases, the task finishes with the Aborted state.
+	// Returns true if the task was found and superseded.
+	bool InterruptTask(const FGuid & TaskGUID);
+
+	// Finishes the tasks still queued with the Aborted state, once the scheduler thread has been stopped.
+	void AbortQueuedTasks();
+
 	// Adds instantiation response task info.
 	void AddResponseTaskInfo(
 		HAPI_Result Result, 
@@ -66,11 +79,46 @@ public:
 		const FHoudiniEngineTask & Task,
 		const FString & ErrorMessage);
 
+	// Latency of the instantiation/cook tasks that ran to completion, for a task type and priority.
+	struct FTaskLatencyStats
+	{
+		int64 TaskCount = 0;
+		// Time spent in the queue, from AddTask until the scheduler started processing the task.
+		double TotalQueueTime = 0.0;
+		double MaxQueueTime = 0.0;
+		// Time from AddTask until the cook finished in the session.
+		double TotalLatency = 0.0;
+		double MaxLatency = 0.0;
+	};
+
+	// Records the latency of a task that has been processed.
+	static void RecordTaskLatency(const FHoudiniEngineTask & Task, const double & InStartTime, const double & InFinishTime);
+
+	// Prints the recorded latencies to the log, per task type and priority.
+	static void PrintLatencyStats();
+
+	// Empties the recorded latencies.
+	static void ResetLatencyStats();
+
 protected:
 
 	// Process queued tasks. 
 	void ProcessQueuedTasks();
 
+	// Retrieves the next task to process, highest priority first.
+	// Returns false if all the queues are empty.
+	bool DequeueTask(FHoudiniEngineTask & OutTask);
+
+	// Waits until the session's cook state is no longer "cooking".
+	// The cook state is polled at an increasing interval, so short cooks are picked up right away
+	// while long cooks do not flood the session with status requests.
+	// Working task infos are sent at a regular interval while waiting.
+	// Returns the final HAPI_State of the cook.
+	int32 WaitForCookCompletion(
+		EHoudiniEngineTaskType TaskType,
+		HAPI_NodeId AssetId,
+		const FHoudiniEngineTask & Task);
+
 	// Task : instantiate an asset. 
 	void TaskInstantiateAsset(const FHoudiniEngineTask & Task);
 
@@ -89,28 +137,57 @@ protected:
 	// Process the result of a sucesfull cook
 	void TaskProccessAsset(const FHoudiniEngineTask & Task);
 
+	// Marks a cook task as the one currently running.
+	// Returns false if the task has been superseded and should not be processed.
+	bool StartCookTask(const FHoudiniEngineTask & Task);
+
+	// Clears the running cook task. 
+	// Returns true if the task was superseded while it was running.
+	bool FinishCookTask(const FHoudiniEngineTask & Task);
+
+	// Marks a task as superseded, and interrupts it if it is currently running.
+	// CookTasksCriticalSection must be locked by the caller.
+	void SupersedeTask(const FGuid & TaskGUID);
+
 private:
 
-	// Initial number of tasks in our circular queue. 
-	static const uint32 InitialTaskSize;
+	// Polling interval used right after a cook is started.
+	static const float MinPollInterval;
+
+	// Longest polling interval used while waiting for a cook to finish.
+	static const float MaxPollInterval;
+
+	// Interval between two "Working" task info updates.
+	static const double NotificationUpdateFrequency;
+
+	// Scheduled tasks, one lock-free queue per priority.
+	// Tasks can be added from any thread, but are only consumed by the scheduler thread.
+	TQueue<FHoudiniEngineTask, EQueueMode::Mpsc> Tasks[(uint8)EHoudiniEngineTaskPriority::Max];
+
+	// Event triggered when a task is added or when the scheduler is stopped.
+	FEvent* WakeUpEvent;
+
+	// Synchronization primitive for the cook tasks bookkeeping.
+	FCriticalSection CookTasksCriticalSection;
 
-	// Frequency update (sleep time between each update)
-	static const float UpdateFrequency;
+	// GUID of the latest cook task (pending or running) for each node.
+	TMap<HAPI_NodeId, FGuid> LatestCookTasks;
 
-	// Synchronization primitive. 
-	FCriticalSection CriticalSection;
+	// Cook tasks that have been superseded by a newer request.
+	TSet<FGuid> SupersededTasks;
 
-	// List of scheduled tasks. 
-	FHoudiniEngineTask* Tasks;
+	// GUID of the cook task currently being processed.
+	FGuid RunningCookTaskGUID;
 
-	// Head of the circular queue. 
-	uint32 PositionWrite;
+	// Recorded latencies of the instantiation and cook tasks, per priority, shared by all the schedulers.
+	static FTaskLatencyStats InstantiationLatencyStats[(uint8)EHoudiniEngineTaskPriority::Max];
+	static FTaskLatencyStats CookLatencyStats[(uint8)EHoudiniEngineTaskPriority::Max];
 
-	// Tail of the circular queue. 
-	uint32 PositionRead;
+	// Protects the latency stats, the schedulers of the session pool run on their own threads.
+	static FCriticalSection LatencyStatsCriticalSection;
 
-	// Size of the circular queue. 
-	uint32 TaskCount;
+	// Index of the session the tasks are processed with.
+	int32 SessionIndex;
 
 	// Stopping flag. 
 	bool bStopping;
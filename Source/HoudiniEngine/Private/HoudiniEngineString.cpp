@@ -30,8 +30,19 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 
+#include "Async/ParallelFor.h"
+
 #include <vector>
 
+// Minimum number of strings to convert before using a ParallelFor
+#define HOUDINI_STRING_BATCH_PARALLEL_MIN 1024
+
+TMap<int32, FString>
+FHoudiniEngineString::CachedStrings;
+
+int32
+FHoudiniEngineString::CachingScopeCount = 0;
+
 FHoudiniEngineString::FHoudiniEngineString()
 	: StringId(-1)
 {}
@@ -130,11 +141,24 @@ bool
 FHoudiniEngineString::ToFString(FString& String) const
 {
 	String = TEXT("");
-	std::string NamePlain = "";
 
+	const bool bUseCache = IsCaching();
+	if (bUseCache)
+	{
+		if (const FString* CachedString = CachedStrings.Find(StringId))
+		{
+			String = *CachedString;
+			return true;
+		}
+	}
+
+	std::string NamePlain = "";
 	if (ToStdString(NamePlain))
 	{
 		String = UTF8_TO_TCHAR(NamePlain.c_str());
+		if (bUseCache)
+			CachedStrings.Add(StringId, String);
+
 		return true;
 	}
 
@@ -188,28 +212,183 @@ bool
 FHoudiniEngineString::SHArrayToFStringArray(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray)
 {
 	bool bReturn = true;
-	OutStringArray.SetNumZeroed(InStringIdArray.Num());
-
-	// Avoid calling HAPI to resolve the same strings again and again
-	TMap<HAPI_StringHandle, int32> ResolvedStrings;
+	OutStringArray.SetNum(InStringIdArray.Num());
+
+	// Gather the unique handles that need to be resolved, and the index of each handle in that array
+	const bool bUseCache = IsCaching();
+	TMap<HAPI_StringHandle, int32> UniqueIndices;
+	TArray<int32> UniqueStringIds;
+	TArray<int32> StringIndices;
+	StringIndices.SetNumUninitialized(InStringIdArray.Num());
 	for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
 	{
-		const int32* ResolvedString = ResolvedStrings.Find(InStringIdArray[IdxSH]);
-		if (ResolvedString)
+		const HAPI_StringHandle& CurrentSH = InStringIdArray[IdxSH];
+		StringIndices[IdxSH] = INDEX_NONE;
+
+		// Null string ID / zero should be considered invalid
+		if (CurrentSH <= 0)
 		{
-			// Already resolved earlier, copy the string instead of calling HAPI.
-			OutStringArray[IdxSH] = OutStringArray[*ResolvedString];
+			bReturn = false;
+			continue;
+		}
+
+		if (bUseCache && CachedStrings.Contains(CurrentSH))
+			continue;
+
+		const int32* FoundIndex = UniqueIndices.Find(CurrentSH);
+		if (FoundIndex)
+		{
+			StringIndices[IdxSH] = *FoundIndex;
 		}
 		else
 		{
-			FString CurrentString = FString();
-			if(!FHoudiniEngineString::ToFString(InStringIdArray[IdxSH], CurrentString))
-				bReturn = false;
+			StringIndices[IdxSH] = UniqueStringIds.Add(CurrentSH);
+			UniqueIndices.Add(CurrentSH, StringIndices[IdxSH]);
+		}
+	}
 
-			OutStringArray[IdxSH] = CurrentString;
-			ResolvedStrings.Add(InStringIdArray[IdxSH], IdxSH);
+	// Resolve all the unique handles at once
+	TArray<FString> UniqueStrings;
+	if (UniqueStringIds.Num() > 0 && !GetStringBatch(UniqueStringIds, UniqueStrings))
+	{
+		// Batch failed, resolve the handles one by one instead
+		UniqueStrings.SetNum(UniqueStringIds.Num());
+		for (int32 Idx = 0; Idx < UniqueStringIds.Num(); Idx++)
+		{
+			if (!FHoudiniEngineString::ToFString(UniqueStringIds[Idx], UniqueStrings[Idx]))
+				bReturn = false;
 		}
 	}
 
+	if (bUseCache)
+	{
+		for (int32 Idx = 0; Idx < UniqueStringIds.Num(); Idx++)
+			CachedStrings.Add(UniqueStringIds[Idx], UniqueStrings[Idx]);
+	}
+
+	// Copy the resolved strings to the output array
+	auto CopyString = [&](int32 IdxSH)
+	{
+		const int32& UniqueIndex = StringIndices[IdxSH];
+		if (UniqueIndex != INDEX_NONE)
+			OutStringArray[IdxSH] = UniqueStrings[UniqueIndex];
+		else if (bUseCache && InStringIdArray[IdxSH] > 0)
+			OutStringArray[IdxSH] = CachedStrings.FindChecked(InStringIdArray[IdxSH]);
+		else
+			OutStringArray[IdxSH].Empty();
+	};
+
+	if (InStringIdArray.Num() >= HOUDINI_STRING_BATCH_PARALLEL_MIN)
+	{
+		ParallelFor(InStringIdArray.Num(), CopyString);
+	}
+	else
+	{
+		for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
+			CopyString(IdxSH);
+	}
+
 	return bReturn;
-}
\ No newline at end of file
+}
+
+bool
+FHoudiniEngineString::GetStringBatch(const TArray<int32>& InUniqueStringIds, TArray<FString>& OutStrings)
+{
+	OutStrings.Empty();
+
+	int32 BufferSize = 0;
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatchSize(
+		FHoudiniEngine::Get().GetSession(),
+		InUniqueStringIds.GetData(), InUniqueStringIds.Num(), &BufferSize))
+	{
+		return false;
+	}
+
+	if (BufferSize <= 0)
+		return false;
+
+	TArray<char> Buffer;
+	Buffer.SetNumZeroed(BufferSize);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatch(
+		FHoudiniEngine::Get().GetSession(), Buffer.GetData(), BufferSize))
+	{
+		return false;
+	}
+
+	// The buffer contains all the strings, null-separated and in the same order as the handles
+	TArray<int32> StringOffsets;
+	StringOffsets.SetNumUninitialized(InUniqueStringIds.Num());
+	int32 CurrentOffset = 0;
+	for (int32 Idx = 0; Idx < InUniqueStringIds.Num(); Idx++)
+	{
+		if (CurrentOffset >= BufferSize)
+			return false;
+
+		StringOffsets[Idx] = CurrentOffset;
+		while (CurrentOffset < BufferSize && Buffer[CurrentOffset] != '\0')
+			CurrentOffset++;
+
+		// Skip the null separator
+		CurrentOffset++;
+	}
+
+	// Make sure the last string is null-terminated
+	Buffer[BufferSize - 1] = '\0';
+
+	// Convert the strings from UTF8
+	OutStrings.SetNum(InUniqueStringIds.Num());
+	auto ConvertString = [&](int32 Idx)
+	{
+		OutStrings[Idx] = UTF8_TO_TCHAR(&Buffer[StringOffsets[Idx]]);
+	};
+
+	if (InUniqueStringIds.Num() >= HOUDINI_STRING_BATCH_PARALLEL_MIN)
+	{
+		ParallelFor(InUniqueStringIds.Num(), ConvertString);
+	}
+	else
+	{
+		for (int32 Idx = 0; Idx < InUniqueStringIds.Num(); Idx++)
+			ConvertString(Idx);
+	}
+
+	return true;
+}
+
+void
+FHoudiniEngineString::BeginCaching()
+{
+	if (!IsInGameThread())
+		return;
+
+	CachingScopeCount++;
+}
+
+void
+FHoudiniEngineString::EndCaching()
+{
+	if (!IsInGameThread())
+		return;
+
+	CachingScopeCount--;
+	if (CachingScopeCount <= 0)
+	{
+		CachingScopeCount = 0;
+		EmptyCache();
+	}
+}
+
+void
+FHoudiniEngineString::EmptyCache()
+{
+	if (!IsInGameThread())
+		return;
+
+	CachedStrings.Empty();
+}
+
+bool
+FHoudiniEngineString::IsCaching()
+{
+	return CachingScopeCount > 0 && IsInGameThread();
+}
@@ -28,6 +28,7 @@
 
 #include <string>
 #include "HoudiniApi.h"
+#include "CoreMinimal.h"
 
 class FText;
 class FString;
@@ -58,9 +59,19 @@ class HOUDINIENGINE_API FHoudiniEngineString
 		static bool ToFString(const int32& InStringId, FString & String);
 		static bool ToFText(const int32& InStringId, FText & Text);
 
-		// Array converter, uses a map to avoid redudant calls to HAPI
+		// Array converter, resolves all the unique handles with a single string batch
 		static bool SHArrayToFStringArray(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray);
 
+		// Enables the shared handle to string cache, calls can be nested.
+		// Should only be enabled while the strings handles can't be invalidated (ie, between cooks).
+		static void BeginCaching();
+
+		// Disables the cache and empties it when the outermost caching scope ends.
+		static void EndCaching();
+
+		// Removes all the cached strings, needs to be called when a node is cooked while caching.
+		static void EmptyCache();
+
 		// Return id of this string.
 		int32 GetId() const;
 
@@ -69,6 +80,18 @@ class HOUDINIENGINE_API FHoudiniEngineString
 
 	protected:
 
+		// Indicates if the string cache can currently be used.
+		static bool IsCaching();
+
+		// Resolves the given unique string handles using HAPI's string batch functions.
+		static bool GetStringBatch(const TArray<int32>& InUniqueStringIds, TArray<FString>& OutStrings);
+
 		// Id of the underlying Houdini Engine string.
 		int32 StringId;
+
+		// Strings resolved while caching, shared by all the translators.
+		static TMap<int32, FString> CachedStrings;
+
+		// Number of active caching scopes.
+		static int32 CachingScopeCount;
 };
@@ -30,6 +30,8 @@
 
 FHoudiniEngineTask::FHoudiniEngineTask()
 	: TaskType(EHoudiniEngineTaskType::None)
+	, Priority(EHoudiniEngineTaskPriority::Normal)
+	, QueuedTime(0.0)
 	, ActorName(TEXT(""))
 	, AssetId(-1)
 	, AssetLibraryId(-1)
@@ -41,6 +43,8 @@ FHoudiniEngineTask::FHoudiniEngineTask()
 FHoudiniEngineTask::FHoudiniEngineTask(EHoudiniEngineTaskType InTaskType, FGuid InHapiGUID)
 	: HapiGUID(InHapiGUID)
 	, TaskType(InTaskType)
+	, Priority(EHoudiniEngineTaskPriority::Normal)
+	, QueuedTime(0.0)
 	, ActorName(TEXT(""))
 	, AssetId(-1)
 	, AssetLibraryId(-1)
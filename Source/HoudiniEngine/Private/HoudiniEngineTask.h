@@ -68,6 +68,22 @@ enum class EHoudiniEngineTaskType : uint8
 	AssetProcess,
 };
 
+UENUM()
+enum class EHoudiniEngineTaskPriority : uint8
+{
+	// Tasks triggered directly by the user (parameter/input edits...) 
+	// These are always processed first.
+	Interactive,
+
+	// Default priority.
+	Normal,
+
+	// Tasks that can be deferred (cooks/instantiations triggered by a level load...)
+	Background,
+
+	Max UMETA(Hidden)
+};
+
 struct HOUDINIENGINE_API FHoudiniEngineTask
 {
 	// Constructors.
@@ -80,6 +96,12 @@ struct HOUDINIENGINE_API FHoudiniEngineTask
 	// Type of this task.
 	EHoudiniEngineTaskType TaskType;
 
+	// Priority of this task.
+	EHoudiniEngineTaskPriority Priority;
+
+	// Time at which this task was added to the scheduler.
+	double QueuedTime;
+
 	// Houdini asset for instantiation.
 	TWeakObjectPtr< class UHoudiniAsset > Asset;
 
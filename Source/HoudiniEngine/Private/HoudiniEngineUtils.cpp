@@ -51,6 +51,8 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniParameter.h"
 #include "HoudiniEngineRuntimeUtils.h"
+#include "HoudiniPartAttributeCache.h"
+#include "HoudiniAssetLibraryCache.h"
 
 #if WITH_EDITOR
 	#include "SAssetSelectionWidget.h"
@@ -350,7 +352,8 @@ FHoudiniEngineUtils::GetCookLog(TArray<UHoudiniAssetComponent*>& InHACs)
 		if (!HAC || HAC->IsPendingKill())
 			continue;
 
-		// Get the node errors, warnings and messages
+		// Get the node errors, warnings and messages, from the session the HAC was cooked in
+		FHoudiniEngineSessionScope SessionScope(HAC->GetSessionIndex());
 		FString NodeErrors = FHoudiniEngineUtils::GetNodeErrorsWarningsAndMessages(HAC->GetAssetId());
 		if (NodeErrors.IsEmpty())
 			continue;
@@ -404,6 +407,7 @@ FHoudiniEngineUtils::GetAssetHelp(UHoudiniAssetComponent* HoudiniAssetComponent)
 	if (AssetId < 0)
 		return HelpString;
 
+	FHoudiniEngineSessionScope SessionScope(HoudiniAssetComponent->GetSessionIndex());
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAssetInfo(
 		FHoudiniEngine::Get().GetSession(), AssetId, &AssetInfo), HelpString);
 
@@ -1218,11 +1222,19 @@ FHoudiniEngineUtils::LoadHoudiniAsset(UHoudiniAsset * HoudiniAsset, HAPI_AssetLi
 
 	// If the hda file exists, we can simply load it directly
 	HAPI_Result Result = HAPI_RESULT_FAILURE;
+	FString LibraryCacheKey;
 	if ( !AssetFileName.IsEmpty() )
 	{
 		if ( FPaths::FileExists(AssetFileName)
 			|| (HoudiniAsset->IsExpandedHDA() && FPaths::DirectoryExists(AssetFileName) ) )
 		{
+			// Reuse the library if this version of the file has already been loaded in this session
+			if (!HoudiniAsset->IsExpandedHDA())
+				LibraryCacheKey = FHoudiniAssetLibraryCache::GetFileKey(AssetFileName);
+
+			if (FHoudiniAssetLibraryCache::FindAssetLibrary(LibraryCacheKey, OutAssetLibraryId))
+				return true;
+
 			// Load the asset from file.
 			std::string AssetFileNamePlain;
 			FHoudiniEngineUtils::ConvertUnrealString(AssetFileName, AssetFileNamePlain);
@@ -1267,6 +1279,11 @@ FHoudiniEngineUtils::LoadHoudiniAsset(UHoudiniAsset * HoudiniAsset, HAPI_AssetLi
 		}
 		else
 		{
+			// Reuse the library if the memory copy has already been loaded in this session
+			LibraryCacheKey = FHoudiniAssetLibraryCache::GetMemoryKey(HoudiniAsset);
+			if (FHoudiniAssetLibraryCache::FindAssetLibrary(LibraryCacheKey, OutAssetLibraryId))
+				return true;
+
 			// Warn the user that we are loading from memory
 			HOUDINI_LOG_WARNING(TEXT("Asset %s, loading from Memory: source asset file not found."), *AssetFileName);
 
@@ -1288,6 +1305,8 @@ FHoudiniEngineUtils::LoadHoudiniAsset(UHoudiniAsset * HoudiniAsset, HAPI_AssetLi
 		return false;
 	}
 
+	FHoudiniAssetLibraryCache::AddAssetLibrary(LibraryCacheKey, HoudiniAsset, OutAssetLibraryId);
+
 	return true;
 }
 
@@ -1299,6 +1318,10 @@ FHoudiniEngineUtils::GetSubAssetNames(
 	if (AssetLibraryId < 0)
 		return false;
 
+	// The asset names of an already loaded library don't change
+	if (FHoudiniAssetLibraryCache::FindAssetNames(AssetLibraryId, OutAssetNames))
+		return true;
+
 	int32 AssetCount = 0;
 	HAPI_Result Result = HAPI_RESULT_FAILURE;
 	Result = FHoudiniApi::GetAvailableAssetCount(FHoudiniEngine::Get().GetSession(), AssetLibraryId, &AssetCount);
@@ -1328,6 +1351,8 @@ FHoudiniEngineUtils::GetSubAssetNames(
 		return false;
 	}
 
+	FHoudiniAssetLibraryCache::SetAssetNames(AssetLibraryId, OutAssetNames);
+
 	return true;
 }
 
@@ -2571,26 +2596,18 @@ FHoudiniEngineUtils::HapiGetGroupMembership(
 }
 
 bool
-FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+FHoudiniEngineUtils::HapiGetAttributeInfo(
 	const HAPI_NodeId& InGeoId,
 	const HAPI_PartId& InPartId,
 	const char * InAttribName,
-	HAPI_AttributeInfo& OutAttributeInfo,
-	TArray<float>& OutData,
-	int32 InTupleSize,
-	HAPI_AttributeOwner InOwner)
+	const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeInfo& OutAttributeInfo)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniEngineUtils::HapiGetAttributeDataAsFloat"));
-
-	OutAttributeInfo.exists = false;
-
-	// Reset container size.
-	OutData.SetNumUninitialized(0);
-
-	int32 OriginalTupleSize = InTupleSize;
+	// Use the cached infos when translating outputs
+	if (FHoudiniPartAttributeCache::FindAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, OutAttributeInfo))
+		return true;
 
-	HAPI_AttributeInfo AttributeInfo;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+	FHoudiniApi::AttributeInfo_Init(&OutAttributeInfo);
 	if (InOwner == HAPI_ATTROWNER_INVALID)
 	{
 		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
@@ -2598,20 +2615,75 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
 				FHoudiniEngine::Get().GetSession(),
 				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
+				(HAPI_AttributeOwner)AttrIdx, &OutAttributeInfo), false);
 
-			if (AttributeInfo.exists)
+			if (OutAttributeInfo.exists)
 				break;
 		}
 	}
 	else
 	{
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(), 
+			FHoudiniEngine::Get().GetSession(),
 			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
+			InOwner, &OutAttributeInfo), false);
 	}
 
+	return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiGetAttributeNames(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const HAPI_AttributeOwner& InOwner,
+	TArray<FString>& OutAttributeNames)
+{
+	// Use the cached names when translating outputs
+	if (FHoudiniPartAttributeCache::GetAttributeNames(InGeoId, InPartId, InOwner, OutAttributeNames))
+		return true;
+
+	// Get the part info to get the attribute counts for the specified owner
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(
+		FHoudiniEngine::Get().GetSession(), InGeoId, InPartId, &PartInfo), false);
+
+	int32 nAttribCount = PartInfo.attributeCounts[InOwner];
+
+	TArray<HAPI_StringHandle> AttribNameSHArray;
+	AttribNameSHArray.SetNum(nAttribCount);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeNames(
+		FHoudiniEngine::Get().GetSession(),
+		InGeoId, InPartId, InOwner,
+		AttribNameSHArray.GetData(), nAttribCount), false);
+
+	return FHoudiniEngineString::SHArrayToFStringArray(AttribNameSHArray, OutAttributeNames);
+}
+
+bool
+FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char * InAttribName,
+	HAPI_AttributeInfo& OutAttributeInfo,
+	TArray<float>& OutData,
+	int32 InTupleSize,
+	HAPI_AttributeOwner InOwner)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniEngineUtils::HapiGetAttributeDataAsFloat"));
+
+	OutAttributeInfo.exists = false;
+
+	// Reset container size.
+	OutData.SetNumUninitialized(0);
+
+	int32 OriginalTupleSize = InTupleSize;
+
+	HAPI_AttributeInfo AttributeInfo;
+	if (!FHoudiniEngineUtils::HapiGetAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+		return false;
+
 	if (!AttributeInfo.exists)
 		return false;
 
@@ -2705,27 +2777,8 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 	int32 OriginalTupleSize = InTupleSize;
 
 	HAPI_AttributeInfo AttributeInfo;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
-	{
-		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
-		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
-
-			if (AttributeInfo.exists)
-				break;
-		}
-	}
-	else
-	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
-	}
+	if (!FHoudiniEngineUtils::HapiGetAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+		return false;
 
 	if (!AttributeInfo.exists)
 		return false;
@@ -2821,27 +2874,8 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
 	int32 OriginalTupleSize = InTupleSize;
 
 	HAPI_AttributeInfo AttributeInfo;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
-	{
-		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
-		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
-
-			if (AttributeInfo.exists)
-				break;
-		}
-	}
-	else
-	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
-	}
+	if (!FHoudiniEngineUtils::HapiGetAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+		return false;
 
 	if (!AttributeInfo.exists)
 		return false;
@@ -2956,11 +2990,8 @@ FHoudiniEngineUtils::HapiCheckAttributeExists(
 	else
 	{
 		HAPI_AttributeInfo AttribInfo;
-		FHoudiniApi::AttributeInfo_Init(&AttribInfo);
-
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			GeoId, PartId, AttribName, Owner, &AttribInfo), false);
+		if (!FHoudiniEngineUtils::HapiGetAttributeInfo(GeoId, PartId, AttribName, Owner, AttribInfo))
+			return false;
 
 		return AttribInfo.exists;
 	}
@@ -3158,26 +3189,10 @@ FHoudiniEngineUtils::HapiGetAttributeOfType(
 {
 	int32 NumberOfAttributeFound = 0;
 
-	// Get the part infos
-	HAPI_PartInfo PartInfo;
-	FHoudiniApi::PartInfo_Init(&PartInfo);
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(
-		FHoudiniEngine::Get().GetSession(),
-		GeoId, PartId, &PartInfo), NumberOfAttributeFound);
-
 	// Get All attribute names for that part
-	int32 nAttribCount = PartInfo.attributeCounts[AttributeOwner];
-
-	TArray<HAPI_StringHandle> AttribNameSHArray;
-	AttribNameSHArray.SetNum(nAttribCount);
-
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeNames(
-		FHoudiniEngine::Get().GetSession(),
-		GeoId, PartId, AttributeOwner,
-		AttribNameSHArray.GetData(), nAttribCount), NumberOfAttributeFound);
-
 	TArray<FString> AttribNameArray;
-	FHoudiniEngineString::SHArrayToFStringArray(AttribNameSHArray, AttribNameArray);
+	if (!FHoudiniEngineUtils::HapiGetAttributeNames(GeoId, PartId, AttributeOwner, AttribNameArray))
+		return NumberOfAttributeFound;
 
 	// Iterate on all the attributes, and get their part infos to get their type
 	for (int32 Idx = 0; Idx < AttribNameArray.Num(); Idx++)
@@ -3186,12 +3201,8 @@ FHoudiniEngineUtils::HapiGetAttributeOfType(
 
 		// ... then the attribute info
 		HAPI_AttributeInfo AttrInfo;
-		FHoudiniApi::AttributeInfo_Init(&AttrInfo);
-
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			GeoId, PartId, TCHAR_TO_UTF8(*HapiString),
-			AttributeOwner, &AttrInfo))
+		if (!FHoudiniEngineUtils::HapiGetAttributeInfo(
+			GeoId, PartId, TCHAR_TO_UTF8(*HapiString), AttributeOwner, AttrInfo))
 			continue;
 
 		if (!AttrInfo.exists)
@@ -4022,24 +4033,10 @@ FHoudiniEngineUtils::GetGenericAttributeList(
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineUtils::GetGenericAttributeList);
 	
-	// Get the part info to get the attribute counts for the specified owner
-	HAPI_PartInfo PartInfo;
-	FHoudiniApi::PartInfo_Init(&PartInfo);
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(
-		FHoudiniEngine::Get().GetSession(), InGeoNodeId, InPartId, &PartInfo), false);
-	
-	int32 nAttribCount = PartInfo.attributeCounts[AttributeOwner];
-
 	// Get all attribute names for that part
-	TArray<HAPI_StringHandle> AttribNameSHArray;
-	AttribNameSHArray.SetNum(nAttribCount);
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeNames(
-		FHoudiniEngine::Get().GetSession(),
-		InGeoNodeId, InPartId, AttributeOwner,
-		AttribNameSHArray.GetData(), nAttribCount))
-	{
+	TArray<FString> AttribNameArray;
+	if (!FHoudiniEngineUtils::HapiGetAttributeNames(InGeoNodeId, InPartId, AttributeOwner, AttribNameArray))
 		return 0;
-	}	
 
 	// For everything but detail attribute,
 	// if an attribute index was specified, only extract the attribute value for that specific index
@@ -4054,21 +4051,15 @@ FHoudiniEngineUtils::GetGenericAttributeList(
 	}
 
 	int32 FoundCount = 0;
-	for (int32 Idx = 0; Idx < AttribNameSHArray.Num(); ++Idx)
+	for (const FString& AttribName : AttribNameArray)
 	{
-		int32 AttribNameSH = (int32)AttribNameSHArray[Idx];
-		FString AttribName = TEXT("");
-		FHoudiniEngineString::ToFString(AttribNameSH, AttribName);
 		if (!AttribName.StartsWith(InGenericAttributePrefix, ESearchCase::IgnoreCase))
 			continue;
 
 		// Get the Attribute Info
 		HAPI_AttributeInfo AttribInfo;
-		FHoudiniApi::AttributeInfo_Init(&AttribInfo);
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			InGeoNodeId, InPartId,
-			TCHAR_TO_UTF8(*AttribName), AttributeOwner, &AttribInfo))
+		if (!FHoudiniEngineUtils::HapiGetAttributeInfo(
+			InGeoNodeId, InPartId, TCHAR_TO_UTF8(*AttribName), AttributeOwner, AttribInfo))
 		{
 			// failed to get that attribute's info
 			continue;
@@ -4822,6 +4813,10 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 	if (InNodeId < 0)
 		return false;
 
+	// Cooking will invalidate any cached attribute or string
+	FHoudiniPartAttributeCache::Empty();
+	FHoudiniEngineString::EmptyCache();
+
 	// No Cook Options were specified, use the default one
 	if (InCookOptions == nullptr)
 	{
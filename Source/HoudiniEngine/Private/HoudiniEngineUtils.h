@@ -169,6 +169,23 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			int32& FirstValidPrim,
 			const bool& isPackedPrim);
 
+		// HAPI : Get an attribute's info, checking all owners if InOwner is invalid.
+		// Uses FHoudiniPartAttributeCache when it is enabled.
+		static bool HapiGetAttributeInfo(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char * InAttribName,
+			const HAPI_AttributeOwner& InOwner,
+			HAPI_AttributeInfo& OutAttributeInfo);
+
+		// HAPI : Get the names of all the attributes of the given owner on a part.
+		// Uses FHoudiniPartAttributeCache when it is enabled.
+		static bool HapiGetAttributeNames(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const HAPI_AttributeOwner& InOwner,
+			TArray<FString>& OutAttributeNames);
+
 		// HAPI : Get attribute data as float.
 		static bool HapiGetAttributeDataAsFloat(
 			const HAPI_NodeId& InGeoId,
@@ -29,6 +29,7 @@
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniPartAttributeCache.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniPackageParams.h"
@@ -161,6 +162,9 @@ UHoudiniGeoImporter::BuildOutputsForNode(const HAPI_NodeId& InNodeId, TArray<UHo
 bool
 UHoudiniGeoImporter::CreateStaticMeshes(TArray<UHoudiniOutput*>& InOutputs, UObject* InParent, FHoudiniPackageParams InPackageParams)
 {
+	// The static meshes of all the outputs are built together once they have all been created
+	FHoudiniStaticMeshBuildBatchScope BuildBatchScope;
+
 	for (auto& CurOutput : InOutputs)
 	{
 		if (CurOutput->GetType() != EHoudiniOutputType::Mesh)
@@ -590,6 +594,9 @@ UHoudiniGeoImporter::ImportBGEOFile(const FString& InBGEOFile, UObject* InParent
 	HAPI_NodeId NodeId;
 	if (!LoadBGEOFileInHAPI(NodeId))
 		return false;
+
+	// The file node has been cooked, its parts' attributes can be cached while building the outputs
+	FHoudiniPartAttributeCacheScope AttributeCacheScope;
 	
 	// 4. Get the output from the file node
 	TArray<UHoudiniOutput*> NewOutputs;
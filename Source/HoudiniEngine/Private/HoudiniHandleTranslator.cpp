@@ -35,6 +35,7 @@
 #include "HoudiniEngineRuntimePrivatePCH.h"
 
 #include "HoudiniAssetComponent.h"
+#include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniParameter.h"
 #include "HoudiniHandleComponent.h"
 
@@ -335,6 +336,8 @@ FHoudiniHandleTranslator::UpdateTransformParameters(UHoudiniHandleComponent* Han
 	FMemory::Memzero< HAPI_Transform >(HapiXform);
 	FHoudiniEngineUtils::TranslateUnrealTransform(HandleComponent->GetRelativeTransform(), HapiXform);
 
+	// Handles are edited from the editor, outside of the manager's processing of their HAC
+	FHoudiniEngineSessionScope SessionScope(FHoudiniEngineRuntimeUtils::GetOwnerSessionIndex(HandleComponent));
 	const HAPI_Session * Session = FHoudiniEngine::Get().GetSession();
 
 	float HapiMatrix[16];
@@ -0,0 +1,346 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniInputNodeCache.h"
+
+#include "HoudiniEngine.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniApi.h"
+
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshSocket.h"
+#include "Engine/Level.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/Actor.h"
+#include "StaticMeshResources.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/Crc.h"
+
+TMap<TPair<int32, FString>, FHoudiniInputNodeCache::FSharedInputNode>
+FHoudiniInputNodeCache::SharedNodes;
+
+TMap<TPair<int32, HAPI_NodeId>, FHoudiniInputNodeCache::FUploadedStaticMesh>
+FHoudiniInputNodeCache::UploadedStaticMeshes;
+
+template<typename T>
+static uint32
+HashValue(const T& InValue, const uint32& InCrc)
+{
+	return FCrc::MemCrc32(&InValue, sizeof(T), InCrc);
+}
+
+FString
+FHoudiniInputNodeCache::GetStaticMeshKey(
+	const UStaticMesh* InStaticMesh, const UStaticMeshComponent* InStaticMeshComponent,
+	const bool& bExportLODs, const bool& bExportSockets, const bool& bExportColliders, const bool& bMaterialsAsIndices)
+{
+	if (!InStaticMesh || InStaticMesh->IsPendingKill() || !InStaticMesh->RenderData)
+		return FString();
+
+#if WITH_EDITORONLY_DATA
+	// The render data's key identifies the mesh descriptions and build settings of all the LODs
+	const FString& DerivedDataKey = InStaticMesh->RenderData->DerivedDataKey;
+#else
+	const FString DerivedDataKey;
+#endif
+	if (DerivedDataKey.IsEmpty())
+		return FString();
+
+	// Hash the rest of the uploaded data, that isn't part of the render data
+	uint32 Crc = FCrc::StrCrc32(*DerivedDataKey);
+	for (const FStaticMaterial& StaticMaterial : InStaticMesh->StaticMaterials)
+	{
+		if (StaticMaterial.MaterialInterface)
+			Crc = FCrc::StrCrc32(*StaticMaterial.MaterialInterface->GetPathName(), Crc);
+		Crc = FCrc::StrCrc32(*StaticMaterial.MaterialSlotName.ToString(), Crc);
+	}
+
+	Crc = HashValue(InStaticMesh->LightMapResolution, Crc);
+	Crc = HashValue(InStaticMesh->bAutoComputeLODScreenSize, Crc);
+	for (int32 LODIndex = 0; LODIndex < InStaticMesh->GetNumSourceModels(); LODIndex++)
+		Crc = HashValue(InStaticMesh->GetSourceModel(LODIndex).ScreenSize.Default, Crc);
+
+	// The LODs, sockets and colliders
+	Crc = HashValue(GetStaticMeshNetworkHash(InStaticMesh, bExportLODs, bExportSockets, bExportColliders), Crc);
+
+	// Component exports also upload the component's materials and vertex colors overrides, and the component/actor tags and paths
+	FString ComponentPath;
+	if (InStaticMeshComponent)
+	{
+		if (InStaticMeshComponent->IsPendingKill())
+			return FString();
+
+		ComponentPath = InStaticMeshComponent->GetPathName();
+		for (int32 MaterialIndex = 0; MaterialIndex < InStaticMeshComponent->GetNumMaterials(); MaterialIndex++)
+		{
+			UMaterialInterface* Material = InStaticMeshComponent->GetMaterial(MaterialIndex);
+			if (Material)
+				Crc = FCrc::StrCrc32(*Material->GetPathName(), Crc);
+		}
+
+		for (const FStaticMeshComponentLODInfo& LODInfo : InStaticMeshComponent->LODData)
+		{
+			const FColorVertexBuffer* OverrideColors = LODInfo.OverrideVertexColors;
+			if (!OverrideColors || OverrideColors->GetNumVertices() <= 0)
+				continue;
+
+			// We need the CPU copy of the colors to identify them
+			const void* ColorData = OverrideColors->GetVertexData();
+			if (!ColorData)
+				return FString();
+
+			Crc = FCrc::MemCrc32(ColorData, OverrideColors->GetNumVertices() * sizeof(FColor), Crc);
+		}
+
+		for (const FName& Tag : InStaticMeshComponent->ComponentTags)
+			Crc = FCrc::StrCrc32(*Tag.ToString(), Crc);
+
+		const AActor* ParentActor = InStaticMeshComponent->GetOwner();
+		if (ParentActor)
+		{
+			for (const FName& Tag : ParentActor->Tags)
+				Crc = FCrc::StrCrc32(*Tag.ToString(), Crc);
+
+			Crc = FCrc::StrCrc32(*ParentActor->GetPathName(), Crc);
+			if (const ULevel* Level = ParentActor->GetLevel())
+				Crc = FCrc::StrCrc32(*Level->GetPathName(), Crc);
+		}
+	}
+
+	return FString::Printf(
+		TEXT("%s|%s|%d%d%d%d|%08x"), *InStaticMesh->GetPathName(), *ComponentPath,
+		bExportLODs ? 1 : 0, bExportSockets ? 1 : 0, bExportColliders ? 1 : 0, bMaterialsAsIndices ? 1 : 0, Crc);
+}
+
+uint32
+FHoudiniInputNodeCache::GetStaticMeshNetworkHash(
+	const UStaticMesh* InStaticMesh, const bool& bExportLODs, const bool& bExportSockets, const bool& bExportColliders)
+{
+	if (!InStaticMesh || InStaticMesh->IsPendingKill())
+		return 0;
+
+	// Each exported LOD has its own node
+	uint32 Crc = HashValue(bExportLODs ? InStaticMesh->GetNumLODs() : 1, 0);
+
+	// The sockets and colliders nodes are rebuilt when they change
+	if (bExportSockets)
+	{
+		for (const UStaticMeshSocket* Socket : InStaticMesh->Sockets)
+		{
+			if (!Socket)
+				continue;
+
+			Crc = FCrc::StrCrc32(*Socket->SocketName.ToString(), Crc);
+			Crc = FCrc::StrCrc32(*Socket->Tag, Crc);
+			Crc = HashValue(Socket->RelativeLocation, Crc);
+			Crc = HashValue(Socket->RelativeRotation, Crc);
+			Crc = HashValue(Socket->RelativeScale, Crc);
+		}
+	}
+
+	if (bExportColliders && InStaticMesh->BodySetup)
+	{
+		const FKAggregateGeom& AggGeom = InStaticMesh->BodySetup->AggGeom;
+		for (const FKBoxElem& Box : AggGeom.BoxElems)
+		{
+			Crc = HashValue(Box.Center, Crc);
+			Crc = HashValue(Box.Rotation, Crc);
+			Crc = HashValue(FVector(Box.X, Box.Y, Box.Z), Crc);
+		}
+
+		for (const FKSphereElem& Sphere : AggGeom.SphereElems)
+		{
+			Crc = HashValue(Sphere.Center, Crc);
+			Crc = HashValue(Sphere.Radius, Crc);
+		}
+
+		for (const FKSphylElem& Sphyl : AggGeom.SphylElems)
+		{
+			Crc = HashValue(Sphyl.Center, Crc);
+			Crc = HashValue(Sphyl.Rotation, Crc);
+			Crc = HashValue(Sphyl.Radius, Crc);
+			Crc = HashValue(Sphyl.Length, Crc);
+		}
+
+		for (const FKConvexElem& Convex : AggGeom.ConvexElems)
+		{
+			Crc = FCrc::MemCrc32(Convex.VertexData.GetData(), Convex.VertexData.Num() * sizeof(FVector), Crc);
+			Crc = HashValue(Convex.GetTransform().GetTranslation(), Crc);
+			Crc = HashValue(Convex.GetTransform().GetRotation(), Crc);
+			Crc = HashValue(Convex.GetTransform().GetScale3D(), Crc);
+		}
+	}
+
+	return Crc;
+}
+
+bool
+FHoudiniInputNodeCache::SplitKey(const FString& InKey, FString& OutSource, FString& OutDataHash)
+{
+	return InKey.Split(TEXT("|"), &OutSource, &OutDataHash, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+}
+
+bool
+FHoudiniInputNodeCache::HaveSameSource(const FString& InKeyA, const FString& InKeyB)
+{
+	FString SourceA, SourceB, DataHash;
+	if (!SplitKey(InKeyA, SourceA, DataHash) || !SplitKey(InKeyB, SourceB, DataHash))
+		return false;
+
+	return SourceA.Equals(SourceB);
+}
+
+bool
+FHoudiniInputNodeCache::FindNode(const FString& InKey, HAPI_NodeId& OutNodeId)
+{
+	if (InKey.IsEmpty())
+		return false;
+
+	const TPair<int32, FString> SessionKey(FHoudiniEngine::GetCurrentSessionIndex(), InKey);
+	FSharedInputNode* SharedNode = SharedNodes.Find(SessionKey);
+	if (!SharedNode)
+		return false;
+
+	// The node might have been deleted in the session
+	if (!FHoudiniEngineUtils::IsHoudiniNodeValid(SharedNode->NodeId))
+	{
+		SharedNodes.Remove(SessionKey);
+		return false;
+	}
+
+	OutNodeId = SharedNode->NodeId;
+	return true;
+}
+
+void
+FHoudiniInputNodeCache::AddNode(const FString& InKey, const HAPI_NodeId& InNodeId)
+{
+	if (InKey.IsEmpty() || InNodeId < 0)
+		return;
+
+	FSharedInputNode& SharedNode = SharedNodes.FindOrAdd(TPair<int32, FString>(FHoudiniEngine::GetCurrentSessionIndex(), InKey));
+	SharedNode.NodeId = InNodeId;
+}
+
+void
+FHoudiniInputNodeCache::AddUser(const FString& InKey, const HAPI_NodeId& InUserNodeId)
+{
+	FSharedInputNode* SharedNode = SharedNodes.Find(TPair<int32, FString>(FHoudiniEngine::GetCurrentSessionIndex(), InKey));
+	if (SharedNode && InUserNodeId >= 0)
+		SharedNode->UserNodeIds.AddUnique(InUserNodeId);
+}
+
+bool
+FHoudiniInputNodeCache::FindUserNode(const HAPI_NodeId& InUserNodeId, FString& OutKey, HAPI_NodeId& OutNodeId)
+{
+	const int32 SessionIndex = FHoudiniEngine::GetCurrentSessionIndex();
+	for (const auto& Pair : SharedNodes)
+	{
+		if (Pair.Key.Key != SessionIndex || !Pair.Value.UserNodeIds.Contains(InUserNodeId))
+			continue;
+
+		OutKey = Pair.Key.Value;
+		OutNodeId = Pair.Value.NodeId;
+		return true;
+	}
+
+	return false;
+}
+
+void
+FHoudiniInputNodeCache::UpdateNodeKey(const FString& InKey, const FString& InNewKey)
+{
+	const int32 SessionIndex = FHoudiniEngine::GetCurrentSessionIndex();
+	FSharedInputNode SharedNode;
+	if (!SharedNodes.RemoveAndCopyValue(TPair<int32, FString>(SessionIndex, InKey), SharedNode))
+		return;
+
+	SharedNodes.Add(TPair<int32, FString>(SessionIndex, InNewKey), MoveTemp(SharedNode));
+}
+
+void
+FHoudiniInputNodeCache::RemoveNode(const HAPI_NodeId& InNodeId)
+{
+	if (InNodeId < 0)
+		return;
+
+	const int32 SessionIndex = FHoudiniEngine::GetCurrentSessionIndex();
+	UploadedStaticMeshes.Remove(TPair<int32, HAPI_NodeId>(SessionIndex, InNodeId));
+
+	for (auto It = SharedNodes.CreateIterator(); It; ++It)
+	{
+		if (It->Key.Key != SessionIndex || It->Value.UserNodeIds.Remove(InNodeId) <= 0)
+			continue;
+
+		if (It->Value.UserNodeIds.Num() <= 0)
+		{
+			ReleaseNode(SessionIndex, It->Value);
+			It.RemoveCurrent();
+		}
+
+		// Nodes merge a single shared node
+		break;
+	}
+}
+
+void
+FHoudiniInputNodeCache::SetUploadedStaticMesh(const HAPI_NodeId& InNodeId, const FUploadedStaticMesh& InUploadedStaticMesh)
+{
+	if (InNodeId < 0)
+		return;
+
+	UploadedStaticMeshes.Add(TPair<int32, HAPI_NodeId>(FHoudiniEngine::GetCurrentSessionIndex(), InNodeId), InUploadedStaticMesh);
+}
+
+FHoudiniInputNodeCache::FUploadedStaticMesh*
+FHoudiniInputNodeCache::FindUploadedStaticMesh(const HAPI_NodeId& InNodeId)
+{
+	return UploadedStaticMeshes.Find(TPair<int32, HAPI_NodeId>(FHoudiniEngine::GetCurrentSessionIndex(), InNodeId));
+}
+
+void
+FHoudiniInputNodeCache::Empty()
+{
+	SharedNodes.Empty();
+	UploadedStaticMeshes.Empty();
+}
+
+void
+FHoudiniInputNodeCache::ReleaseNode(const int32& InSessionIndex, const FSharedInputNode& InSharedNode)
+{
+	if (InSharedNode.NodeId < 0)
+		return;
+
+	UploadedStaticMeshes.Remove(TPair<int32, HAPI_NodeId>(InSessionIndex, InSharedNode.NodeId));
+
+	if (!FHoudiniEngineRuntime::IsInitialized())
+		return;
+
+	// Delete the shared node and its OBJ node
+	FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InSharedNode.NodeId, true, InSessionIndex);
+}
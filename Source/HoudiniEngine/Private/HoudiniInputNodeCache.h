@@ -0,0 +1,137 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "CoreMinimal.h"
+
+class UStaticMesh;
+class UStaticMeshComponent;
+
+// Hashes of the data streams uploaded for a static mesh LOD, so only the streams that changed are uploaded again.
+// The geometry hash covers the positions, triangles and every other attribute/group of the LOD:
+// when it changes, the whole LOD is uploaded again.
+struct HOUDINIENGINE_API FHoudiniMeshStreamHashes
+{
+	uint32 Geometry = 0;
+	uint32 Normals = 0;
+	uint32 UVs = 0;
+	uint32 Colors = 0;
+	uint32 Materials = 0;
+
+	// False if the data couldn't be hashed, or hasn't been uploaded
+	bool bValid = false;
+};
+
+// Shares the input nodes created for static meshes between all the inputs using the same mesh,
+// so a mesh used by many inputs/HDAs is only uploaded once per session (see FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh).
+//
+// Shared nodes are identified by the mesh's path, export options and a hash of the uploaded data.
+// The same keys are used to know what has been uploaded to the other static mesh input nodes.
+// Each input object merges the shared node in its own node: these are the shared node's users.
+// A shared node is kept as long as it has users: the paths deleting input nodes (input cleanup, node replacement
+// and the manager's pending deletes) unregister them, and the last one marks the shared node as pending delete.
+// The cache also keeps what has been uploaded to each static mesh input node (its LOD nodes and their streams),
+// so a mesh whose data changed can be updated in its existing nodes.
+// The cache is emptied when the sessions are stopped, and should only be used on the game thread.
+class HOUDINIENGINE_API FHoudiniInputNodeCache
+{
+	public:
+
+		// Returns the key identifying the data uploaded for a static mesh (and its component if any),
+		// an empty key if the data can't be identified.
+		static FString GetStaticMeshKey(
+			const UStaticMesh* InStaticMesh, const UStaticMeshComponent* InStaticMeshComponent,
+			const bool& bExportLODs, const bool& bExportSockets, const bool& bExportColliders, const bool& bMaterialsAsIndices);
+
+		// Returns true if the keys are for the same mesh/component and export options, regardless of their data.
+		static bool HaveSameSource(const FString& InKeyA, const FString& InKeyB);
+
+		// Looks for a valid shared node in the current session.
+		static bool FindNode(const FString& InKey, HAPI_NodeId& OutNodeId);
+
+		// Adds a shared node that has just been created in the current session.
+		static void AddNode(const FString& InKey, const HAPI_NodeId& InNodeId);
+
+		// Registers a node merging a shared node of the current session.
+		static void AddUser(const FString& InKey, const HAPI_NodeId& InUserNodeId);
+
+		// Looks for the shared node merged by a node of the current session.
+		static bool FindUserNode(const HAPI_NodeId& InUserNodeId, FString& OutKey, HAPI_NodeId& OutNodeId);
+
+		// Changes the key of a shared node of the current session, after its data has been updated.
+		static void UpdateNodeKey(const FString& InKey, const FString& InNewKey);
+
+		// Forgets a node of the current session that is being deleted.
+		// If it was merging a shared node, the shared node is released when it doesn't have any user left.
+		static void RemoveNode(const HAPI_NodeId& InNodeId);
+
+		// What has been uploaded to a static mesh input node: the merge node, or the single input node.
+		struct FUploadedStaticMesh
+		{
+			// Hash of what the merge network is made of, see GetStaticMeshNetworkHash()
+			uint32 NetworkHash = 0;
+			// Node each LOD has been uploaded to
+			TArray<HAPI_NodeId> LODNodeIds;
+			// Streams uploaded to each LOD node
+			TArray<FHoudiniMeshStreamHashes> LODStreams;
+		};
+
+		// Returns a hash of the nodes created for a static mesh: its exported LODs, sockets and colliders.
+		// The LODs' data can be updated in place as long as this hash doesn't change.
+		static uint32 GetStaticMeshNetworkHash(
+			const UStaticMesh* InStaticMesh, const bool& bExportLODs, const bool& bExportSockets, const bool& bExportColliders);
+
+		// Records what has been uploaded to a static mesh input node of the current session.
+		static void SetUploadedStaticMesh(const HAPI_NodeId& InNodeId, const FUploadedStaticMesh& InUploadedStaticMesh);
+
+		// Looks for what has been uploaded to a static mesh input node of the current session.
+		static FUploadedStaticMesh* FindUploadedStaticMesh(const HAPI_NodeId& InNodeId);
+
+		// Removes all the shared nodes, needs to be called when the sessions are stopped.
+		static void Empty();
+
+	private:
+
+		struct FSharedInputNode
+		{
+			HAPI_NodeId NodeId = -1;
+			TArray<HAPI_NodeId> UserNodeIds;
+		};
+
+		// Splits a key in its source (mesh/component and export options) and data hash
+		static bool SplitKey(const FString& InKey, FString& OutSource, FString& OutDataHash);
+
+		// Marks a shared node of the given session as pending delete
+		static void ReleaseNode(const int32& InSessionIndex, const FSharedInputNode& InSharedNode);
+
+		// Shared nodes, per session index and key
+		static TMap<TPair<int32, FString>, FSharedInputNode> SharedNodes;
+
+		// Data uploaded to the static mesh input nodes, per session index and node id
+		static TMap<TPair<int32, HAPI_NodeId>, FUploadedStaticMesh> UploadedStaticMeshes;
+};
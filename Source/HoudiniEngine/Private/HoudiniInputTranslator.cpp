@@ -36,6 +36,7 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniSplineComponent.h"
 #include "HoudiniInputObject.h"
+#include "HoudiniInputNodeCache.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniSplineTranslator.h"
@@ -401,6 +402,7 @@ FHoudiniInputTranslator::DestroyInputNodes(UHoudiniInput* InputToDestroy, const
 
 			if (CurInputObject->InputNodeId >= 0)
 			{
+				FHoudiniInputNodeCache::RemoveNode(CurInputObject->InputNodeId);
 				FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), CurInputObject->InputNodeId);
 				CurInputObject->InputNodeId = -1;
 			}
@@ -1772,7 +1774,7 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh(
 		else 
 		{
 			bSuccess = FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
-				SM, InObject->InputNodeId, SMName, nullptr, bExportLODs, bExportSockets, bExportColliders);
+				SM, InObject->InputNodeId, SMName, nullptr, bExportLODs, bExportSockets, bExportColliders, &InObject->UploadedDataKey);
 		}
 	}
 
@@ -1891,7 +1893,7 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMeshComponent(
 	else 
 	{
 		bSuccess = FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
-			SM, InObject->InputNodeId, SMCName, SMC, bExportLODs, bExportSockets, bExportColliders);
+			SM, InObject->InputNodeId, SMCName, SMC, bExportLODs, bExportSockets, bExportColliders, &InObject->UploadedDataKey);
 	}
 
 	InObject->SetImportAsReference(bImportAsReference);
@@ -2068,6 +2070,9 @@ HapiCreateInputNodeForHoudiniAssetComponent(const FString& InObjNodeName, UHoudi
 		// Get the parent OBJ node ID before deleting!
 		HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(PreviousInputNodeId);
 
+		// The previous node might have been merging a shared static mesh node
+		FHoudiniInputNodeCache::RemoveNode(PreviousInputNodeId);
+
 		if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
 			FHoudiniEngine::Get().GetSession(), PreviousInputNodeId))
 		{
@@ -2132,6 +2137,7 @@ HapiCreateInputNodeForHoudiniAssetComponent(const FString& InObjNodeName, UHoudi
 	{
 		// If the input HAC needs to be instantiated, tell it do so
 		InputHAC->AssetState = EHoudiniAssetState::PreInstantiation;
+		InputHAC->MarkAsNeedProcessing();
 		// Mark this object's input as changed so we can properly update after the input HDA's done instantiating/cooking
 		HoudiniInput->MarkChanged(true);
 	}
@@ -2186,8 +2192,11 @@ FHoudiniInputTranslator::HapiCreateInputNodeForActor(
 				const bool bIsHoudiniCookedDataAvailable = HAC->IsHoudiniCookedDataAvailable(bPendingDeleteOrRebuild, bInvalidState);
 				if (bIsHoudiniCookedDataAvailable)
 				{
-					// Build the static mesh
-					FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(HAC);
+					// Build the static mesh, using the input HAC's session rather than ours
+					{
+						FHoudiniEngineSessionScope SessionScope(HAC->GetSessionIndex());
+						FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(HAC);
+					}
 					// Update the input object since a new StaticMeshComponent could have been created
 					UObject *InputObject = InObject->GetObject();
 					if (InputObject && !InputObject->IsPendingKill())
@@ -2467,9 +2476,11 @@ FHoudiniInputTranslator::UpdateWorldInput(UHoudiniInput* InInput)
 		return false;
 
 	bool bHasChanged = false;
-	if (InInput->IsWorldInputBoundSelector() && InInput->GetWorldInputBoundSelectorAutoUpdates())
+	if (InInput->IsWorldInputBoundSelector() 
+		&& (InInput->GetWorldInputBoundSelectorAutoUpdates()
+			|| (InInput->GetWorldInputBoundSelectorUpdateOnMove() && InInput->HaveBoundSelectorsMoved())))
 	{
-		// If the input is in bound selector mode, and auto-update is enabled
+		// If the input is in bound selector mode, and auto-update is enabled (or the bound selectors have moved)
 		// update the actors selected by the bounds first
 		bHasChanged = InInput->UpdateWorldSelectionFromBoundSelectors();
 	}
@@ -2609,6 +2620,9 @@ FHoudiniInputTranslator::CreateInputNodeForReference(
 		// Get the parent OBJ node ID before deleting!
 		HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(PreviousInputNodeId);
 
+		// The previous node might have been merging a shared static mesh node
+		FHoudiniInputNodeCache::RemoveNode(PreviousInputNodeId);
+
 		if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
 			FHoudiniEngine::Get().GetSession(), PreviousInputNodeId))
 		{
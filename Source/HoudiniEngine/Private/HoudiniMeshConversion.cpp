@@ -0,0 +1,336 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniMeshConversion.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Math/RandomStream.h"
+
+// Number of elements converted by each ParallelFor batch, needs to be a multiple of 4
+#define HOUDINI_MESH_CONVERSION_BATCH_SIZE 16384
+
+// Default number of vertices used by the Houdini.BenchmarkMeshConversion command
+#define HOUDINI_MESH_CONVERSION_BENCHMARK_VERTICES 10000000
+
+// Runs InBody(Start, End) on batches of the [0, InNum[ range, in parallel if there's more than one batch
+template<typename TBody>
+static void
+ParallelForBatches(const int32& InNum, const TBody& InBody)
+{
+	const int32 NumBatches = FMath::DivideAndRoundUp(InNum, HOUDINI_MESH_CONVERSION_BATCH_SIZE);
+	ParallelFor(NumBatches, [&](int32 BatchIdx)
+	{
+		const int32 Start = BatchIdx * HOUDINI_MESH_CONVERSION_BATCH_SIZE;
+		const int32 End = FMath::Min(Start + HOUDINI_MESH_CONVERSION_BATCH_SIZE, InNum);
+		InBody(Start, End);
+	}, NumBatches <= 1);
+}
+
+// Converts a single packed float3 vector
+static FORCEINLINE void
+ConvertVector(const float* InVector, float* OutVector, const float& InScale)
+{
+	OutVector[0] = InVector[0] * InScale;
+	OutVector[1] = InVector[2] * InScale;
+	OutVector[2] = InVector[1] * InScale;
+}
+
+// Converts 4 packed float3 vectors (12 floats) using 3 vector registers
+static FORCEINLINE void
+ConvertVectors4(const float* InVectors, float* OutVectors, const VectorRegister& InScale)
+{
+	// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3  =>  x0 z0 y0 x1 | z1 y1 x2 z2 | y2 x3 z3 y3
+	const VectorRegister A = VectorLoad(InVectors);
+	const VectorRegister B = VectorLoad(InVectors + 4);
+	const VectorRegister C = VectorLoad(InVectors + 8);
+
+	const VectorRegister OutA = VectorSwizzle(A, 0, 2, 1, 3);
+	const VectorRegister TmpB = VectorShuffle(B, C, 2, 3, 0, 0);
+	const VectorRegister OutB = VectorShuffle(B, TmpB, 1, 0, 0, 2);
+	const VectorRegister TmpC = VectorShuffle(B, C, 3, 3, 1, 3);
+	const VectorRegister OutC = VectorShuffle(TmpC, C, 0, 2, 3, 2);
+
+	VectorStore(VectorMultiply(OutA, InScale), OutVectors);
+	VectorStore(VectorMultiply(OutB, InScale), OutVectors + 4);
+	VectorStore(VectorMultiply(OutC, InScale), OutVectors + 8);
+}
+
+int32
+FHoudiniMeshConversion::GatherPositions(
+	const TArray<float>& InPositions, const TArray<int32>& InNeededPoints, TArray<FVector>& OutPositions)
+{
+	const int32 NumPoints = InNeededPoints.Num();
+	const int32 NumPartPoints = InPositions.Num() / 3;
+	OutPositions.SetNumUninitialized(NumPoints);
+
+	const float* Src = InPositions.GetData();
+	const int32* NeededPoints = InNeededPoints.GetData();
+	float* Dst = reinterpret_cast<float*>(OutPositions.GetData());
+
+	FThreadSafeCounter InvalidCount;
+	ParallelForBatches(NumPoints, [&](const int32& Start, const int32& End)
+	{
+		int32 BatchInvalidCount = 0;
+		for (int32 Idx = Start; Idx < End; Idx++)
+		{
+			const int32 PointIdx = NeededPoints[Idx];
+			if (PointIdx < 0 || PointIdx >= NumPartPoints)
+			{
+				OutPositions[Idx] = FVector::ZeroVector;
+				BatchInvalidCount++;
+				continue;
+			}
+
+			ConvertVector(Src + PointIdx * 3, Dst + Idx * 3, HAPI_UNREAL_SCALE_FACTOR_POSITION);
+		}
+
+		if (BatchInvalidCount > 0)
+			InvalidCount.Add(BatchInvalidCount);
+	});
+
+	return InvalidCount.GetValue();
+}
+
+void
+FHoudiniMeshConversion::ConvertVectors(
+	const TArray<float>& InVectors, TArray<FVector>& OutVectors, const bool& bReverseWinding, const float& InScale)
+{
+	int32 NumVectors = InVectors.Num() / 3;
+	if (bReverseWinding)
+		NumVectors -= NumVectors % 3;
+
+	OutVectors.SetNumUninitialized(NumVectors);
+	if (NumVectors <= 0)
+		return;
+
+	const float* Src = InVectors.GetData();
+	float* Dst = reinterpret_cast<float*>(OutVectors.GetData());
+	if (!bReverseWinding)
+	{
+		const VectorRegister Scale = VectorSetFloat1(InScale);
+		ParallelForBatches(NumVectors, [&](const int32& Start, const int32& End)
+		{
+			int32 Idx = Start;
+			for (; Idx + 4 <= End; Idx += 4)
+				ConvertVectors4(Src + Idx * 3, Dst + Idx * 3, Scale);
+
+			for (; Idx < End; Idx++)
+				ConvertVector(Src + Idx * 3, Dst + Idx * 3, InScale);
+		});
+	}
+	else
+	{
+		ParallelForBatches(NumVectors / 3, [&](const int32& Start, const int32& End)
+		{
+			for (int32 TriIdx = Start; TriIdx < End; TriIdx++)
+			{
+				const float* SrcTriangle = Src + TriIdx * 9;
+				float* DstTriangle = Dst + TriIdx * 9;
+				ConvertVector(SrcTriangle + 0, DstTriangle + 0, InScale);
+				ConvertVector(SrcTriangle + 3, DstTriangle + 6, InScale);
+				ConvertVector(SrcTriangle + 6, DstTriangle + 3, InScale);
+			}
+		});
+	}
+}
+
+void
+FHoudiniMeshConversion::ConvertUVs(
+	const TArray<float>& InUVs, TArray<FVector2D>& OutUVs, const bool& bReverseWinding)
+{
+	int32 NumUVs = InUVs.Num() / 2;
+	if (bReverseWinding)
+		NumUVs -= NumUVs % 3;
+
+	OutUVs.SetNumUninitialized(NumUVs);
+	if (NumUVs <= 0)
+		return;
+
+	const float* Src = InUVs.GetData();
+	float* Dst = reinterpret_cast<float*>(OutUVs.GetData());
+	if (!bReverseWinding)
+	{
+		// V => 1 - V, two UVs at a time
+		const VectorRegister FlipMul = MakeVectorRegister(1.0f, -1.0f, 1.0f, -1.0f);
+		const VectorRegister FlipAdd = MakeVectorRegister(0.0f, 1.0f, 0.0f, 1.0f);
+		ParallelForBatches(NumUVs, [&](const int32& Start, const int32& End)
+		{
+			int32 Idx = Start;
+			for (; Idx + 2 <= End; Idx += 2)
+				VectorStore(VectorMultiplyAdd(VectorLoad(Src + Idx * 2), FlipMul, FlipAdd), Dst + Idx * 2);
+
+			for (; Idx < End; Idx++)
+			{
+				Dst[Idx * 2 + 0] = Src[Idx * 2 + 0];
+				Dst[Idx * 2 + 1] = 1.0f - Src[Idx * 2 + 1];
+			}
+		});
+	}
+	else
+	{
+		ParallelForBatches(NumUVs / 3, [&](const int32& Start, const int32& End)
+		{
+			const int32 Corners[3] = { 0, 2, 1 };
+			for (int32 TriIdx = Start; TriIdx < End; TriIdx++)
+			{
+				for (int32 Corner = 0; Corner < 3; Corner++)
+				{
+					const int32 SrcIdx = (TriIdx * 3 + Corner) * 2;
+					const int32 DstIdx = (TriIdx * 3 + Corners[Corner]) * 2;
+					Dst[DstIdx + 0] = Src[SrcIdx + 0];
+					Dst[DstIdx + 1] = 1.0f - Src[SrcIdx + 1];
+				}
+			}
+		});
+	}
+}
+
+void
+FHoudiniMeshConversion::RunBenchmark(const int32& InNumVertices)
+{
+	const int32 NumVertices = FMath::Max(InNumVertices - InNumVertices % 3, 3);
+
+	// Generate the source buffers: shuffled points, per vertex normals and uvs
+	FRandomStream RandomStream(0x48454e47);
+	TArray<float> Positions;
+	Positions.SetNumUninitialized(NumVertices * 3);
+	for (float& Value : Positions)
+		Value = RandomStream.FRandRange(-100.0f, 100.0f);
+
+	TArray<int32> NeededPoints;
+	NeededPoints.SetNumUninitialized(NumVertices);
+	for (int32 Idx = 0; Idx < NumVertices; Idx++)
+		NeededPoints[Idx] = Idx;
+	for (int32 Idx = NumVertices - 1; Idx > 0; Idx--)
+		NeededPoints.Swap(Idx, RandomStream.RandRange(0, Idx));
+
+	TArray<float> Normals;
+	Normals.SetNumUninitialized(NumVertices * 3);
+	for (float& Value : Normals)
+		Value = RandomStream.FRandRange(-1.0f, 1.0f);
+
+	TArray<float> UVs;
+	UVs.SetNumUninitialized(NumVertices * 2);
+	for (float& Value : UVs)
+		Value = RandomStream.FRand();
+
+	auto LogTimings = [](const TCHAR* InName, const double& InScalarTime, const double& InKernelTime, const bool& bMatch)
+	{
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Mesh conversion benchmark - %s: scalar %.2fms, kernel %.2fms (x%.1f)%s"),
+			InName, InScalarTime * 1000.0, InKernelTime * 1000.0,
+			InKernelTime > 0.0 ? InScalarTime / InKernelTime : 0.0,
+			bMatch ? TEXT("") : TEXT(" - RESULTS DIFFER"));
+	};
+
+	TArray<FVector> ScalarVectors;
+	TArray<FVector> KernelVectors;
+	TArray<FVector2D> ScalarUVs;
+	TArray<FVector2D> KernelUVs;
+	double Tick = 0.0;
+	double ScalarTime = 0.0;
+
+	// Positions
+	Tick = FPlatformTime::Seconds();
+	ScalarVectors.SetNumUninitialized(NumVertices);
+	for (int32 Idx = 0; Idx < NumVertices; Idx++)
+	{
+		const int32 PointIdx = NeededPoints[Idx];
+		ScalarVectors[Idx].X = Positions[PointIdx * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		ScalarVectors[Idx].Y = Positions[PointIdx * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		ScalarVectors[Idx].Z = Positions[PointIdx * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+	}
+	ScalarTime = FPlatformTime::Seconds() - Tick;
+
+	Tick = FPlatformTime::Seconds();
+	GatherPositions(Positions, NeededPoints, KernelVectors);
+	LogTimings(TEXT("Positions"), ScalarTime, FPlatformTime::Seconds() - Tick, ScalarVectors == KernelVectors);
+
+	// Normals
+	Tick = FPlatformTime::Seconds();
+	for (int32 Idx = 0; Idx < NumVertices; Idx++)
+	{
+		ScalarVectors[Idx].X = Normals[Idx * 3 + 0];
+		ScalarVectors[Idx].Y = Normals[Idx * 3 + 2];
+		ScalarVectors[Idx].Z = Normals[Idx * 3 + 1];
+	}
+	ScalarTime = FPlatformTime::Seconds() - Tick;
+
+	Tick = FPlatformTime::Seconds();
+	ConvertVectors(Normals, KernelVectors);
+	LogTimings(TEXT("Normals"), ScalarTime, FPlatformTime::Seconds() - Tick, ScalarVectors == KernelVectors);
+
+	// Normals with winding order
+	Tick = FPlatformTime::Seconds();
+	const int32 TriWindingIndex[3] = { 0, 2, 1 };
+	for (int32 Idx = 0; Idx < NumVertices; Idx++)
+	{
+		const int32 DstIdx = Idx - Idx % 3 + TriWindingIndex[Idx % 3];
+		ScalarVectors[DstIdx].X = Normals[Idx * 3 + 0];
+		ScalarVectors[DstIdx].Y = Normals[Idx * 3 + 2];
+		ScalarVectors[DstIdx].Z = Normals[Idx * 3 + 1];
+	}
+	ScalarTime = FPlatformTime::Seconds() - Tick;
+
+	Tick = FPlatformTime::Seconds();
+	ConvertVectors(Normals, KernelVectors, true);
+	LogTimings(TEXT("Normals (winding)"), ScalarTime, FPlatformTime::Seconds() - Tick, ScalarVectors == KernelVectors);
+
+	// UVs
+	Tick = FPlatformTime::Seconds();
+	ScalarUVs.SetNumUninitialized(NumVertices);
+	for (int32 Idx = 0; Idx < NumVertices; Idx++)
+	{
+		ScalarUVs[Idx].X = UVs[Idx * 2 + 0];
+		ScalarUVs[Idx].Y = 1.0f - UVs[Idx * 2 + 1];
+	}
+	ScalarTime = FPlatformTime::Seconds() - Tick;
+
+	Tick = FPlatformTime::Seconds();
+	ConvertUVs(UVs, KernelUVs);
+	LogTimings(TEXT("UVs"), ScalarTime, FPlatformTime::Seconds() - Tick, ScalarUVs == KernelUVs);
+}
+
+static void
+HoudiniBenchmarkMeshConversionCommand(const TArray<FString>& Args)
+{
+	int32 NumVertices = HOUDINI_MESH_CONVERSION_BENCHMARK_VERTICES;
+	if (Args.Num() > 0 && Args[0].IsNumeric())
+		NumVertices = FCString::Atoi(*Args[0]);
+
+	FHoudiniMeshConversion::RunBenchmark(NumVertices);
+}
+
+static FAutoConsoleCommand CCmdHoudiniBenchmarkMeshConversion(
+	TEXT("Houdini.BenchmarkMeshConversion"),
+	TEXT("Compares the mesh coordinate conversion kernels to scalar loops and logs the timings.\n")
+	TEXT("Houdini.BenchmarkMeshConversion [NumVertices]: defaults to 10M vertices, allocates around 100 bytes per vertex.\n"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&HoudiniBenchmarkMeshConversionCommand));
@@ -0,0 +1,60 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Kernels converting the geometry buffers received from HAPI to Unreal's coordinate space.
+//
+// Houdini is Y-up and uses meters, Unreal is Z-up and uses centimeters: vectors have their Y and Z components swapped,
+// positions are also scaled by HAPI_UNREAL_SCALE_FACTOR_POSITION, and the V coordinate of the UVs is flipped.
+// Large buffers are processed in batches with ParallelFor, contiguous buffers are converted 4 elements at a time
+// with the VectorRegister intrinsics.
+//
+// When bReverseWinding is true, the input buffers are per triangle vertex data and the output has the
+// corners 1 and 2 of each triangle swapped to match Unreal's winding order.
+struct HOUDINIENGINE_API FHoudiniMeshConversion
+{
+	public:
+
+		// Gathers the positions of the needed points (InNeededPoints[NewIndex] => PartIndex) from the part's packed positions.
+		// Invalid indices get a zero position, returns the number of invalid indices.
+		static int32 GatherPositions(
+			const TArray<float>& InPositions, const TArray<int32>& InNeededPoints, TArray<FVector>& OutPositions);
+
+		// Converts packed float3 vectors (normals, tangents..).
+		static void ConvertVectors(
+			const TArray<float>& InVectors, TArray<FVector>& OutVectors,
+			const bool& bReverseWinding = false, const float& InScale = 1.0f);
+
+		// Converts packed float2 UVs.
+		static void ConvertUVs(
+			const TArray<float>& InUVs, TArray<FVector2D>& OutUVs, const bool& bReverseWinding = false);
+
+		// Compares the kernels to the equivalent scalar loops on generated buffers and logs the timings.
+		static void RunBenchmark(const int32& InNumVertices);
+};
@@ -33,11 +33,13 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineOutputStats.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniMaterialTranslator.h"
 #include "HoudiniAssetActor.h"
 
 #include "HoudiniStaticMesh.h"
+#include "HoudiniMeshConversion.h"
 #include "HoudiniStaticMeshComponent.h"
 #include "Engine/StaticMeshSocket.h"
 
@@ -60,7 +62,10 @@
 #include "AI/Navigation/NavCollisionBase.h"
 #include "ObjectTools.h"
 
-// #include "Async/ParallelFor.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Hash/CityHash.h"
 
 #include "ProfilingDebugging/CpuProfilerTrace.h"
 
@@ -75,6 +80,37 @@
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+// Default number of points and iterations used by the Houdini.BenchmarkKDopColliders command
+#define HOUDINI_KDOP_BENCHMARK_POINTS 10000
+#define HOUDINI_KDOP_BENCHMARK_ITERATIONS 100
+
+// Default number of split groups, faces per split group and iterations used by the Houdini.BenchmarkSplitGroups command
+#define HOUDINI_SPLIT_GROUPS_BENCHMARK_SPLITS 500
+#define HOUDINI_SPLIT_GROUPS_BENCHMARK_FACES 100
+#define HOUDINI_SPLIT_GROUPS_BENCHMARK_ITERATIONS 100
+
+// Tolerance used when hashing the positions of a part relative to its pivot, in Houdini units.
+// Translated copies of a part only get the same hash if their relative positions match within this tolerance.
+#define HOUDINI_PART_GEOMETRY_HASH_TOLERANCE 0.0001f
+
+TArray<TWeakObjectPtr<UStaticMesh>>
+FHoudiniMeshTranslator::PendingStaticMeshBuilds;
+
+int32
+FHoudiniMeshTranslator::StaticMeshBuildBatchCount = 0;
+
+TMap<uint64, TMap<FString, FHoudiniMeshTranslator::FSharedSplitMesh>>
+FHoudiniMeshTranslator::SharedSplitMeshes;
+
+TSet<const UObject*>
+FHoudiniMeshTranslator::StaticMeshesSharedByOutputs;
+
+FGuid
+FHoudiniMeshTranslator::SharingComponentGUID;
+
+int32
+FHoudiniMeshTranslator::StaticMeshSharingScopeCount = 0;
+
 // 
 bool
 FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
@@ -84,7 +120,8 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 	const FHoudiniStaticMeshGenerationProperties& InSMGenerationProperties,
 	UObject* InOuterComponent,
 	bool bInTreatExistingMaterialsAsUpToDate,
-	bool bInDestroyProxies)
+	bool bInDestroyProxies,
+	FHoudiniEngineOutputStats* OutStats)
 {
 	if (!InOutput || InOutput->IsPendingKill())
 		return false;
@@ -124,7 +161,8 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 			InForceRebuild,
 			InStaticMeshMethod,
 			InSMGenerationProperties,
-			bInTreatExistingMaterialsAsUpToDate);
+			bInTreatExistingMaterialsAsUpToDate,
+			OutStats);
 	}
 
 	return FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
@@ -199,6 +237,14 @@ FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
 		}
 	}	
 
+	// Meshes can be shared by identical parts, make sure we don't destroy meshes that are still in use,
+	// by this output or by the other outputs of the component
+	TSet<const UObject*> NewOutputMeshes;
+	for (auto& NewOutputObj : InNewOutputObjects)
+		NewOutputMeshes.Add(NewOutputObj.Value.OutputObject);
+	if (StaticMeshSharingScopeCount > 0 && IsInGameThread())
+		NewOutputMeshes.Append(StaticMeshesSharedByOutputs);
+
 	// The old map now only contains unused/stale Meshes/Components, delete them
 	for (auto& OldPair : OldOutputObjects)
 	{
@@ -213,7 +259,8 @@ FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
 		RemoveAndDestroyComponent(OldOutputObject.ProxyComponent);
 		OldOutputObject.ProxyComponent = nullptr;
 
-		if (OldOutputObject.OutputObject && !OldOutputObject.OutputObject->IsPendingKill())
+		if (OldOutputObject.OutputObject && !OldOutputObject.OutputObject->IsPendingKill()
+			&& !NewOutputMeshes.Contains(OldOutputObject.OutputObject))
 		{
 			OldOutputObject.OutputObject->MarkPendingKill();
 		}
@@ -356,6 +403,10 @@ FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
 					InOutput->HoudiniCreatedSocketActors, 
 					InOutput->HoudiniAttachedSocketActors,
 					bInApplyGenericProperties);
+
+				// The static mesh might have been built for an identical part at another location
+				if (FoundHGPO && !OutputObject.MeshOffset.IsZero())
+					MeshComponent->SetRelativeTransform(FTransform(OutputObject.MeshOffset) * FoundHGPO->TransformMatrix);
 			}
 
 			// Now, ensure that proxies replaced by meshes are still kept but hidden
@@ -381,6 +432,162 @@ FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
 	return true;
 }
 
+void
+FHoudiniMeshTranslator::BeginStaticMeshBuildBatch()
+{
+	if (!IsInGameThread())
+		return;
+
+	StaticMeshBuildBatchCount++;
+}
+
+void
+FHoudiniMeshTranslator::EndStaticMeshBuildBatch()
+{
+	if (!IsInGameThread())
+		return;
+
+	StaticMeshBuildBatchCount--;
+	if (StaticMeshBuildBatchCount > 0)
+		return;
+
+	StaticMeshBuildBatchCount = 0;
+
+	TArray<UStaticMesh*> StaticMeshes;
+	StaticMeshes.Reserve(PendingStaticMeshBuilds.Num());
+	for (const TWeakObjectPtr<UStaticMesh>& PendingStaticMesh : PendingStaticMeshBuilds)
+	{
+		UStaticMesh* SM = PendingStaticMesh.Get();
+		if (SM && !SM->IsPendingKill())
+			StaticMeshes.AddUnique(SM);
+	}
+	PendingStaticMeshBuilds.Empty();
+
+	BuildStaticMeshes(StaticMeshes);
+}
+
+void
+FHoudiniMeshTranslator::BuildStaticMesh(UStaticMesh* InStaticMesh)
+{
+	if (!InStaticMesh || InStaticMesh->IsPendingKill())
+		return;
+
+	if (StaticMeshBuildBatchCount > 0 && IsInGameThread())
+	{
+		// The mesh will be built when the batch is closed
+		PendingStaticMeshBuilds.AddUnique(InStaticMesh);
+		return;
+	}
+
+	BuildStaticMeshes({ InStaticMesh });
+}
+
+void
+FHoudiniMeshTranslator::BuildStaticMeshes(const TArray<UStaticMesh*>& InStaticMeshes)
+{
+	if (InStaticMeshes.Num() <= 0)
+		return;
+
+	FHoudiniScopedGlobalSilence ScopedGlobalSilence;
+
+	// BatchBuild builds the meshes in parallel.
+	// bSilent doesnt add the Build Errors...
+	double build_start = FPlatformTime::Seconds();
+	TArray<FText> SMBuildErrors;
+	UStaticMesh::BatchBuild(InStaticMeshes, true, nullptr, &SMBuildErrors);
+	double build_end = FPlatformTime::Seconds();
+	HOUDINI_LOG_MESSAGE(TEXT("UStaticMesh::BatchBuild() built %d static meshes in %f seconds."), InStaticMeshes.Num(), build_end - build_start);
+
+	// When building a batch, the meshes were assigned to their components before being built:
+	// the components' bounds and render state were computed from the unbuilt meshes, refresh them.
+	// TODO: The physics refresh is the content of RefreshCollisionChange, without CreateNavCollision:
+	// it is already called by UStaticMesh::PostBuildInternal as part of the build,
+	// and can be expensive depending on the vert/poly count of the mesh.
+	// This has to be done after the build, since it updates the meshes' physics state.
+	// The components are only iterated once for the whole batch.
+	TSet<UStaticMesh*> BuiltStaticMeshes(InStaticMeshes);
+	for (FObjectIterator Iter(UStaticMeshComponent::StaticClass()); Iter; ++Iter)
+	{
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(*Iter);
+		if (!StaticMeshComponent || StaticMeshComponent->IsPendingKill() || !BuiltStaticMeshes.Contains(StaticMeshComponent->GetStaticMesh()))
+			continue;
+
+		StaticMeshComponent->UpdateBounds();
+		if (StaticMeshComponent->IsRenderStateCreated())
+			StaticMeshComponent->MarkRenderStateDirty();
+
+		// it needs to recreate IF it already has been created
+		if (StaticMeshComponent->IsPhysicsStateCreated())
+			StaticMeshComponent->RecreatePhysicsState();
+	}
+
+	for (UStaticMesh* SM : InStaticMeshes)
+		SM->GetOnMeshChanged().Broadcast();
+
+	FEditorSupportDelegates::RedrawAllViewports.Broadcast();
+}
+
+FHoudiniStaticMeshBuildBatchScope::FHoudiniStaticMeshBuildBatchScope()
+{
+	FHoudiniMeshTranslator::BeginStaticMeshBuildBatch();
+}
+
+FHoudiniStaticMeshBuildBatchScope::~FHoudiniStaticMeshBuildBatchScope()
+{
+	FHoudiniMeshTranslator::EndStaticMeshBuildBatch();
+}
+
+FHoudiniStaticMeshSharingScope::FHoudiniStaticMeshSharingScope(UHoudiniAssetComponent* InHAC)
+{
+	if (!IsInGameThread())
+		return;
+
+	FHoudiniMeshTranslator::StaticMeshSharingScopeCount++;
+	if (FHoudiniMeshTranslator::StaticMeshSharingScopeCount > 1)
+		return;
+
+	FHoudiniMeshTranslator::SharedSplitMeshes.Empty();
+	FHoudiniMeshTranslator::StaticMeshesSharedByOutputs.Empty();
+	FHoudiniMeshTranslator::SharingComponentGUID = InHAC ? InHAC->GetComponentGUID() : FGuid();
+	if (!InHAC)
+		return;
+
+	// Find the static meshes that previous cooks shared between outputs
+	TMap<const UObject*, const UHoudiniOutput*> StaticMeshOutputs;
+	for (int32 OutputIdx = 0; OutputIdx < InHAC->GetNumOutputs(); OutputIdx++)
+	{
+		const UHoudiniOutput* CurOutput = InHAC->GetOutputAt(OutputIdx);
+		if (!CurOutput || CurOutput->IsPendingKill() || CurOutput->GetType() != EHoudiniOutputType::Mesh)
+			continue;
+
+		for (const auto& Pair : CurOutput->GetOutputObjects())
+		{
+			const UObject* StaticMesh = Pair.Value.OutputObject;
+			if (!StaticMesh)
+				continue;
+
+			const UHoudiniOutput*& FoundOutput = StaticMeshOutputs.FindOrAdd(StaticMesh, CurOutput);
+			if (FoundOutput != CurOutput)
+				FHoudiniMeshTranslator::StaticMeshesSharedByOutputs.Add(StaticMesh);
+		}
+	}
+}
+
+FHoudiniStaticMeshSharingScope::~FHoudiniStaticMeshSharingScope()
+{
+	if (!IsInGameThread())
+		return;
+
+	FHoudiniMeshTranslator::StaticMeshSharingScopeCount--;
+	if (FHoudiniMeshTranslator::StaticMeshSharingScopeCount > 0)
+		return;
+
+	FHoudiniMeshTranslator::StaticMeshSharingScopeCount = 0;
+	FHoudiniMeshTranslator::SharedSplitMeshes.Empty();
+	FHoudiniMeshTranslator::StaticMeshesSharedByOutputs.Empty();
+	FHoudiniMeshTranslator::SharingComponentGUID = FGuid();
+}
+
 void
 FHoudiniMeshTranslator::UpdateMeshComponent(UMeshComponent *InMeshComponent, const FHoudiniOutputObjectIdentifier &InOutputIdentifier, 
 	const FHoudiniGeoPartObject *InHGPO, TArray<AActor*> &HoudiniCreatedSocketActors, TArray<AActor*> &HoudiniAttachedSocketActors,
@@ -518,7 +725,8 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	const bool& InForceRebuild,
 	const EHoudiniStaticMeshMethod& InStaticMeshMethod,
 	const FHoudiniStaticMeshGenerationProperties& InSMGenerationProperties,
-	bool bInTreatExistingMaterialsAsUpToDate)
+	bool bInTreatExistingMaterialsAsUpToDate,
+	FHoudiniEngineOutputStats* OutStats)
 {
 	// If we're not forcing the rebuild
 	// No need to recreate something that hasn't changed
@@ -539,6 +747,7 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	CurrentTranslator.SetPackageParams(InPackageParams, true);
 	CurrentTranslator.SetTreatExistingMaterialsAsUpToDate(bInTreatExistingMaterialsAsUpToDate);
 	CurrentTranslator.SetStaticMeshGenerationProperties(InSMGenerationProperties);
+	CurrentTranslator.OutputStats = OutStats;
 
 	// TODO: Fetch from settings/HAC
 	CurrentTranslator.DefaultMeshSmoothing = 1;
@@ -660,6 +869,7 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices"));
 
 	// Reset the splits faces/indices arrays
+	AllSplitGroupIds.Empty();
 	AllSplitVertexLists.Empty();
 	AllSplitVertexCounts.Empty();
 	AllSplitFaceIndices.Empty();
@@ -685,6 +895,13 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 		// Store them here so we can remove them afterwards
 		TArray<int32> InvalidGroupNameIndices;
 
+		// The per-split arrays are indexed like AllSplitGroups
+		AllSplitVertexLists.SetNum(AllSplitGroups.Num());
+		AllSplitVertexCounts.SetNumZeroed(AllSplitGroups.Num());
+		AllSplitFaceIndices.SetNum(AllSplitGroups.Num());
+		AllSplitFirstValidVertexIndex.SetNumZeroed(AllSplitGroups.Num());
+		AllSplitFirstValidPrimIndex.SetNumZeroed(AllSplitGroups.Num());
+
 		// Extract the vertices/faces for each of the split groups
 		for (int32 SplitIdx = 0; SplitIdx < AllSplitGroups.Num(); SplitIdx++)
 		{
@@ -718,11 +935,11 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 			}
 
 			// If list is not empty, we store it for this group - this will define new mesh.
-			AllSplitVertexLists.Add(GroupName, GroupVertexList);
-			AllSplitVertexCounts.Add(GroupName, GroupVertexListCount);
-			AllSplitFaceIndices.Add(GroupName, AllFaceList);
-			AllSplitFirstValidVertexIndex.Add(GroupName, FirstValidVertexIndex);
-			AllSplitFirstValidPrimIndex.Add(GroupName, FirstValidPrimIndex);
+			AllSplitVertexLists[SplitIdx] = MoveTemp(GroupVertexList);
+			AllSplitVertexCounts[SplitIdx] = GroupVertexListCount;
+			AllSplitFaceIndices[SplitIdx] = MoveTemp(AllFaceList);
+			AllSplitFirstValidVertexIndex[SplitIdx] = FirstValidVertexIndex;
+			AllSplitFirstValidPrimIndex[SplitIdx] = FirstValidPrimIndex;
 		}
 
 		if (InvalidGroupNameIndices.Num() > 0)
@@ -732,6 +949,11 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 			{
 				int32 Index = InvalidGroupNameIndices[InvalIdx];
 				AllSplitGroups.RemoveAt(Index);
+				AllSplitVertexLists.RemoveAt(Index);
+				AllSplitVertexCounts.RemoveAt(Index);
+				AllSplitFaceIndices.RemoveAt(Index);
+				AllSplitFirstValidVertexIndex.RemoveAt(Index);
+				AllSplitFirstValidPrimIndex.RemoveAt(Index);
 			}
 		}
 
@@ -772,11 +994,11 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 		{
 			static const FString RemainingGroupName = HAPI_UNREAL_GROUP_GEOMETRY_NOT_COLLISION;
 			AllSplitGroups.Add(RemainingGroupName);
-			AllSplitVertexLists.Add(RemainingGroupName, GroupSplitFacesRemaining);
-			AllSplitVertexCounts.Add(RemainingGroupName, GroupVertexListCount);
-			AllSplitFaceIndices.Add(RemainingGroupName, GroupSplitFaceIndicesRemaining);
-			AllSplitFirstValidPrimIndex.Add(RemainingGroupName, FistUnusedPrimIndex);
-			AllSplitFirstValidVertexIndex.Add(RemainingGroupName, FistUnusedVertexIndex);
+			AllSplitVertexLists.Add(MoveTemp(GroupSplitFacesRemaining));
+			AllSplitVertexCounts.Add(GroupVertexListCount);
+			AllSplitFaceIndices.Add(MoveTemp(GroupSplitFaceIndicesRemaining));
+			AllSplitFirstValidPrimIndex.Add(FistUnusedPrimIndex);
+			AllSplitFirstValidVertexIndex.Add(FistUnusedVertexIndex);
 		}
 	}
 	else
@@ -785,21 +1007,188 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 		// Mark everything as the main geo group
 		static const FString RemainingGroupName = HAPI_UNREAL_GROUP_GEOMETRY_NOT_COLLISION;
 		AllSplitGroups.Add(RemainingGroupName);
-		AllSplitVertexLists.Add(RemainingGroupName, PartVertexList);
-		AllSplitVertexCounts.Add(RemainingGroupName, PartVertexList.Num());
-		AllSplitFirstValidPrimIndex.Add(RemainingGroupName, 0);
-		AllSplitFirstValidVertexIndex.Add(RemainingGroupName, 0);
+		AllSplitVertexLists.Add(PartVertexList);
+		AllSplitVertexCounts.Add(PartVertexList.Num());
+		AllSplitFirstValidPrimIndex.Add(0);
+		AllSplitFirstValidVertexIndex.Add(0);
 
 		TArray<int32> AllFaces;
 		for (int32 FaceIdx = 0; FaceIdx < HGPO.PartInfo.FaceCount; ++FaceIdx)
 			AllFaces.Add(FaceIdx);
 
-		AllSplitFaceIndices.Add(RemainingGroupName, AllFaces);
+		AllSplitFaceIndices.Add(MoveTemp(AllFaces));
 	}
 
+	// The split loops only use split ids, keep the names around for lookups by name
+	AllSplitGroupIds.Reserve(AllSplitGroups.Num());
+	for (int32 SplitId = 0; SplitId < AllSplitGroups.Num(); SplitId++)
+		AllSplitGroupIds.Add(AllSplitGroups[SplitId], SplitId);
+
 	return true;
 }
 
+int32
+FHoudiniMeshTranslator::GetSplitId(const FString& SplitGroupName) const
+{
+	const int32* FoundSplitId = AllSplitGroupIds.Find(SplitGroupName);
+	return FoundSplitId ? *FoundSplitId : INDEX_NONE;
+}
+
+void
+FHoudiniMeshTranslator::RunSplitGroupsBenchmark(const int32& InNumSplits, const int32& InNumFacesPerSplit, const int32& InNumIterations)
+{
+	const int32 NumSplits = FMath::Max(InNumSplits, 1);
+	const int32 NumFaces = FMath::Max(InNumFacesPerSplit, 1);
+	const int32 NumIterations = FMath::Max(InNumIterations, 1);
+
+	// Generate the split groups, named like the LODs and colliders of a part, and their triangles
+	const TCHAR* SplitPrefixes[] =
+	{
+		HAPI_UNREAL_GROUP_LOD_PREFIX,
+		HAPI_UNREAL_GROUP_RENDERED_COLLISION_PREFIX,
+		HAPI_UNREAL_GROUP_INVISIBLE_UCX_COLLISION_PREFIX,
+		HAPI_UNREAL_GROUP_INVISIBLE_SIMPLE_COLLISION_PREFIX
+	};
+
+	TArray<FString> SplitGroups;
+	TArray<TArray<int32>> SplitVertexLists;
+	TArray<TArray<int32>> SplitFaceIndices;
+	SplitGroups.SetNum(NumSplits);
+	SplitVertexLists.SetNum(NumSplits);
+	SplitFaceIndices.SetNum(NumSplits);
+	for (int32 SplitIdx = 0; SplitIdx < NumSplits; SplitIdx++)
+	{
+		SplitGroups[SplitIdx] = FString::Printf(TEXT("%s_%d"), SplitPrefixes[SplitIdx % UE_ARRAY_COUNT(SplitPrefixes)], SplitIdx);
+		SplitVertexLists[SplitIdx].SetNumUninitialized(NumFaces * 3);
+		for (int32 VertexIdx = 0; VertexIdx < NumFaces * 3; VertexIdx++)
+			SplitVertexLists[SplitIdx][VertexIdx] = SplitIdx * NumFaces * 3 + VertexIdx;
+
+		SplitFaceIndices[SplitIdx].SetNumUninitialized(NumFaces);
+		for (int32 FaceIdx = 0; FaceIdx < NumFaces; FaceIdx++)
+			SplitFaceIndices[SplitIdx][FaceIdx] = SplitIdx * NumFaces + FaceIdx;
+	}
+
+	// Both versions store the splits' data, then go through the splits in order,
+	// fetch their data and find their LOD index like the split loops do
+	uint64 KeyedChecksum = 0;
+	double Tick = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+	{
+		TMap<FString, TArray<int32>> AllVertexLists;
+		TMap<FString, int32> AllVertexCounts;
+		TMap<FString, TArray<int32>> AllFaceIndices;
+		TMap<FString, int32> AllFirstValidVertexIndex;
+		TMap<FString, int32> AllFirstValidPrimIndex;
+		for (int32 SplitIdx = 0; SplitIdx < NumSplits; SplitIdx++)
+		{
+			const FString& GroupName = SplitGroups[SplitIdx];
+			TArray<int32> GroupVertexList = SplitVertexLists[SplitIdx];
+			TArray<int32> AllFaceList = SplitFaceIndices[SplitIdx];
+			AllVertexLists.Add(GroupName, GroupVertexList);
+			AllVertexCounts.Add(GroupName, GroupVertexList.Num());
+			AllFaceIndices.Add(GroupName, AllFaceList);
+			AllFirstValidVertexIndex.Add(GroupName, GroupVertexList[0]);
+			AllFirstValidPrimIndex.Add(GroupName, AllFaceList[0]);
+		}
+
+		for (const FString& SplitGroupName : SplitGroups)
+		{
+			const TArray<int32>& SplitVertexList = AllVertexLists[SplitGroupName];
+			const int32& SplitVertexCount = AllVertexCounts[SplitGroupName];
+			const TArray<int32>& SplitFaceList = AllFaceIndices[SplitGroupName];
+
+			int32 LODIndex = 0;
+			for (const FString& CurSplit : SplitGroups)
+			{
+				if (GetSplitTypeFromSplitName(CurSplit) == EHoudiniSplitType::LOD)
+					LODIndex++;
+
+				if (CurSplit == SplitGroupName)
+					break;
+			}
+
+			KeyedChecksum += SplitVertexList.Num() + SplitVertexCount + SplitFaceList.Num() + LODIndex
+				+ AllFirstValidVertexIndex[SplitGroupName] + AllFirstValidPrimIndex[SplitGroupName];
+		}
+	}
+	const double KeyedTime = (FPlatformTime::Seconds() - Tick) / NumIterations;
+
+	uint64 IndexedChecksum = 0;
+	Tick = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+	{
+		TArray<TArray<int32>> AllVertexLists;
+		TArray<int32> AllVertexCounts;
+		TArray<TArray<int32>> AllFaceIndices;
+		TArray<int32> AllFirstValidVertexIndex;
+		TArray<int32> AllFirstValidPrimIndex;
+		TMap<FString, int32> AllGroupIds;
+		AllVertexLists.SetNum(NumSplits);
+		AllVertexCounts.SetNumZeroed(NumSplits);
+		AllFaceIndices.SetNum(NumSplits);
+		AllFirstValidVertexIndex.SetNumZeroed(NumSplits);
+		AllFirstValidPrimIndex.SetNumZeroed(NumSplits);
+		for (int32 SplitIdx = 0; SplitIdx < NumSplits; SplitIdx++)
+		{
+			TArray<int32> GroupVertexList = SplitVertexLists[SplitIdx];
+			TArray<int32> AllFaceList = SplitFaceIndices[SplitIdx];
+			AllVertexCounts[SplitIdx] = GroupVertexList.Num();
+			AllFirstValidVertexIndex[SplitIdx] = GroupVertexList[0];
+			AllFirstValidPrimIndex[SplitIdx] = AllFaceList[0];
+			AllVertexLists[SplitIdx] = MoveTemp(GroupVertexList);
+			AllFaceIndices[SplitIdx] = MoveTemp(AllFaceList);
+		}
+
+		AllGroupIds.Reserve(NumSplits);
+		for (int32 SplitId = 0; SplitId < NumSplits; SplitId++)
+			AllGroupIds.Add(SplitGroups[SplitId], SplitId);
+
+		for (int32 SplitId = 0; SplitId < NumSplits; SplitId++)
+		{
+			int32 LODIndex = 0;
+			for (int32 CurSplitId = 0; CurSplitId <= SplitId; CurSplitId++)
+			{
+				if (GetSplitTypeFromSplitName(SplitGroups[CurSplitId]) == EHoudiniSplitType::LOD)
+					LODIndex++;
+			}
+
+			IndexedChecksum += AllVertexLists[SplitId].Num() + AllVertexCounts[SplitId] + AllFaceIndices[SplitId].Num() + LODIndex
+				+ AllFirstValidVertexIndex[SplitId] + AllFirstValidPrimIndex[SplitId];
+		}
+	}
+	const double IndexedTime = (FPlatformTime::Seconds() - Tick) / NumIterations;
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Split groups benchmark - %d splits of %d faces: split name keyed maps %.3fms, split id arrays %.3fms (x%.1f)%s"),
+		NumSplits, NumFaces, KeyedTime * 1000.0, IndexedTime * 1000.0,
+		IndexedTime > 0.0 ? KeyedTime / IndexedTime : 0.0,
+		KeyedChecksum == IndexedChecksum ? TEXT("") : TEXT(" - RESULTS DIFFER"));
+}
+
+static void
+HoudiniBenchmarkSplitGroupsCommand(const TArray<FString>& Args)
+{
+	int32 NumSplits = HOUDINI_SPLIT_GROUPS_BENCHMARK_SPLITS;
+	if (Args.Num() > 0 && Args[0].IsNumeric())
+		NumSplits = FCString::Atoi(*Args[0]);
+
+	int32 NumFaces = HOUDINI_SPLIT_GROUPS_BENCHMARK_FACES;
+	if (Args.Num() > 1 && Args[1].IsNumeric())
+		NumFaces = FCString::Atoi(*Args[1]);
+
+	int32 NumIterations = HOUDINI_SPLIT_GROUPS_BENCHMARK_ITERATIONS;
+	if (Args.Num() > 2 && Args[2].IsNumeric())
+		NumIterations = FCString::Atoi(*Args[2]);
+
+	FHoudiniMeshTranslator::RunSplitGroupsBenchmark(NumSplits, NumFaces, NumIterations);
+}
+
+static FAutoConsoleCommand CCmdHoudiniBenchmarkSplitGroups(
+	TEXT("Houdini.BenchmarkSplitGroups"),
+	TEXT("Compares the split group bookkeeping indexed by split id to the previous split name keyed maps and logs the timings.\n")
+	TEXT("Houdini.BenchmarkSplitGroups [NumSplits] [NumFacesPerSplit] [NumIterations]: defaults to 500 splits of 100 faces and 100 iterations.\n"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&HoudiniBenchmarkSplitGroupsCommand));
+
 void
 FHoudiniMeshTranslator::ResetPartCache()
 {
@@ -1353,7 +1742,7 @@ FHoudiniMeshTranslator::UpdatePartLODScreensizeIfNeeded()
 
 
 UStaticMesh*
-FHoudiniMeshTranslator::CreateNewStaticMesh(const FString& InSplitIdentifier)
+FHoudiniMeshTranslator::CreateNewStaticMesh(const FString& InSplitIdentifier, const bool& bInUniquePackage)
 {
 	// Update the current Obj/Geo/Part/Split IDs
 	PackageParams.ObjectId = HGPO.ObjectId;
@@ -1361,7 +1750,13 @@ FHoudiniMeshTranslator::CreateNewStaticMesh(const FString& InSplitIdentifier)
 	PackageParams.PartId = HGPO.PartId;
 	PackageParams.SplitStr = InSplitIdentifier;
 
+	// Replacing the existing package would also replace a mesh that is still in use
+	const EPackageReplaceMode ReplaceMode = PackageParams.ReplaceMode;
+	if (bInUniquePackage)
+		PackageParams.ReplaceMode = EPackageReplaceMode::CreateNewAssets;
+
 	UStaticMesh * NewStaticMesh = PackageParams.CreateObjectAndPackage<UStaticMesh>();
+	PackageParams.ReplaceMode = ReplaceMode;
 	if (!NewStaticMesh || NewStaticMesh->IsPendingKill())
 		return nullptr;
 
@@ -1434,6 +1829,16 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		}
 	}
 
+	// Houdini flags geometry changes conservatively, if the part's geometry is actually the same
+	// as in the previous cook, keep its static meshes untouched
+	PartGeometryHash = ComputePartGeometryHash(false);
+	if (!bMaterialHasChanged && ReuseUnchangedStaticMeshes())
+		return true;
+
+	// Parts with identical geometry can share the same static meshes
+	if (ShareStaticMeshesFromIdenticalPart())
+		return true;
+
 	// Get the current target platform for default lod policies
 	ITargetPlatform * CurrentPlatform = GetTargetPlatformManagerRef().GetRunningTargetPlatform();
 	check(CurrentPlatform);
@@ -1455,6 +1860,10 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 	FHoudiniEngineUtils::AddMeshSocketsToArray_Group(
 		HGPO.GeoId, HGPO.PartId, AllSockets, HGPO.PartInfo.bIsInstanced);
 
+	// The simple colliders only depend on the part's positions, generate them for all the splits at once
+	TArray<FKAggregateGeom> AllSimpleCollisions;
+	GenerateAllSimpleCollisions(AllSimpleCollisions);
+
 	// Iterate through all detected split groups we care about and split geometry.
 	// The split are ordered in the following way:
 	// Invisible Simple/Convex Colliders > LODs > MainGeo > Visible Colliders > Invisible Colliders
@@ -1464,10 +1873,10 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		const FString& SplitGroupName = AllSplitGroups[SplitId];
 
 		// Get the vertex indices for this group
-		TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
+		TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitId];
 
 		// Get valid count of vertex indices for this split.
-		const int32& SplitVertexCount = AllSplitVertexCounts[SplitGroupName];
+		const int32& SplitVertexCount = AllSplitVertexCounts[SplitId];
 
 		// Make sure we have a  valid vertex count for this split
 		if (SplitVertexCount % 3 != 0 || SplitVertexList.Num() % 3 != 0)
@@ -1508,7 +1917,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 			UpdatePartPositionIfNeeded();
 
 			// Create the convex hull colliders and add them to the Aggregate
-			if (!AddConvexCollisionToAggregate(SplitGroupName, AggregateCollisions))
+			if (!AddConvexCollisionToAggregate(SplitId, AggregateCollisions))
 			{
 				// Failed to generate a convex collider
 				HOUDINI_LOG_WARNING(
@@ -1522,13 +1931,14 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		}
 		else if (SplitType == EHoudiniSplitType::InvisibleSimpleCollider || SplitType == EHoudiniSplitType::RenderedSimpleCollider)
 		{
-			// Get the part position if needed
-			UpdatePartPositionIfNeeded();
+			// Add the simple colliders generated for this split to the aggregate
+			const FKAggregateGeom* SplitSimpleCollisions = AllSimpleCollisions.IsValidIndex(SplitId) ? &AllSimpleCollisions[SplitId] : nullptr;
+			if (SplitSimpleCollisions)
+				AppendAggregateCollisions(*SplitSimpleCollisions, AggregateCollisions);
 
-			// Create the simple colliders and add them to the aggregate
-			if (!AddSimpleCollisionToAggregate(SplitGroupName, AggregateCollisions))
+			if (!SplitSimpleCollisions || SplitSimpleCollisions->GetElementCount() <= 0)
 			{
-				// Failed to generate a convex collider
+				// Failed to generate a simple collider
 				HOUDINI_LOG_WARNING(
 					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] failed to create simple collider."),
 					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
@@ -1544,6 +1954,11 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		// Try to find an existing SM from a previous cook
 		UStaticMesh* FoundStaticMesh = FindExistingStaticMesh(OutputObjectIdentifier);
 
+		// A SM shared with identical parts must not be updated in place, create a new one instead
+		const bool bFoundSharedStaticMesh = FoundStaticMesh && IsStaticMeshShared(FoundStaticMesh, OutputObjectIdentifier);
+		if (bFoundSharedStaticMesh)
+			FoundStaticMesh = nullptr;
+
 		// Flag whether or not we need to rebuild the mesh
 		bool bRebuildStaticMesh = false;
 		if (HGPO.GeoInfo.bHasGeoChanged || HGPO.PartInfo.bHasChanged || ForceRebuild || !FoundStaticMesh || !FoundOutputObject)
@@ -1564,7 +1979,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		if (!FoundStaticMesh)
 		{
 			// If we couldn't find a valid existing static mesh, create a new one
-			FoundStaticMesh = CreateNewStaticMesh(OutputObjectIdentifier.SplitIdentifier);
+			FoundStaticMesh = CreateNewStaticMesh(OutputObjectIdentifier.SplitIdentifier, bFoundSharedStaticMesh);
 			if (!FoundStaticMesh || FoundStaticMesh->IsPendingKill())
 				continue;
 
@@ -1628,17 +2043,14 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		int32 LODIndex = 0;
 		if (SplitType == EHoudiniSplitType::LOD)
 		{
-			for (auto& curSplit : AllSplitGroups)
+			for (int32 CurSplitId = 0; CurSplitId <= SplitId; CurSplitId++)
 			{
-				EHoudiniSplitType CurrentSplitType = GetSplitTypeFromSplitName(curSplit);
+				EHoudiniSplitType CurrentSplitType = GetSplitTypeFromSplitName(AllSplitGroups[CurSplitId]);
 				if (CurrentSplitType == EHoudiniSplitType::LOD
 					|| CurrentSplitType == EHoudiniSplitType::Normal)
 				{
 					LODIndex++;
 				}
-
-				if (curSplit == SplitGroupName)
-					break;
 			}
 
 			// Fix for the case where we don't have a main geo
@@ -1688,15 +2100,11 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 				HOUDINI_LOG_WARNING(TEXT("Invalid normal count detected - Skipping normals."));
 			}
 
-			// Transfer the normals to the raw mesh 
-			RawMesh.WedgeTangentZ.SetNumZeroed(WedgeNormalCount);
-			for (int32 WedgeTangentZIdx = 0; WedgeTangentZIdx < WedgeNormalCount; ++WedgeTangentZIdx)
-			{
-				// Swap Y/Z for Coordinates conversion
-				RawMesh.WedgeTangentZ[WedgeTangentZIdx].X = SplitNormals[WedgeTangentZIdx * 3 + 0];
-				RawMesh.WedgeTangentZ[WedgeTangentZIdx].Y = SplitNormals[WedgeTangentZIdx * 3 + 2];
-				RawMesh.WedgeTangentZ[WedgeTangentZIdx].Z = SplitNormals[WedgeTangentZIdx * 3 + 1];
-			}
+			// Transfer the normals to the raw mesh, swapping Y/Z for Coordinates conversion
+			if (WedgeNormalCount > 0)
+				FHoudiniMeshConversion::ConvertVectors(SplitNormals, RawMesh.WedgeTangentZ);
+			else
+				RawMesh.WedgeTangentZ.Empty();
 
 
 			//--------------------------------------------------------------------------------------------------------------------- 
@@ -1755,23 +2163,9 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 				else
 				{
 					// Transfer the tangents we have read them and they're valid
-					RawMesh.WedgeTangentX.SetNumZeroed(WedgeTangentUCount);
-					for (int32 WedgeTangentUIdx = 0; WedgeTangentUIdx < WedgeTangentUCount; ++WedgeTangentUIdx)
-					{
-						// We need to flip Z and Y
-						RawMesh.WedgeTangentX[WedgeTangentUIdx].X = SplitTangentU[WedgeTangentUIdx * 3 + 0];
-						RawMesh.WedgeTangentX[WedgeTangentUIdx].Y = SplitTangentU[WedgeTangentUIdx * 3 + 2];
-						RawMesh.WedgeTangentX[WedgeTangentUIdx].Z = SplitTangentU[WedgeTangentUIdx * 3 + 1];
-					}
-
-					RawMesh.WedgeTangentY.SetNumZeroed(WedgeTangentVCount);
-					for (int32 WedgeTangentVIdx = 0; WedgeTangentVIdx < WedgeTangentVCount; ++WedgeTangentVIdx)
-					{
-						// We need to flip Z and Y
-						RawMesh.WedgeTangentY[WedgeTangentVIdx].X = SplitTangentV[WedgeTangentVIdx * 3 + 0];
-						RawMesh.WedgeTangentY[WedgeTangentVIdx].Y = SplitTangentV[WedgeTangentVIdx * 3 + 2];
-						RawMesh.WedgeTangentY[WedgeTangentVIdx].Z = SplitTangentV[WedgeTangentVIdx * 3 + 1];
-					}
+					// We need to flip Z and Y
+					FHoudiniMeshConversion::ConvertVectors(SplitTangentU, RawMesh.WedgeTangentX);
+					FHoudiniMeshConversion::ConvertVectors(SplitTangentV, RawMesh.WedgeTangentY);
 				}
 			}
 
@@ -1898,13 +2292,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 				int32 WedgeUVCount = SplitUVs.Num() / 2;
 				if (SplitUVs.Num() > 0 && SplitUVs.IsValidIndex((WedgeUVCount - 1) * 2 + 1))
 				{
-					RawMesh.WedgeTexCoords[TexCoordIdx].SetNumZeroed(WedgeUVCount);
-					for (int32 WedgeUVIdx = 0; WedgeUVIdx < WedgeUVCount; ++WedgeUVIdx)
-					{
-						// We need to flip V coordinate when it's coming from HAPI.
-						RawMesh.WedgeTexCoords[TexCoordIdx][WedgeUVIdx].X = SplitUVs[WedgeUVIdx * 2 + 0];
-						RawMesh.WedgeTexCoords[TexCoordIdx][WedgeUVIdx].Y = 1.0f - SplitUVs[WedgeUVIdx * 2 + 1];
-					}
+					// We need to flip V coordinate when it's coming from HAPI.
+					FHoudiniMeshConversion::ConvertUVs(SplitUVs, RawMesh.WedgeTexCoords[TexCoordIdx]);
 
 					UVChannelCount++;
 					if (UVChannelCount <= 2)
@@ -2049,27 +2438,14 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 			// Instead of declaring all the Positions, we'll only declare the vertices
 			// needed by the current split.
 			//
-			int32 VertexPositionsCount = NeededVertices.Num();
-			RawMesh.VertexPositions.SetNumZeroed(VertexPositionsCount);
-
-			for (int32 VertexPositionIdx = 0; VertexPositionIdx < VertexPositionsCount; ++VertexPositionIdx)
+			// We need to swap Z and Y coordinate here, and convert from m to cm. 
+			if (FHoudiniMeshConversion::GatherPositions(PartPositions, NeededVertices, RawMesh.VertexPositions) > 0)
 			{
-				int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
-				if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
-				{
-					// Error retrieving positions.
-					HOUDINI_LOG_WARNING(
-						TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
-						TEXT("- skipping."),
-						HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
-
-					continue;
-				}
-
-				// We need to swap Z and Y coordinate here, and convert from m to cm. 
-				RawMesh.VertexPositions[VertexPositionIdx].X = PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-				RawMesh.VertexPositions[VertexPositionIdx].Y = PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-				RawMesh.VertexPositions[VertexPositionIdx].Z = PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+				// Error retrieving positions.
+				HOUDINI_LOG_WARNING(
+					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
+					TEXT("- skipping."),
+					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
 			}
 
 			/*
@@ -2102,7 +2478,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		// Handle Materials!!!!
 
 		// Get face indices for this split.
-		TArray<int32>& SplitFaceIndices = AllSplitFaceIndices[SplitGroupName];
+		TArray<int32>& SplitFaceIndices = AllSplitFaceIndices[SplitId];
 
 		// We need to reset the Static Mesh's materials once per SM:
 		// so, for the first lod, or the main geo...
@@ -2338,7 +2714,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 
 		// LOD Screensize
 		// default values has already been set, see if we have any attribute override for this
-		float screensize = GetLODSCreensizeForSplit(SplitGroupName);
+		float screensize = GetLODSCreensizeForSplit(SplitId);
 		if (screensize >= 0.0f)
 		{
 			// Only apply the LOD screensize if it's valid
@@ -2357,63 +2733,17 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		TArray<FHoudiniGenericAttribute> PropertyAttributes;
 		if (GetGenericPropertiesAttributes(
 			HGPO.GeoId, HGPO.PartId,
-			AllSplitFirstValidVertexIndex[SplitGroupName],
-			AllSplitFirstValidPrimIndex[SplitGroupName],
+			AllSplitFirstValidVertexIndex[SplitId],
+			AllSplitFirstValidPrimIndex[SplitId],
 			PropertyAttributes))
 		{
 			UpdateGenericPropertiesAttributes(
 				FoundStaticMesh, PropertyAttributes);
 		}
 
-		TArray<FString> LevelPaths;
-		if (FoundOutputObject && FHoudiniEngineUtils::GetLevelPathAttribute(HGPO.GeoId, HGPO.PartId, LevelPaths))
-		{
-			if (LevelPaths.Num() > 0 && !LevelPaths[0].IsEmpty())
-			{
-				// cache the level path attribute on the output object
-				FoundOutputObject->CachedAttributes.Add(HAPI_UNREAL_ATTRIB_LEVEL_PATH, LevelPaths[0]);
-			}
-		}
-
-		TArray<FString> OutputNames;
-		if (FoundOutputObject && FHoudiniEngineUtils::GetOutputNameAttribute(HGPO.GeoId, HGPO.PartId, OutputNames))
-		{
-			if (OutputNames.Num() > 0 && !OutputNames[0].IsEmpty())
-			{
-				// cache the output name attribute on the output object
-				FoundOutputObject->CachedAttributes.Add(HAPI_UNREAL_ATTRIB_CUSTOM_OUTPUT_NAME_V2, OutputNames[0]);
-			}
-		}
-
-		TArray<int32> TileValues;
-		if (FoundOutputObject && FHoudiniEngineUtils::GetTileAttribute(HGPO.GeoId, HGPO.PartId, TileValues))
-		{
-			if (TileValues.Num() > 0 && TileValues[0] >= 0)
-			{
-				// cache the tile attribute as a token on the output object
-				FoundOutputObject->CachedTokens.Add(TEXT("tile"), FString::FromInt(TileValues[0]));
-			}
-		}
-
-		TArray<FString> BakeOutputActorNames;
-		if (FoundOutputObject && FHoudiniEngineUtils::GetBakeActorAttribute(HGPO.GeoId, HGPO.PartId, BakeOutputActorNames))
-		{
-			if (BakeOutputActorNames.Num() > 0 && !BakeOutputActorNames[0].IsEmpty())
-			{
-				// cache the bake actor attribute on the output object
-				FoundOutputObject->CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_ACTOR, BakeOutputActorNames[0]);
-			}
-		}
-
-		TArray<FString> BakeOutlinerFolders;
-		if (FoundOutputObject && FHoudiniEngineUtils::GetBakeOutlinerFolderAttribute(HGPO.GeoId, HGPO.PartId, BakeOutlinerFolders))
-		{
-			if (BakeOutlinerFolders.Num() > 0 && !BakeOutlinerFolders[0].IsEmpty())
-			{
-				// cache the bake actor attribute on the output object
-				FoundOutputObject->CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_OUTLINER_FOLDER, BakeOutlinerFolders[0]);
-			}
-		}
+		// Cache the output attributes needed for baking on the output object
+		if (FoundOutputObject)
+			CacheOutputObjectAttributes(*FoundOutputObject);
 
 		// Notify that we created a new Static Mesh if needed
 		if (bNewStaticMeshCreated)
@@ -2423,8 +2753,12 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		if (FoundOutputObject)
 		{
 			FoundOutputObject->OutputObject = FoundStaticMesh;
+			FoundOutputObject->GeometryHash = PartGeometryHash;
+			FoundOutputObject->GeometryPivot = PartGeometryPivot;
+			FoundOutputObject->MeshOffset = FVector::ZeroVector;
 			FoundOutputObject->bProxyIsCurrent = false;
 			OutputObjects.FindOrAdd(OutputObjectIdentifier, *FoundOutputObject);
+			RegisterSharedStaticMesh(OutputObjectIdentifier.SplitIdentifier, *FoundOutputObject);
 		}
 
 		StaticMeshToBuild.FindOrAdd(OutputObjectIdentifier, FoundStaticMesh);
@@ -2513,14 +2847,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		}
 
 		// BUILD the Static Mesh
-		// bSilent doesnt add the Build Errors...
-		double build_start = FPlatformTime::Seconds();
-		TArray<FText> SMBuildErrors;
-		SM->Build(true, &SMBuildErrors);
-		double build_end = FPlatformTime::Seconds();
-		HOUDINI_LOG_MESSAGE(TEXT("StaticMesh->Build() executed in %f seconds."), build_end - build_start);
-
-		SM->GetOnMeshChanged().Broadcast();
+		// The build is deferred until the end of the cook if a build batch is opened
+		BuildStaticMesh(SM);
 
 		/*
 		// Try to find the outer package so we can dirty it up
@@ -2627,6 +2955,16 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		}
 	}
 
+	// Houdini flags geometry changes conservatively, if the part's geometry is actually the same
+	// as in the previous cook, keep its static meshes untouched
+	PartGeometryHash = ComputePartGeometryHash(true);
+	if (!bMaterialHasChanged && ReuseUnchangedStaticMeshes())
+		return true;
+
+	// Parts with identical geometry can share the same static meshes
+	if (ShareStaticMeshesFromIdenticalPart())
+		return true;
+
 	// Get the current target platform for default lod policies
 	ITargetPlatform * CurrentPlatform = GetTargetPlatformManagerRef().GetRunningTargetPlatform();
 	check(CurrentPlatform);
@@ -2648,9 +2986,33 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 	FHoudiniEngineUtils::AddMeshSocketsToArray_Group(
 		HGPO.GeoId, HGPO.PartId, AllSockets, HGPO.PartInfo.bIsInstanced);
 
+	// No need to read the tangents if we want unreal to recompute them after
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const bool bReadTangents = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->RecomputeTangentsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always : true;
+
+	// The splits are processed in two passes: the first one creates/updates the static meshes and their materials
+	// on the game thread, then the MeshDescriptions are built on worker threads before being committed.
+	struct FSplitToFinalize
+	{
+		int32 SplitId = INDEX_NONE;
+		FString SplitGroupName;
+		FHoudiniOutputObjectIdentifier OutputObjectIdentifier;
+		UStaticMesh* StaticMesh = nullptr;
+		int32 LODIndex = 0;
+		bool bNewStaticMeshCreated = false;
+		int32 BuildIndex = INDEX_NONE;
+	};
+	TArray<FSplitToFinalize> SplitsToFinalize;
+	TArray<FMeshDescriptionBuildData> AllBuildData;
+	TMap<FHoudiniOutputObjectIdentifier, UStaticMesh*> PendingStaticMeshes;
+
 	double tick = FPlatformTime::Seconds();
 	HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Pre Split-Loop in %f seconds."), tick - time_start);
 
+	// The simple colliders only depend on the part's positions, generate them for all the splits at once
+	TArray<FKAggregateGeom> AllSimpleCollisions;
+	GenerateAllSimpleCollisions(AllSimpleCollisions);
+
 	// Iterate through all detected split groups we care about and split geometry.
 	// The split are ordered in the following way:
 	// Invisible Simple/Convex Colliders > LODs > MainGeo > Visible Colliders > Invisible Colliders
@@ -2660,10 +3022,10 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		const FString& SplitGroupName = AllSplitGroups[SplitId];
 
 		// Get the vertex indices for this group
-		TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
+		TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitId];
 
 		// Get valid count of vertex indices for this split.
-		const int32& SplitVertexCount = AllSplitVertexCounts[SplitGroupName];
+		const int32& SplitVertexCount = AllSplitVertexCounts[SplitId];
 
 		// Make sure we have a  valid vertex count for this split
 		if (SplitVertexCount % 3 != 0 || SplitVertexList.Num() % 3 != 0)
@@ -2693,8 +3055,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		FHoudiniOutputObjectIdentifier OutputObjectIdentifier(
 			HGPO.ObjectId, HGPO.GeoId, HGPO.PartId, GetMeshIdentifierFromSplit(SplitGroupName, SplitType));
 		OutputObjectIdentifier.PartName = HGPO.PartName;
-		OutputObjectIdentifier.PrimitiveIndex = AllSplitFirstValidVertexIndex[SplitGroupName],
-		OutputObjectIdentifier.PointIndex = AllSplitFirstValidPrimIndex[SplitGroupName];		
+		OutputObjectIdentifier.PrimitiveIndex = AllSplitFirstValidVertexIndex[SplitId],
+		OutputObjectIdentifier.PointIndex = AllSplitFirstValidPrimIndex[SplitId];		
 
 		// Get/Create the Aggregate Collisions for this mesh identifier
 		FKAggregateGeom& AggregateCollisions = AllAggregateCollisions.FindOrAdd(OutputObjectIdentifier);
@@ -2706,7 +3068,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			UpdatePartPositionIfNeeded();
 
 			// Create the convex hull colliders and add them to the Aggregate
-			if (!AddConvexCollisionToAggregate(SplitGroupName, AggregateCollisions))
+			if (!AddConvexCollisionToAggregate(SplitId, AggregateCollisions))
 			{
 				// Failed to generate a convex collider
 				HOUDINI_LOG_WARNING(
@@ -2720,13 +3082,14 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		}
 		else if (SplitType == EHoudiniSplitType::InvisibleSimpleCollider || SplitType == EHoudiniSplitType::RenderedSimpleCollider)
 		{
-			// Get the part position if needed
-			UpdatePartPositionIfNeeded();
+			// Add the simple colliders generated for this split to the aggregate
+			const FKAggregateGeom* SplitSimpleCollisions = AllSimpleCollisions.IsValidIndex(SplitId) ? &AllSimpleCollisions[SplitId] : nullptr;
+			if (SplitSimpleCollisions)
+				AppendAggregateCollisions(*SplitSimpleCollisions, AggregateCollisions);
 
-			// Create the simple colliders and add them to the aggregate
-			if (!AddSimpleCollisionToAggregate(SplitGroupName, AggregateCollisions))
+			if (!SplitSimpleCollisions || SplitSimpleCollisions->GetElementCount() <= 0)
 			{
-				// Failed to generate a convex collider
+				// Failed to generate a simple collider
 				HOUDINI_LOG_WARNING(
 					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] failed to create simple collider."),
 					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
@@ -2739,8 +3102,14 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 
 		// Try to find existing properties for this identifier
 		FHoudiniOutputObject* FoundOutputObject = InputObjects.Find(OutputObjectIdentifier);
-		// Try to find an existing SM from a previous cook
-		UStaticMesh* FoundStaticMesh = FindExistingStaticMesh(OutputObjectIdentifier);
+		// Try to find the SM used by a previous split (LODs), or an existing SM from a previous cook
+		UStaticMesh** PendingStaticMesh = PendingStaticMeshes.Find(OutputObjectIdentifier);
+		UStaticMesh* FoundStaticMesh = PendingStaticMesh ? *PendingStaticMesh : FindExistingStaticMesh(OutputObjectIdentifier);
+
+		// A SM shared with identical parts must not be updated in place, create a new one instead
+		const bool bFoundSharedStaticMesh = !PendingStaticMesh && FoundStaticMesh && IsStaticMeshShared(FoundStaticMesh, OutputObjectIdentifier);
+		if (bFoundSharedStaticMesh)
+			FoundStaticMesh = nullptr;
 
 		// Flag whether or not we need to rebuild the mesh
 		bool bRebuildStaticMesh = false;
@@ -2762,7 +3131,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		if (!FoundStaticMesh)
 		{
 			// If we couldn't find a valid existing static mesh, create a new one
-			FoundStaticMesh = CreateNewStaticMesh(OutputObjectIdentifier.SplitIdentifier);
+			FoundStaticMesh = CreateNewStaticMesh(OutputObjectIdentifier.SplitIdentifier, bFoundSharedStaticMesh);
 			if (!FoundStaticMesh || FoundStaticMesh->IsPendingKill())
 				continue;
 
@@ -2825,17 +3194,14 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		int32 LODIndex = 0;
 		if (SplitType == EHoudiniSplitType::LOD)
 		{
-			for (auto& curSplit : AllSplitGroups)
+			for (int32 CurSplitId = 0; CurSplitId <= SplitId; CurSplitId++)
 			{
-				EHoudiniSplitType CurrentSplitType = GetSplitTypeFromSplitName(curSplit);
+				EHoudiniSplitType CurrentSplitType = GetSplitTypeFromSplitName(AllSplitGroups[CurSplitId]);
 				if (CurrentSplitType == EHoudiniSplitType::LOD
 					|| CurrentSplitType == EHoudiniSplitType::Normal)
 				{
 					LODIndex++;
 				}
-
-				if (curSplit == SplitGroupName)
-					break;
 			}
 
 			// Fix for the case where we don't have a main geo
@@ -2856,8 +3222,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - PreMeshDescription in %f seconds."), FPlatformTime::Seconds() - tick);
 		tick = FPlatformTime::Seconds();
 
-		bool bHasNormal = false;
-		bool bHasTangents = false;
+		// Index of this split's build data, if its MeshDescription needs to be built
+		int32 BuildIndex = INDEX_NONE;
 
 		// Load the existing mesh description if we don't need to rebuild the mesh		
 		FMeshDescription* MeshDescription;
@@ -2880,163 +3246,33 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			// and what vertices/indices belong to each material for remapping
 
 			//--------------------------------------------------------------------------------------------------------------------- 
-			//  INDICES
-			//--------------------------------------------------------------------------------------------------------------------- 
-
-			//
-			// Because of the splits, we don't need to declare all the vertices in the Part, 
-			// but only the one that are currently used by the split's faces.
-			// The indicesMapper array is used to map those indices from Part Vertices to Split Vertices.
-			// We also keep track of the needed vertices index to declare them easily afterwards.
-			//
+			// MATERIALS
+			//---------------------------------------------------------------------------------------------------------------------
 
-			// SplitNeededVertices
-			// Array containing the (unique) part indices for the vertices that are needed for this split
-			// SplitNeededVertices[splitIndex] = PartIndex
-			TArray<int32> SplitNeededVertices;
-			//SplitNeededVertices.SetNumZeroed(SplitVertexCount);
+			// TODO: Check if still needed for MeshDescription
+			// We need to reset the Static Mesh's materials once per SM:
+			// so, for the first lod, or the main geo...
+			if (!MeshMaterialsHaveBeenReset && (SplitType == EHoudiniSplitType::LOD || SplitType == EHoudiniSplitType::Normal))
+			{
+				FoundStaticMesh->StaticMaterials.Empty();
+				MeshMaterialsHaveBeenReset = true;
+			}
 
-			// IndicesMapper:
-			// Maps index values for all vertices in the Part:
-			// - Vertices unused by the split will be set to -1
-			// - Used vertices will have their value set to the "NewIndex" so that IndicesMapper[ partIndex ] => splitIndex
-			TArray<int32> PartToSplitIndicesMapper;
-			PartToSplitIndicesMapper.Init(-1, SplitVertexList.Num());
-			//TMap<int32, int32> SplitToPartIndicesMapper;
+			// ..  or for each visible complex collider
+			if (SplitType == EHoudiniSplitType::RenderedComplexCollider)
+				FoundStaticMesh->StaticMaterials.Empty();
 
-			// SplitIndices
-			// Array of SplitIndices used to describe this split's polygons
-			TArray<uint32> SplitIndices;
-			SplitIndices.SetNumZeroed(SplitVertexCount);
+			// Get this split's faces
+			TArray<int32>& SplitGroupFaceIndices = AllSplitFaceIndices[SplitId];
+			// Array holding the materials needed for this split
+			//TArray<UMaterialInterface*> SplitMaterials;
+			// Split Material indices per face, by default all faces are set to use the first Material
+			TArray<int32> SplitFaceMaterialIndices;
+			SplitFaceMaterialIndices.SetNumZeroed(SplitGroupFaceIndices.Num());
 
-			int32 CurrentSplitIndex = 0;
-			int32 ValidVertexId = 0;
-			for (int32 VertexIdx = 0; VertexIdx < SplitVertexList.Num(); VertexIdx += 3)
-			{
-				int32 WedgeCheck = SplitVertexList[VertexIdx + 0];
-				if (WedgeCheck == -1)
-					continue;
-
-				int32 WedgeIndices[3] =
-				{
-					SplitVertexList[VertexIdx + 0],
-					SplitVertexList[VertexIdx + 1],
-					SplitVertexList[VertexIdx + 2]
-				};
-
-				// Ensure the indices are valid
-				if (!PartToSplitIndicesMapper.IsValidIndex(WedgeIndices[0])
-					|| !PartToSplitIndicesMapper.IsValidIndex(WedgeIndices[1])
-					|| !PartToSplitIndicesMapper.IsValidIndex(WedgeIndices[2]))
-				{
-					// Invalid face index.
-					HOUDINI_LOG_MESSAGE(
-						TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] has some invalid face indices"),
-						HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
-					continue;
-				}
-
-				// Converting Old (Part) Indices to New (Split) Indices:
-				for (int32 i = 0; i < 3; i++)
-				{
-					if (PartToSplitIndicesMapper[WedgeIndices[i]] < 0)
-					{
-						// This part index has not yet been "converted" to a new split index
-						SplitNeededVertices.Add(WedgeIndices[i]);
-						PartToSplitIndicesMapper[WedgeIndices[i]] = CurrentSplitIndex;
-						//SplitToPartIndicesMapper.Add(CurrentSplitIndex, WedgeIndices[i]);
-						CurrentSplitIndex++;
-					}
-
-					// Replace the old part index with the new split index
-					WedgeIndices[i] = PartToSplitIndicesMapper[WedgeIndices[i]];
-				}
-
-				if (!SplitIndices.IsValidIndex(ValidVertexId + 2))
-					break;
-
-				// Flip wedge indices to fix the winding order.
-				SplitIndices[ValidVertexId + 0] = WedgeIndices[0];
-				SplitIndices[ValidVertexId + 1] = WedgeIndices[2];
-				SplitIndices[ValidVertexId + 2] = WedgeIndices[1];
-
-				ValidVertexId += 3;
-			}
-			
-			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Indices in %f seconds."), FPlatformTime::Seconds() - tick);
-			tick = FPlatformTime::Seconds();
-
-			//--------------------------------------------------------------------------------------------------------------------- 
-			// POSITIONS
-			//--------------------------------------------------------------------------------------------------------------------- 			
-			
-			// Extract position for this part
-			UpdatePartPositionIfNeeded();
-
-			// Transfer vertex positions:
-			//
-			// Because of the split, we're only interested in the needed vertices.
-			// Instead of declaring all the Positions, we'll only declare the vertices
-			// needed by the current split.
-			//
-			TVertexAttributesRef<FVector> VertexPositions =
-				MeshDescription->VertexAttributes().GetAttributesRef<FVector>(MeshAttribute::Vertex::Position);
-				
-			MeshDescription->ReserveNewVertices(SplitNeededVertices.Num());
-			for ( const int32& NeededVertexIndex : SplitNeededVertices)
-			{
-				// Create a new Vertex
-				FVertexID VertexID = MeshDescription->CreateVertex();
-				if (PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
-				{
-					// We need to swap Z and Y coordinate here, and convert from m to cm. 
-					VertexPositions[VertexID].X = PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-					VertexPositions[VertexID].Y = PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-					VertexPositions[VertexID].Z = PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-				}
-				else
-				{
-					// Error when retrieving positions.
-					HOUDINI_LOG_WARNING(
-						TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
-						TEXT("- skipping."),
-						HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
-
-					continue;
-				}
-			}
-
-			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Positions in %f seconds."), FPlatformTime::Seconds() - tick);
-			tick = FPlatformTime::Seconds();
-
-			//--------------------------------------------------------------------------------------------------------------------- 
-			// MATERIALS
-			//---------------------------------------------------------------------------------------------------------------------
-
-			// TODO: Check if still needed for MeshDescription
-			// We need to reset the Static Mesh's materials once per SM:
-			// so, for the first lod, or the main geo...
-			if (!MeshMaterialsHaveBeenReset && (SplitType == EHoudiniSplitType::LOD || SplitType == EHoudiniSplitType::Normal))
-			{
-				FoundStaticMesh->StaticMaterials.Empty();
-				MeshMaterialsHaveBeenReset = true;
-			}
-
-			// ..  or for each visible complex collider
-			if (SplitType == EHoudiniSplitType::RenderedComplexCollider)
-				FoundStaticMesh->StaticMaterials.Empty();
-
-			// Get this split's faces
-			TArray<int32>& SplitGroupFaceIndices = AllSplitFaceIndices[SplitGroupName];
-			// Array holding the materials needed for this split
-			//TArray<UMaterialInterface*> SplitMaterials;
-			// Split Material indices per face, by default all faces are set to use the first Material
-			TArray<int32> SplitFaceMaterialIndices;
-			SplitFaceMaterialIndices.SetNumZeroed(SplitGroupFaceIndices.Num());
-
-			bool HasHoudiniMaterials = PartUniqueMaterialIds.Num() > 0;
-			bool HasMaterialOverrides = PartFaceMaterialOverrides.Num() > 0;
-			if (!HasHoudiniMaterials && !HasMaterialOverrides)
+			bool HasHoudiniMaterials = PartUniqueMaterialIds.Num() > 0;
+			bool HasMaterialOverrides = PartFaceMaterialOverrides.Num() > 0;
+			if (!HasHoudiniMaterials && !HasMaterialOverrides)
 			{
 				// We don't have any material override or houdini material
 				// we just need one polygon group using the default Houdini material.
@@ -3245,277 +3481,24 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Materials in %f seconds."), FPlatformTime::Seconds() - tick);
 			tick = FPlatformTime::Seconds();
 
-			//
-			// VERTEX INSTANCE ATTRIBUTES
-			// NORMALS, TANGENTS, COLORS, UVS, Alpha
-			//
-
-			// Extract the normals
+			// Update the part caches used by this split now:
+			// its geometry is built on worker threads once all the splits have been processed
+			UpdatePartPositionIfNeeded();
 			UpdatePartNormalsIfNeeded();
-			// Get the normals for this split
-			TArray<float> SplitNormals;
-			FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-				SplitVertexList, AttribInfoNormals, PartNormals, SplitNormals);
-
-			TVertexInstanceAttributesRef<FVector> VertexInstanceNormals = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector>(MeshAttribute::VertexInstance::Normal);
-
-			// No need to read the tangents if we want unreal to recompute them after
-			const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
-			bool bReadTangents = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->RecomputeTangentsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always : true;
-
-			// Extract the tangents
-			TArray<float> SplitTangentU;
-			TArray<float> SplitTangentV;
 			if (bReadTangents)
-			{
-				// Extract this part's Tangents if needed
 				UpdatePartTangentsIfNeeded();
-
-				// Get the Tangents for this split
-				FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-					SplitVertexList, AttribInfoTangentU, PartTangentU, SplitTangentU);
-
-				// Get the binormals for this split
-				FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-					SplitVertexList, AttribInfoTangentV, PartTangentV, SplitTangentV);
-
-				// We need to manually generate tangents if:
-				// - we have normals but dont have tangentu or tangentv attributes
-				// - we have not specified that we wanted unreal to generate them
-				int32 NormalCount = SplitNormals.Num();
-				bool bGenerateTangents = (NormalCount > 0) && (SplitTangentU.Num() <= 0 || SplitTangentV.Num() <= 0);
-				// Check that the number of tangents read matches the number of normals
-				if (SplitTangentU.Num() != NormalCount || SplitTangentV.Num() != NormalCount)
-					bGenerateTangents = true;
-
-				if (bGenerateTangents && (HoudiniRuntimeSettings->RecomputeTangentsFlag == EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always))
-				{
-					// No need to generate tangents if we want unreal to recompute them after
-					bGenerateTangents = false;
-				}
-
-				// Generate the tangents if needed
-				if (bGenerateTangents)
-				{
-					SplitTangentU.SetNumZeroed(NormalCount);
-					SplitTangentV.SetNumZeroed(NormalCount);
-					for (int32 Idx = 0; Idx + 2 < NormalCount; Idx += 3)
-					{
-						FVector TangentZ;
-						TangentZ.X = SplitNormals[Idx + 0];
-						TangentZ.Y = SplitNormals[Idx + 2];
-						TangentZ.Z = SplitNormals[Idx + 1];
-
-						FVector TangentX, TangentY;
-						TangentZ.FindBestAxisVectors(TangentX, TangentY);
-
-						SplitTangentU[Idx + 0] = TangentX.X;
-						SplitTangentU[Idx + 2] = TangentX.Y;
-						SplitTangentU[Idx + 1] = TangentX.Z;
-
-						SplitTangentV[Idx + 0] = TangentY.X;
-						SplitTangentV[Idx + 2] = TangentY.Y;
-						SplitTangentV[Idx + 1] = TangentY.Z;
-					}
-				}
-			}
-			TVertexInstanceAttributesRef<FVector> VertexInstanceTangents = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector>(MeshAttribute::VertexInstance::Tangent);
-			TVertexInstanceAttributesRef<float> VertexInstanceBinormalSigns = MeshDescription->VertexInstanceAttributes().GetAttributesRef<float>(MeshAttribute::VertexInstance::BinormalSign);
-
-			// Extract the color values
 			UpdatePartColorsIfNeeded();
-			// Get the colors values for this split
-			TArray<float> SplitColors;
-			FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-				SplitVertexList, AttribInfoColors, PartColors, SplitColors);
-
-			// Extract the alpha values
 			UpdatePartAlphasIfNeeded();
-			// Get the colors values for this split
-			TArray<float> SplitAlphas;
-			FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-				SplitVertexList, AttribInfoAlpha, PartAlphas, SplitAlphas);
-			TVertexInstanceAttributesRef<FVector4> VertexInstanceColors = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector4>(MeshAttribute::VertexInstance::Color);
-
-			// Extract UVs
 			UpdatePartUVSetsIfNeeded(true);
-			// See if we need to transfer uv point attributes to vertex attributes.
-			int32 UVSetCount = PartUVSets.Num();
-			TArray<TArray<float>> SplitUVSets;
-			SplitUVSets.SetNum(UVSetCount);
-			for (int32 TexCoordIdx = 0; TexCoordIdx < UVSetCount; TexCoordIdx++)
-			{
-				FHoudiniMeshTranslator::TransferPartAttributesToSplit<float>(
-					SplitVertexList, AttribInfoUVSets[TexCoordIdx], PartUVSets[TexCoordIdx], SplitUVSets[TexCoordIdx]);
-			}
-			TVertexInstanceAttributesRef<FVector2D> VertexInstanceUVs = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector2D>(MeshAttribute::VertexInstance::TextureCoordinate);					
-			VertexInstanceUVs.SetNumIndices(UVSetCount);
-
-			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - VertexAttr extracted in %f seconds."), FPlatformTime::Seconds() - tick);
-			tick = FPlatformTime::Seconds();
-
-			// Allocate space for the vertex instances and polygons
-			MeshDescription->ReserveNewVertexInstances(SplitIndices.Num());
-			MeshDescription->ReserveNewPolygons(SplitIndices.Num() / 3);
-			//Approximately 2.5 edges per polygons
-			MeshDescription->ReserveNewEdges(SplitIndices.Num() * 2.5f / 3);
-
-			bHasNormal = SplitNormals.Num() > 0;
-			bHasTangents = SplitTangentU.Num() > 0 && SplitTangentV.Num() > 0;
-			bool bHasRGB = SplitColors.Num() > 0;
-			bool bHasRGBA = bHasRGB && AttribInfoColors.tupleSize == 4;
-			bool bHasAlpha = SplitAlphas.Num() > 0;
-
-			TArray<bool> HasUVSets;
-			HasUVSets.SetNumZeroed(PartUVSets.Num());
-			for (int32 Idx = 0; Idx < PartUVSets.Num(); Idx++)
-				HasUVSets[Idx] = PartUVSets[Idx].Num() > 0;
-
-			uint32 FaceCount = SplitIndices.Num() / 3;
-			for (uint32 FaceIndex = 0; FaceIndex < FaceCount; FaceIndex++)
-			{
-				TArray<FVertexInstanceID> FaceVertexInstanceIDs;
-				FaceVertexInstanceIDs.SetNum(3);
-
-				// Ignore degenerate triangles
-				FVertexID VertexIDs[3];
-				for (int32 Corner = 0; Corner < 3; ++Corner)
-				{
-					VertexIDs[Corner] = FVertexID(SplitIndices[(FaceIndex * 3) + Corner]);
-				}
-				if (VertexIDs[0] == VertexIDs[1] || VertexIDs[0] == VertexIDs[2] || VertexIDs[1] == VertexIDs[2])
-					continue;
-
-				//FVertexID FaceVertexIDs[3];
-				for (int32 Corner = 0; Corner < 3; Corner++)
-				{
-					uint32 SplitIndex = (FaceIndex * 3) + Corner;
-					uint32 SplitVertexIndex = SplitIndices[SplitIndex];
-					const FVertexInstanceID& VertexInstanceID = MeshDescription->CreateVertexInstance(FVertexID(SplitVertexIndex));
-
-					// Fix the winding order by updating the SplitIndex (invert corner 1 and 2)
-					// instead of going 0 1 2 go 0 2 1
-					// TODO; this slows down StaticMesh->Build() considerably!
-					Corner == 1 ? SplitIndex++ : Corner == 2 ? SplitIndex-- : SplitIndex;
-
-					const uint32 SplitVertexIndex_X = SplitIndex * 3 + 0;
-					const uint32 SplitVertexIndex_Y = SplitIndex * 3 + 2;
-					const uint32 SplitVertexIndex_Z = SplitIndex * 3 + 1;
-					// Normals
-					if (bHasNormal)
-					{
-						// We need to swap Z and Y coordinate here, and convert from m to cm. 
-						VertexInstanceNormals[VertexInstanceID].X = SplitNormals[SplitVertexIndex_X];
-						VertexInstanceNormals[VertexInstanceID].Y = SplitNormals[SplitVertexIndex_Y];
-						VertexInstanceNormals[VertexInstanceID].Z = SplitNormals[SplitVertexIndex_Z];
-					}
-
-					// Tangents and binormals
-					if (bHasTangents)
-					{
-						// We need to swap Z and Y coordinate here, and convert from m to cm.
-						VertexInstanceTangents[VertexInstanceID].X = SplitTangentU[SplitVertexIndex_X];
-						VertexInstanceTangents[VertexInstanceID].Y = SplitTangentU[SplitVertexIndex_Y];
-						VertexInstanceTangents[VertexInstanceID].Z = SplitTangentU[SplitVertexIndex_Z];
-
-						FVector TangentY;
-						TangentY.X = SplitTangentV[SplitVertexIndex_X];
-						TangentY.Y = SplitTangentV[SplitVertexIndex_Y];
-						TangentY.Z = SplitTangentV[SplitVertexIndex_Z];
-
-						VertexInstanceBinormalSigns[VertexInstanceID] = GetBasisDeterminantSign(
-							VertexInstanceTangents[VertexInstanceID].GetSafeNormal(),
-							TangentY.GetSafeNormal(),
-							VertexInstanceNormals[VertexInstanceID].GetSafeNormal());
-					}
-
-					// Color
-					FLinearColor Color = FLinearColor::White;
-					if (bHasRGB)
-					{
-						Color.R = FMath::Clamp(
-							SplitColors[SplitIndex * AttribInfoColors.tupleSize + 0], 0.0f, 1.0f);
-						Color.G = FMath::Clamp(
-							SplitColors[SplitIndex * AttribInfoColors.tupleSize + 1], 0.0f, 1.0f);
-						Color.B = FMath::Clamp(
-							SplitColors[SplitIndex * AttribInfoColors.tupleSize + 2], 0.0f, 1.0f);
-					}
-					// Alpha
-					if (bHasAlpha)
-					{
-						Color.A = FMath::Clamp(SplitAlphas[SplitIndex], 0.0f, 1.0f);
-					}
-					else if (bHasRGBA)
-					{
-						Color.A = FMath::Clamp(SplitColors[SplitIndex * AttribInfoColors.tupleSize + 3], 0.0f, 1.0f);
-					}
-					VertexInstanceColors[VertexInstanceID] = FVector4(Color);
-
-					// UVs
-					for (int32 UVIndex = 0; UVIndex < SplitUVSets.Num(); UVIndex++)
-					{
-						if (HasUVSets[UVIndex])
-						{
-							// We need to flip V coordinate when it's coming from HAPI.
-							FVector2D CurrentUV;
-							CurrentUV.X = SplitUVSets[UVIndex][SplitIndex * 2 + 0];
-							CurrentUV.Y = 1.0f - SplitUVSets[UVIndex][SplitIndex * 2 + 1];
-
-							VertexInstanceUVs.Set(VertexInstanceID, UVIndex, CurrentUV);
-						}
-					}
-
-					FaceVertexInstanceIDs[Corner] = VertexInstanceID;
-				}
-
-				const FPolygonGroupID PolygonGroupID(SplitFaceMaterialIndices[FaceIndex]);
-
-				// Insert a triangle into the mesh
-				MeshDescription->CreateTriangle(PolygonGroupID, FaceVertexInstanceIDs);
-			}
-
-			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - VertexAttr filled in %f seconds."), FPlatformTime::Seconds() - tick);
-			tick = FPlatformTime::Seconds();
-
-			//--------------------------------------------------------------------------------------------------------------------- 
-			//  FACE SMOOTHING
-			//---------------------------------------------------------------------------------------------------------------------
-
-			// Extract this part's FaceSmoothing values if needed
 			UpdatePartFaceSmoothingIfNeeded();
 
-			// Get the FaceSmoothing values for this split
-			TArray<int32> SplitFaceSmoothingMasks;
-			FHoudiniMeshTranslator::TransferPartAttributesToSplit<int32>(
-				SplitVertexList, AttribInfoFaceSmoothingMasks, PartFaceSmoothingMasks, SplitFaceSmoothingMasks);
-
-			// FaceSmoothing masks must be initialized even if we don't have a value from Houdini!
-			// TODO: Expose the default FaceSmoothing value
-			// 0 will make hard face
-			TArray<uint32> FaceSmoothingMasks;
-			FaceSmoothingMasks.Init(DefaultMeshSmoothing, SplitVertexCount / 3);
-
-			// Check that the number of face smoothing values we retrieved is correct
-			int32 WedgeFaceSmoothCount = SplitFaceSmoothingMasks.Num() / 3;
-			if (SplitFaceSmoothingMasks.Num() != 0 && !SplitFaceSmoothingMasks.IsValidIndex((WedgeFaceSmoothCount - 1) * 3 + 2))
-			{
-				// Ignore our face smoothing values
-				WedgeFaceSmoothCount = 0;
-				HOUDINI_LOG_WARNING(TEXT("Invalid face smoothing mask count detected - Skipping them."));
-			}
-
-			// Transfer the face smoothing masks to the raw mesh if we have any
-			for (int32 WedgeFaceSmoothIdx = 0; WedgeFaceSmoothIdx < WedgeFaceSmoothCount; WedgeFaceSmoothIdx += 3)
-			{
-				FaceSmoothingMasks[WedgeFaceSmoothIdx] = SplitFaceSmoothingMasks[WedgeFaceSmoothIdx * 3];
-			}
-
-			// TODO
-			// Check
-			FStaticMeshOperations::ConvertSmoothGroupToHardEdges(FaceSmoothingMasks, *MeshDescription);
-
-			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - FaceSoothing filled in %f seconds."), FPlatformTime::Seconds() - tick);
-			tick = FPlatformTime::Seconds();
+			BuildIndex = AllBuildData.Num();
+			FMeshDescriptionBuildData& BuildData = AllBuildData.AddDefaulted_GetRef();
+			BuildData.SplitId = SplitId;
+			BuildData.SplitGroupName = SplitGroupName;
+			BuildData.MeshDescription = MeshDescription;
+			BuildData.SplitFaceMaterialIndices = MoveTemp(SplitFaceMaterialIndices);
+			BuildData.bReadTangents = bReadTangents;
 
 			//--------------------------------------------------------------------------------------------------------------------- 
 			// LIGHTMAP RESOLUTION
@@ -3527,6 +3510,65 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			FoundStaticMesh->LightingGuid = FGuid::NewGuid();
 		}
 
+		FSplitToFinalize& SplitToFinalize = SplitsToFinalize.AddDefaulted_GetRef();
+		SplitToFinalize.SplitId = SplitId;
+		SplitToFinalize.SplitGroupName = SplitGroupName;
+		SplitToFinalize.OutputObjectIdentifier = OutputObjectIdentifier;
+		SplitToFinalize.StaticMesh = FoundStaticMesh;
+		SplitToFinalize.LODIndex = LODIndex;
+		SplitToFinalize.bNewStaticMeshCreated = bNewStaticMeshCreated;
+		SplitToFinalize.BuildIndex = BuildIndex;
+
+		// The following splits using the same identifier (LODs) need to use the same static mesh
+		PendingStaticMeshes.Add(OutputObjectIdentifier, FoundStaticMesh);
+	}
+
+	// Build the splits' MeshDescriptions concurrently, they only read the part caches
+	if (AllBuildData.Num() > 0)
+	{
+		const double BuildStart = FPlatformTime::Seconds();
+		ParallelFor(AllBuildData.Num(), [&](int32 BuildIdx)
+		{
+			const double SplitBuildStart = FPlatformTime::Seconds();
+			BuildSplitMeshDescription(AllBuildData[BuildIdx]);
+			AllBuildData[BuildIdx].BuildTime = FPlatformTime::Seconds() - SplitBuildStart;
+		}, AllBuildData.Num() <= 1);
+		const double BuildTime = FPlatformTime::Seconds() - BuildStart;
+
+		double SplitsBuildTime = 0.0;
+		for (const FMeshDescriptionBuildData& BuildData : AllBuildData)
+			SplitsBuildTime += BuildData.BuildTime;
+
+		HOUDINI_LOG_MESSAGE(
+			TEXT("CreateStaticMesh_MeshDescription() - Built %d MeshDescriptions in %f seconds (%f seconds of split builds, x%.2f)."),
+			AllBuildData.Num(), BuildTime, SplitsBuildTime, BuildTime > 0.0 ? SplitsBuildTime / BuildTime : 1.0);
+		tick = FPlatformTime::Seconds();
+	}
+
+	// Commit the MeshDescriptions and finish updating the static meshes, in the splits order
+	for (const FSplitToFinalize& SplitToFinalize : SplitsToFinalize)
+	{
+		const int32& SplitId = SplitToFinalize.SplitId;
+		const FString& SplitGroupName = SplitToFinalize.SplitGroupName;
+		const FHoudiniOutputObjectIdentifier& OutputObjectIdentifier = SplitToFinalize.OutputObjectIdentifier;
+		UStaticMesh* FoundStaticMesh = SplitToFinalize.StaticMesh;
+		const int32& LODIndex = SplitToFinalize.LODIndex;
+		const bool& bNewStaticMeshCreated = SplitToFinalize.bNewStaticMeshCreated;
+		FStaticMeshSourceModel* SrcModel = &(FoundStaticMesh->GetSourceModel(LODIndex));
+
+		bool bHasNormal = false;
+		bool bHasTangents = false;
+		if (AllBuildData.IsValidIndex(SplitToFinalize.BuildIndex))
+		{
+			bHasNormal = AllBuildData[SplitToFinalize.BuildIndex].bHasNormal;
+			bHasTangents = AllBuildData[SplitToFinalize.BuildIndex].bHasTangents;
+		}
+
+		// Output objects added by the following splits might have reallocated the map, look them up again
+		FHoudiniOutputObject* FoundOutputObject = InputObjects.Find(OutputObjectIdentifier);
+		if (!FoundOutputObject)
+			FoundOutputObject = OutputObjects.Find(OutputObjectIdentifier);
+
 		// Update the Build Settings using the default setting values
 		SetMeshBuildSettings(
 			SrcModel->BuildSettings,
@@ -3569,7 +3611,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		
 		// LOD Screensize
 		// default values has already been set, see if we have any attribute override for this
-		float screensize = GetLODSCreensizeForSplit(SplitGroupName);
+		float screensize = GetLODSCreensizeForSplit(SplitId);
 		if (screensize >= 0.0f)
 		{
 			// Only apply the LOD screensize if it's valid
@@ -3588,74 +3630,32 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		TArray<FHoudiniGenericAttribute> PropertyAttributes;
 		if (GetGenericPropertiesAttributes(
 			HGPO.GeoId, HGPO.PartId,
-			AllSplitFirstValidVertexIndex[SplitGroupName],
-			AllSplitFirstValidPrimIndex[SplitGroupName],
+			AllSplitFirstValidVertexIndex[SplitId],
+			AllSplitFirstValidPrimIndex[SplitId],
 			PropertyAttributes))
 		{
 			UpdateGenericPropertiesAttributes(
 				FoundStaticMesh, PropertyAttributes);
 		}
 
-		TArray<FString> LevelPaths;
-		if (FoundOutputObject && FHoudiniEngineUtils::GetLevelPathAttribute(HGPO.GeoId, HGPO.PartId, LevelPaths))
-		{
-			if (LevelPaths.Num() > 0 && !LevelPaths[0].IsEmpty())
-			{
-				// cache the level path attribute on the output object
-				FoundOutputObject->CachedAttributes.Add(HAPI_UNREAL_ATTRIB_LEVEL_PATH, LevelPaths[0]);
-			}
-		}
+		// Cache the output attributes needed for baking on the output object
+		if (FoundOutputObject)
+			CacheOutputObjectAttributes(*FoundOutputObject);
 
-		TArray<FString> OutputNames;
-		if (FoundOutputObject && FHoudiniEngineUtils::GetOutputNameAttribute(HGPO.GeoId, HGPO.PartId, OutputNames))
-		{
-			if (OutputNames.Num() > 0 && !OutputNames[0].IsEmpty())
-			{
-				// cache the output name attribute on the output object
-				FoundOutputObject->CachedAttributes.Add(HAPI_UNREAL_ATTRIB_CUSTOM_OUTPUT_NAME_V2, OutputNames[0]);
-			}
-		}
+		// Notify that we created a new Static Mesh if needed
+		if(bNewStaticMeshCreated)
+			FAssetRegistryModule::AssetCreated(FoundStaticMesh);
 
-		TArray<int32> TileValues;
-		if (FoundOutputObject && FHoudiniEngineUtils::GetTileAttribute(HGPO.GeoId, HGPO.PartId, TileValues))
-		{
-			if (TileValues.Num() > 0 && TileValues[0] >= 0)
-			{
-				// cache the tile attribute as a token on the output object
-				FoundOutputObject->CachedTokens.Add(TEXT("tile"), FString::FromInt(TileValues[0]));
-			}
-		}
-
-		TArray<FString> BakeOutputActorNames;
-		if (FoundOutputObject && FHoudiniEngineUtils::GetBakeActorAttribute(HGPO.GeoId, HGPO.PartId, BakeOutputActorNames))
-		{
-			if (BakeOutputActorNames.Num() > 0 && !BakeOutputActorNames[0].IsEmpty())
-			{
-				// cache the bake actor attribute on the output object
-				FoundOutputObject->CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_ACTOR, BakeOutputActorNames[0]);
-			}
-		}
-
-		TArray<FString> BakeOutlinerFolders;
-		if (FoundOutputObject && FHoudiniEngineUtils::GetBakeOutlinerFolderAttribute(HGPO.GeoId, HGPO.PartId, BakeOutlinerFolders))
-		{
-			if (BakeOutlinerFolders.Num() > 0 && !BakeOutlinerFolders[0].IsEmpty())
-			{
-				// cache the bake actor attribute on the output object
-				FoundOutputObject->CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_OUTLINER_FOLDER, BakeOutlinerFolders[0]);
-			}
-		}
-
-		// Notify that we created a new Static Mesh if needed
-		if(bNewStaticMeshCreated)
-			FAssetRegistryModule::AssetCreated(FoundStaticMesh);
-
-		// Add the Static mesh to the output maps and the build map if we haven't already
-		if (FoundOutputObject)
+		// Add the Static mesh to the output maps and the build map if we haven't already
+		if (FoundOutputObject)
 		{
 			FoundOutputObject->OutputObject = FoundStaticMesh;
+			FoundOutputObject->GeometryHash = PartGeometryHash;
+			FoundOutputObject->GeometryPivot = PartGeometryPivot;
+			FoundOutputObject->MeshOffset = FVector::ZeroVector;
 			FoundOutputObject->bProxyIsCurrent = false;
 			OutputObjects.FindOrAdd(OutputObjectIdentifier, *FoundOutputObject);
+			RegisterSharedStaticMesh(OutputObjectIdentifier.SplitIdentifier, *FoundOutputObject);
 		}
 
 		StaticMeshToBuild.FindOrAdd(OutputObjectIdentifier, FoundStaticMesh);
@@ -3748,41 +3748,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		}
 
 		// BUILD the Static Mesh
-		// bSilent doesnt add the Build Errors...
-		double build_start = FPlatformTime::Seconds();
-		TArray<FText> SMBuildErrors;
-		SM->Build(true, &SMBuildErrors);
-		double build_end = FPlatformTime::Seconds();
-		HOUDINI_LOG_MESSAGE(TEXT("StaticMesh->Build() executed in %f seconds."), build_end - build_start);
-
-		// TODO: copied the content of RefreshCollision below and commented out CreateNavCollision
-		// it is already called by UStaticMesh::PostBuildInternal as part of the ::Build call,
-		// and can be expensive depending on the vert/poly count of the mesh
-		// TODO: also moved this to after the call to Build, since Build updates the mesh's
-		// physics state (calling this before Build when rebuilding an existing high poly mesh as 
-		// low poly mesh, incurs quite a performance hit. This is likely due to processing of physics
-		// meshes with high vert/poly count before the Build
-		// RefreshCollisionChange(*SM);
-		{
-			// SM->CreateNavCollision(/*bIsUpdate=*/true);
-
-			for (FObjectIterator Iter(UStaticMeshComponent::StaticClass()); Iter; ++Iter)
-			{
-				UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(*Iter);
-				if (StaticMeshComponent->GetStaticMesh() == SM)
-				{
-					// it needs to recreate IF it already has been created
-					if (StaticMeshComponent->IsPhysicsStateCreated())
-					{
-						StaticMeshComponent->RecreatePhysicsState();
-					}
-				}
-			}
-
-			FEditorSupportDelegates::RedrawAllViewports.Broadcast();
-		}
-
-		SM->GetOnMeshChanged().Broadcast();
+		// The build is deferred until the end of the cook if a build batch is opened
+		BuildStaticMesh(SM);
 		/*
 		// Try to find the outer package so we can dirty it up
 		if (SM->GetOuter())
@@ -3845,6 +3812,381 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 	return true;
 }
 
+void
+FHoudiniMeshTranslator::BuildSplitMeshDescription(FMeshDescriptionBuildData& InOutBuildData) const
+{
+	const int32& SplitId = InOutBuildData.SplitId;
+	const FString& SplitGroupName = InOutBuildData.SplitGroupName;
+	FMeshDescription* MeshDescription = InOutBuildData.MeshDescription;
+	const TArray<int32>& SplitFaceMaterialIndices = InOutBuildData.SplitFaceMaterialIndices;
+	if (!MeshDescription)
+		return;
+
+	// Get the vertex indices for this group
+	const TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitId];
+	// Get valid count of vertex indices for this split.
+	const int32& SplitVertexCount = AllSplitVertexCounts[SplitId];
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	//  INDICES
+	//--------------------------------------------------------------------------------------------------------------------- 
+
+	//
+	// Because of the splits, we don't need to declare all the vertices in the Part, 
+	// but only the one that are currently used by the split's faces.
+	// The indicesMapper array is used to map those indices from Part Vertices to Split Vertices.
+	// We also keep track of the needed vertices index to declare them easily afterwards.
+	//
+
+	// SplitNeededVertices
+	// Array containing the (unique) part indices for the vertices that are needed for this split
+	// SplitNeededVertices[splitIndex] = PartIndex
+	TArray<int32> SplitNeededVertices;
+	//SplitNeededVertices.SetNumZeroed(SplitVertexCount);
+
+	// IndicesMapper:
+	// Maps index values for all vertices in the Part:
+	// - Vertices unused by the split will be set to -1
+	// - Used vertices will have their value set to the "NewIndex" so that IndicesMapper[ partIndex ] => splitIndex
+	TArray<int32> PartToSplitIndicesMapper;
+	PartToSplitIndicesMapper.Init(-1, SplitVertexList.Num());
+	//TMap<int32, int32> SplitToPartIndicesMapper;
+
+	// SplitIndices
+	// Array of SplitIndices used to describe this split's polygons
+	TArray<uint32> SplitIndices;
+	SplitIndices.SetNumZeroed(SplitVertexCount);
+
+	int32 CurrentSplitIndex = 0;
+	int32 ValidVertexId = 0;
+	for (int32 VertexIdx = 0; VertexIdx < SplitVertexList.Num(); VertexIdx += 3)
+	{
+		int32 WedgeCheck = SplitVertexList[VertexIdx + 0];
+		if (WedgeCheck == -1)
+			continue;
+
+		int32 WedgeIndices[3] =
+		{
+			SplitVertexList[VertexIdx + 0],
+			SplitVertexList[VertexIdx + 1],
+			SplitVertexList[VertexIdx + 2]
+		};
+
+		// Ensure the indices are valid
+		if (!PartToSplitIndicesMapper.IsValidIndex(WedgeIndices[0])
+			|| !PartToSplitIndicesMapper.IsValidIndex(WedgeIndices[1])
+			|| !PartToSplitIndicesMapper.IsValidIndex(WedgeIndices[2]))
+		{
+			// Invalid face index.
+			HOUDINI_LOG_MESSAGE(
+				TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] has some invalid face indices"),
+				HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
+			continue;
+		}
+
+		// Converting Old (Part) Indices to New (Split) Indices:
+		for (int32 i = 0; i < 3; i++)
+		{
+			if (PartToSplitIndicesMapper[WedgeIndices[i]] < 0)
+			{
+				// This part index has not yet been "converted" to a new split index
+				SplitNeededVertices.Add(WedgeIndices[i]);
+				PartToSplitIndicesMapper[WedgeIndices[i]] = CurrentSplitIndex;
+				//SplitToPartIndicesMapper.Add(CurrentSplitIndex, WedgeIndices[i]);
+				CurrentSplitIndex++;
+			}
+
+			// Replace the old part index with the new split index
+			WedgeIndices[i] = PartToSplitIndicesMapper[WedgeIndices[i]];
+		}
+
+		if (!SplitIndices.IsValidIndex(ValidVertexId + 2))
+			break;
+
+		// Flip wedge indices to fix the winding order.
+		SplitIndices[ValidVertexId + 0] = WedgeIndices[0];
+		SplitIndices[ValidVertexId + 1] = WedgeIndices[2];
+		SplitIndices[ValidVertexId + 2] = WedgeIndices[1];
+
+		ValidVertexId += 3;
+	}
+	
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// POSITIONS
+	//--------------------------------------------------------------------------------------------------------------------- 			
+	
+	// Transfer vertex positions:
+	//
+	// Because of the split, we're only interested in the needed vertices.
+	// Instead of declaring all the Positions, we'll only declare the vertices
+	// needed by the current split.
+	//
+	TVertexAttributesRef<FVector> VertexPositions =
+		MeshDescription->VertexAttributes().GetAttributesRef<FVector>(MeshAttribute::Vertex::Position);
+		
+	// We need to swap Z and Y coordinate here, and convert from m to cm. 
+	TArray<FVector> SplitPositions;
+	if (FHoudiniMeshConversion::GatherPositions(PartPositions, SplitNeededVertices, SplitPositions) > 0)
+	{
+		// Error when retrieving positions.
+		HOUDINI_LOG_WARNING(
+			TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
+			TEXT("- skipping."),
+			HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
+	}
+
+	MeshDescription->ReserveNewVertices(SplitPositions.Num());
+	for (const FVector& SplitPosition : SplitPositions)
+	{
+		// Create a new Vertex
+		FVertexID VertexID = MeshDescription->CreateVertex();
+		VertexPositions[VertexID] = SplitPosition;
+	}
+
+
+
+	//
+	// VERTEX INSTANCE ATTRIBUTES
+	// NORMALS, TANGENTS, COLORS, UVS, Alpha
+	//
+
+	// Get the normals for this split
+	TArray<float> SplitNormals;
+	FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+		SplitVertexList, AttribInfoNormals, PartNormals, SplitNormals);
+
+	TVertexInstanceAttributesRef<FVector> VertexInstanceNormals = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector>(MeshAttribute::VertexInstance::Normal);
+
+	// Extract the tangents, unless we want unreal to recompute them after
+	TArray<float> SplitTangentU;
+	TArray<float> SplitTangentV;
+	if (InOutBuildData.bReadTangents)
+	{
+		// Get the Tangents for this split
+		FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+			SplitVertexList, AttribInfoTangentU, PartTangentU, SplitTangentU);
+
+		// Get the binormals for this split
+		FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+			SplitVertexList, AttribInfoTangentV, PartTangentV, SplitTangentV);
+
+		// We need to manually generate tangents if:
+		// - we have normals but dont have tangentu or tangentv attributes
+		// - we have not specified that we wanted unreal to generate them
+		int32 NormalCount = SplitNormals.Num();
+		bool bGenerateTangents = (NormalCount > 0) && (SplitTangentU.Num() <= 0 || SplitTangentV.Num() <= 0);
+		// Check that the number of tangents read matches the number of normals
+		if (SplitTangentU.Num() != NormalCount || SplitTangentV.Num() != NormalCount)
+			bGenerateTangents = true;
+
+		// Generate the tangents if needed
+		if (bGenerateTangents)
+		{
+			SplitTangentU.SetNumZeroed(NormalCount);
+			SplitTangentV.SetNumZeroed(NormalCount);
+			for (int32 Idx = 0; Idx + 2 < NormalCount; Idx += 3)
+			{
+				FVector TangentZ;
+				TangentZ.X = SplitNormals[Idx + 0];
+				TangentZ.Y = SplitNormals[Idx + 2];
+				TangentZ.Z = SplitNormals[Idx + 1];
+
+				FVector TangentX, TangentY;
+				TangentZ.FindBestAxisVectors(TangentX, TangentY);
+
+				SplitTangentU[Idx + 0] = TangentX.X;
+				SplitTangentU[Idx + 2] = TangentX.Y;
+				SplitTangentU[Idx + 1] = TangentX.Z;
+
+				SplitTangentV[Idx + 0] = TangentY.X;
+				SplitTangentV[Idx + 2] = TangentY.Y;
+				SplitTangentV[Idx + 1] = TangentY.Z;
+			}
+		}
+	}
+	TVertexInstanceAttributesRef<FVector> VertexInstanceTangents = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector>(MeshAttribute::VertexInstance::Tangent);
+	TVertexInstanceAttributesRef<float> VertexInstanceBinormalSigns = MeshDescription->VertexInstanceAttributes().GetAttributesRef<float>(MeshAttribute::VertexInstance::BinormalSign);
+
+	// Get the colors values for this split
+	TArray<float> SplitColors;
+	FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+		SplitVertexList, AttribInfoColors, PartColors, SplitColors);
+
+	// Get the colors values for this split
+	TArray<float> SplitAlphas;
+	FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+		SplitVertexList, AttribInfoAlpha, PartAlphas, SplitAlphas);
+	TVertexInstanceAttributesRef<FVector4> VertexInstanceColors = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector4>(MeshAttribute::VertexInstance::Color);
+
+	// See if we need to transfer uv point attributes to vertex attributes.
+	int32 UVSetCount = PartUVSets.Num();
+	TArray<TArray<float>> SplitUVSets;
+	SplitUVSets.SetNum(UVSetCount);
+	for (int32 TexCoordIdx = 0; TexCoordIdx < UVSetCount; TexCoordIdx++)
+	{
+		FHoudiniMeshTranslator::TransferPartAttributesToSplit<float>(
+			SplitVertexList, AttribInfoUVSets[TexCoordIdx], PartUVSets[TexCoordIdx], SplitUVSets[TexCoordIdx]);
+	}
+	TVertexInstanceAttributesRef<FVector2D> VertexInstanceUVs = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector2D>(MeshAttribute::VertexInstance::TextureCoordinate);					
+	VertexInstanceUVs.SetNumIndices(UVSetCount);
+
+	// Convert normals, tangents and UVs to unreal's coordinate space and winding order
+	TArray<FVector> SplitNormalVectors;
+	TArray<FVector> SplitTangentUVectors;
+	TArray<FVector> SplitTangentVVectors;
+	FHoudiniMeshConversion::ConvertVectors(SplitNormals, SplitNormalVectors, true);
+	FHoudiniMeshConversion::ConvertVectors(SplitTangentU, SplitTangentUVectors, true);
+	FHoudiniMeshConversion::ConvertVectors(SplitTangentV, SplitTangentVVectors, true);
+
+	TArray<TArray<FVector2D>> SplitUVVectors;
+	SplitUVVectors.SetNum(UVSetCount);
+	for (int32 TexCoordIdx = 0; TexCoordIdx < UVSetCount; TexCoordIdx++)
+		FHoudiniMeshConversion::ConvertUVs(SplitUVSets[TexCoordIdx], SplitUVVectors[TexCoordIdx], true);
+
+
+	// Allocate space for the vertex instances and polygons
+	MeshDescription->ReserveNewVertexInstances(SplitIndices.Num());
+	MeshDescription->ReserveNewPolygons(SplitIndices.Num() / 3);
+	//Approximately 2.5 edges per polygons
+	MeshDescription->ReserveNewEdges(SplitIndices.Num() * 2.5f / 3);
+
+	const bool bHasNormal = SplitNormalVectors.Num() > 0;
+	const bool bHasTangents = SplitTangentUVectors.Num() > 0 && SplitTangentVVectors.Num() > 0;
+	InOutBuildData.bHasNormal = bHasNormal;
+	InOutBuildData.bHasTangents = bHasTangents;
+	bool bHasRGB = SplitColors.Num() > 0;
+	bool bHasRGBA = bHasRGB && AttribInfoColors.tupleSize == 4;
+	bool bHasAlpha = SplitAlphas.Num() > 0;
+
+	TArray<bool> HasUVSets;
+	HasUVSets.SetNumZeroed(PartUVSets.Num());
+	for (int32 Idx = 0; Idx < PartUVSets.Num(); Idx++)
+		HasUVSets[Idx] = PartUVSets[Idx].Num() > 0;
+
+	uint32 FaceCount = SplitIndices.Num() / 3;
+	for (uint32 FaceIndex = 0; FaceIndex < FaceCount; FaceIndex++)
+	{
+		TArray<FVertexInstanceID> FaceVertexInstanceIDs;
+		FaceVertexInstanceIDs.SetNum(3);
+
+		// Ignore degenerate triangles
+		FVertexID VertexIDs[3];
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			VertexIDs[Corner] = FVertexID(SplitIndices[(FaceIndex * 3) + Corner]);
+		}
+		if (VertexIDs[0] == VertexIDs[1] || VertexIDs[0] == VertexIDs[2] || VertexIDs[1] == VertexIDs[2])
+			continue;
+
+		//FVertexID FaceVertexIDs[3];
+		for (int32 Corner = 0; Corner < 3; Corner++)
+		{
+			uint32 SplitIndex = (FaceIndex * 3) + Corner;
+			uint32 SplitVertexIndex = SplitIndices[SplitIndex];
+			const FVertexInstanceID& VertexInstanceID = MeshDescription->CreateVertexInstance(FVertexID(SplitVertexIndex));
+
+			// The converted attributes already have their winding order fixed
+			const uint32 ConvertedIndex = SplitIndex;
+
+			// Fix the winding order by updating the SplitIndex (invert corner 1 and 2)
+			// instead of going 0 1 2 go 0 2 1
+			// TODO; this slows down StaticMesh->Build() considerably!
+			Corner == 1 ? SplitIndex++ : Corner == 2 ? SplitIndex-- : SplitIndex;
+
+			// Normals
+			if (bHasNormal)
+			{
+				VertexInstanceNormals[VertexInstanceID] = SplitNormalVectors[ConvertedIndex];
+			}
+
+			// Tangents and binormals
+			if (bHasTangents)
+			{
+				VertexInstanceTangents[VertexInstanceID] = SplitTangentUVectors[ConvertedIndex];
+
+				VertexInstanceBinormalSigns[VertexInstanceID] = GetBasisDeterminantSign(
+					SplitTangentUVectors[ConvertedIndex].GetSafeNormal(),
+					SplitTangentVVectors[ConvertedIndex].GetSafeNormal(),
+					VertexInstanceNormals[VertexInstanceID].GetSafeNormal());
+			}
+
+			// Color
+			FLinearColor Color = FLinearColor::White;
+			if (bHasRGB)
+			{
+				Color.R = FMath::Clamp(
+					SplitColors[SplitIndex * AttribInfoColors.tupleSize + 0], 0.0f, 1.0f);
+				Color.G = FMath::Clamp(
+					SplitColors[SplitIndex * AttribInfoColors.tupleSize + 1], 0.0f, 1.0f);
+				Color.B = FMath::Clamp(
+					SplitColors[SplitIndex * AttribInfoColors.tupleSize + 2], 0.0f, 1.0f);
+			}
+			// Alpha
+			if (bHasAlpha)
+			{
+				Color.A = FMath::Clamp(SplitAlphas[SplitIndex], 0.0f, 1.0f);
+			}
+			else if (bHasRGBA)
+			{
+				Color.A = FMath::Clamp(SplitColors[SplitIndex * AttribInfoColors.tupleSize + 3], 0.0f, 1.0f);
+			}
+			VertexInstanceColors[VertexInstanceID] = FVector4(Color);
+
+			// UVs
+			for (int32 UVIndex = 0; UVIndex < SplitUVSets.Num(); UVIndex++)
+			{
+				if (HasUVSets[UVIndex])
+				{
+					VertexInstanceUVs.Set(VertexInstanceID, UVIndex, SplitUVVectors[UVIndex][ConvertedIndex]);
+				}
+			}
+
+			FaceVertexInstanceIDs[Corner] = VertexInstanceID;
+		}
+
+		const FPolygonGroupID PolygonGroupID(SplitFaceMaterialIndices[FaceIndex]);
+
+		// Insert a triangle into the mesh
+		MeshDescription->CreateTriangle(PolygonGroupID, FaceVertexInstanceIDs);
+	}
+
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	//  FACE SMOOTHING
+	//---------------------------------------------------------------------------------------------------------------------
+
+	// Get the FaceSmoothing values for this split
+	TArray<int32> SplitFaceSmoothingMasks;
+	FHoudiniMeshTranslator::TransferPartAttributesToSplit<int32>(
+		SplitVertexList, AttribInfoFaceSmoothingMasks, PartFaceSmoothingMasks, SplitFaceSmoothingMasks);
+
+	// FaceSmoothing masks must be initialized even if we don't have a value from Houdini!
+	// TODO: Expose the default FaceSmoothing value
+	// 0 will make hard face
+	TArray<uint32> FaceSmoothingMasks;
+	FaceSmoothingMasks.Init(DefaultMeshSmoothing, SplitVertexCount / 3);
+
+	// Check that the number of face smoothing values we retrieved is correct
+	int32 WedgeFaceSmoothCount = SplitFaceSmoothingMasks.Num() / 3;
+	if (SplitFaceSmoothingMasks.Num() != 0 && !SplitFaceSmoothingMasks.IsValidIndex((WedgeFaceSmoothCount - 1) * 3 + 2))
+	{
+		// Ignore our face smoothing values
+		WedgeFaceSmoothCount = 0;
+		HOUDINI_LOG_WARNING(TEXT("Invalid face smoothing mask count detected - Skipping them."));
+	}
+
+	// Transfer the face smoothing masks to the raw mesh if we have any
+	for (int32 WedgeFaceSmoothIdx = 0; WedgeFaceSmoothIdx < WedgeFaceSmoothCount; WedgeFaceSmoothIdx += 3)
+	{
+		FaceSmoothingMasks[WedgeFaceSmoothIdx] = SplitFaceSmoothingMasks[WedgeFaceSmoothIdx * 3];
+	}
+
+	// TODO
+	// Check
+	FStaticMeshOperations::ConvertSmoothGroupToHardEdges(FaceSmoothingMasks, *MeshDescription);
+}
+
 bool
 FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 {
@@ -3961,10 +4303,10 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 		}
 
 		// Get the vertex indices for this group
-		TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
+		TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitId];
 
 		// Get valid count of vertex indices for this split.
-		const int32& SplitVertexCount = AllSplitVertexCounts[SplitGroupName];
+		const int32& SplitVertexCount = AllSplitVertexCounts[SplitId];
 
 		// Make sure we have a  valid vertex count for this split
 		if (SplitVertexCount % 3 != 0 || SplitVertexList.Num() % 3 != 0)
@@ -3982,8 +4324,8 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 		FHoudiniOutputObjectIdentifier OutputObjectIdentifier(
 			HGPO.ObjectId, HGPO.GeoId, HGPO.PartId, GetMeshIdentifierFromSplit(SplitGroupName, SplitType));
 		OutputObjectIdentifier.PartName = HGPO.PartName;
-		OutputObjectIdentifier.PrimitiveIndex = AllSplitFirstValidVertexIndex[SplitGroupName],
-			OutputObjectIdentifier.PointIndex = AllSplitFirstValidPrimIndex[SplitGroupName];
+		OutputObjectIdentifier.PrimitiveIndex = AllSplitFirstValidVertexIndex[SplitId],
+			OutputObjectIdentifier.PointIndex = AllSplitFirstValidPrimIndex[SplitId];
 
 		// Try to find existing properties for this identifier
 		FHoudiniOutputObject* FoundOutputObject = InputObjects.Find(OutputObjectIdentifier);
@@ -4021,6 +4363,8 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			FoundOutputObject = &OutputObjects.Add(OutputObjectIdentifier, NewOutputObject);
 		}
 		FoundOutputObject->bProxyIsCurrent = true;
+		// The geometry hash describes the static mesh, which isn't built from this cook's geometry
+		FoundOutputObject->GeometryHash = 0;
 
 		HOUDINI_LOG_MESSAGE(TEXT("CreateHoudiniStaticMesh() - PreBuildMesh in %f seconds."), FPlatformTime::Seconds() - tick);
 		tick = FPlatformTime::Seconds();
@@ -4264,26 +4608,18 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Vertex Positions"));
 
-				for (int32 VertexPositionIdx = 0; VertexPositionIdx < NumVertexPositions; ++VertexPositionIdx)
-				//ParallelFor(NumVertexPositions, [&](uint32 VertexPositionIdx)
+				// We need to swap Z and Y coordinate here, and convert from m to cm. 
+				TArray<FVector> SplitPositions;
+				if (FHoudiniMeshConversion::GatherPositions(PartPositions, NeededVertices, SplitPositions) > 0)
 				{
-					int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
-					if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
-					{
-						// Error retrieving positions.
-						HOUDINI_LOG_WARNING(
-							TEXT("Creating Dynamic Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
-							TEXT("- skipping."),
-							HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
-					}
+					// Error retrieving positions.
+					HOUDINI_LOG_WARNING(
+						TEXT("Creating Dynamic Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
+						TEXT("- skipping."),
+						HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
+				}
 
-					// We need to swap Z and Y coordinate here, and convert from m to cm. 
-					FoundStaticMesh->SetVertexPosition(VertexPositionIdx, FVector(
-						PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-						PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-						PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION
-					));
-				}//);
+				FoundStaticMesh->SetVertexPositions(0, MakeArrayView(SplitPositions.GetData(), FMath::Min(SplitPositions.Num(), NumVertexPositions)));
 			}
 
 			//--------------------------------------------------------------------------------------------------------------------- 
@@ -4294,108 +4630,116 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Triangle Indices & Per Vertex Instance Attribute Values"));
 
-				// Now add the triangles to the mesh
-				for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; ++TriangleIdx)
-				// ParallelFor(NumTriangles, [&](uint32 TriangleIdx)
+				// Convert normals, tangents and UVs to unreal's coordinate space and winding order
+				TArray<FVector> SplitNormalVectors;
+				TArray<FVector> SplitTangentUVectors;
+				TArray<FVector> SplitTangentVVectors;
+				if (NormalCount > 0)
 				{
+					FHoudiniMeshConversion::ConvertVectors(SplitNormals, SplitNormalVectors, true);
+					if (bReadTangents && !bGenerateTangents)
+					{
+						FHoudiniMeshConversion::ConvertVectors(SplitTangentU, SplitTangentUVectors, true);
+						FHoudiniMeshConversion::ConvertVectors(SplitTangentV, SplitTangentVVectors, true);
+					}
+				}
 
-					const int32 TriVertIdx0 = TriangleIdx * 3;
-					FoundStaticMesh->SetTriangleVertexIndices(TriangleIdx, FIntVector(
-						TriangleIndices[TriVertIdx0 + 0],
-						TriangleIndices[TriVertIdx0 + 1],
-						TriangleIndices[TriVertIdx0 + 2]
-					));
+				TArray<TArray<FVector2D>> SplitUVVectors;
+				SplitUVVectors.SetNum(NumUVLayers);
+				for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVLayers; ++TexCoordIdx)
+				{
+					FHoudiniMeshConversion::ConvertUVs(SplitUVSets[TexCoordIdx], SplitUVVectors[TexCoordIdx], true);
+				}
 
-					const int32 TriWindingIndex[3] = { 0, 2, 1 };
-					if (NormalCount > 0 && SplitNormals.IsValidIndex(TriVertIdx0 * 3 + 3 * 3 - 1))
+				// The vertex instance data computed here is set in parallel, by chunks of whole triangles
+				const int32 VertexInstanceChunkSize = 3 * 4096;
+				auto ForEachVertexInstanceChunk = [VertexInstanceChunkSize](int32 InFirst, int32 InEnd, TFunctionRef<void(int32, int32)> InFunction)
+				{
+					const int32 NumChunks = FMath::DivideAndRoundUp(FMath::Max(InEnd - InFirst, 0), VertexInstanceChunkSize);
+					ParallelFor(NumChunks, [&](int32 ChunkIdx)
 					{
-						// Flip Z and Y coordinate for normal, but don't scale
-						for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-						{
-							const FVector Normal(
-								SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 0],
-								SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 2],
-								SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 1]
-							);
+						const int32 ChunkFirst = InFirst + ChunkIdx * VertexInstanceChunkSize;
+						InFunction(ChunkFirst, FMath::Min(VertexInstanceChunkSize, InEnd - ChunkFirst));
+					});
+				};
 
-							FoundStaticMesh->SetTriangleVertexNormal(TriangleIdx, TriWindingIndex[ElementIdx], Normal);
+				// TriangleIndices holds the 3 vertex indices of each triangle consecutively
+				FoundStaticMesh->SetTriangleVertexIndices(0, MakeArrayView(reinterpret_cast<const FIntVector*>(TriangleIndices.GetData()), NumTriangles));
 
-							if (bReadTangents)
-							{
-								FVector TangentU, TangentV;
-								if (bGenerateTangents)
-								{
-									// Generate the tangents if needed
-									Normal.FindBestAxisVectors(TangentU, TangentV);
-								}
-								else
-								{
-									// Transfer the tangents from Houdini
-									TangentU.X = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-									TangentU.Y = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-									TangentU.Z = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
-
-									TangentU.X = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-									TangentU.Y = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-									TangentU.Z = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
-								}
-
-								FoundStaticMesh->SetTriangleVertexUTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentU);
-								FoundStaticMesh->SetTriangleVertexVTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentV);
-							}
-						}
+				// The converted normals, tangents and UVs are already ordered per vertex instance and can be set in bulk
+				const int32 NumVertexInstances = NumTriangles * 3;
+				const int32 NumNormalInstances = FMath::Min(SplitNormalVectors.Num() / 3 * 3, NumVertexInstances);
+				FoundStaticMesh->SetVertexInstanceNormals(0, MakeArrayView(SplitNormalVectors.GetData(), NumNormalInstances));
+
+				if (bReadTangents)
+				{
+					// Transfer the tangents from Houdini
+					int32 NumTangentInstances = 0;
+					if (!bGenerateTangents)
+					{
+						NumTangentInstances = FMath::Min3(NumNormalInstances, SplitTangentUVectors.Num() / 3 * 3, SplitTangentVVectors.Num() / 3 * 3);
+						FoundStaticMesh->SetVertexInstanceUTangents(0, MakeArrayView(SplitTangentUVectors.GetData(), NumTangentInstances));
+						FoundStaticMesh->SetVertexInstanceVTangents(0, MakeArrayView(SplitTangentVVectors.GetData(), NumTangentInstances));
 					}
 
-					if (bSplitColorValid && SplitColors.IsValidIndex(TriVertIdx0 * AttribInfoColors.tupleSize + 3 * AttribInfoColors.tupleSize - 1))
+					// Generate the missing tangents
+					ForEachVertexInstanceChunk(NumTangentInstances, NumNormalInstances, [&](int32 InFirst, int32 InNum)
+					{
+						TArray<FVector> TangentsU;
+						TArray<FVector> TangentsV;
+						TangentsU.SetNumUninitialized(InNum);
+						TangentsV.SetNumUninitialized(InNum);
+						for (int32 Idx = 0; Idx < InNum; ++Idx)
+							SplitNormalVectors[InFirst + Idx].FindBestAxisVectors(TangentsU[Idx], TangentsV[Idx]);
+
+						FoundStaticMesh->SetVertexInstanceUTangents(InFirst, TangentsU);
+						FoundStaticMesh->SetVertexInstanceVTangents(InFirst, TangentsV);
+					});
+				}
+
+				// Colors are converted to FColor, the winding order of each triangle is fixed as well
+				const int32 ColorTupleSize = AttribInfoColors.tupleSize;
+				const int32 NumColorInstances = bSplitColorValid ? FMath::Min(SplitColors.Num() / (3 * ColorTupleSize) * 3, NumVertexInstances) : 0;
+				ForEachVertexInstanceChunk(0, NumColorInstances, [&](int32 InFirst, int32 InNum)
+				{
+					const int32 TriWindingIndex[3] = { 0, 2, 1 };
+
+					TArray<FColor> VertexColors;
+					VertexColors.SetNumUninitialized(InNum);
+					for (int32 Idx = 0; Idx < InNum; ++Idx)
 					{
+						const int32 VertexInstanceIdx = InFirst + Idx;
+						const int32 ElementIdx = VertexInstanceIdx % 3;
+
 						FLinearColor VertexLinearColor;
-						for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
+						VertexLinearColor.R = FMath::Clamp(SplitColors[VertexInstanceIdx * ColorTupleSize + 0], 0.0f, 1.0f);
+						VertexLinearColor.G = FMath::Clamp(SplitColors[VertexInstanceIdx * ColorTupleSize + 1], 0.0f, 1.0f);
+						VertexLinearColor.B = FMath::Clamp(SplitColors[VertexInstanceIdx * ColorTupleSize + 2], 0.0f, 1.0f);
+
+						if (bSplitAlphaValid)
 						{
-							VertexLinearColor.R = FMath::Clamp(
-								SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 0], 0.0f, 1.0f);
-							VertexLinearColor.G = FMath::Clamp(
-								SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 1], 0.0f, 1.0f);
-							VertexLinearColor.B = FMath::Clamp(
-								SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 2], 0.0f, 1.0f);
-
-							if (bSplitAlphaValid)
-							{
-								VertexLinearColor.A = FMath::Clamp(SplitAlphas[TriVertIdx0 + ElementIdx], 0.0f, 1.0f);
-							}
-							else if (AttribInfoColors.tupleSize >= 4)
-							{
-								VertexLinearColor.A = FMath::Clamp(
-									SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 3], 0.0f, 1.0f);
-							}
-							else
-							{
-								VertexLinearColor.A = 1.0f;
-							}
-							const FColor VertexColor = VertexLinearColor.ToFColor(false);
-							FoundStaticMesh->SetTriangleVertexColor(TriangleIdx, TriWindingIndex[ElementIdx], VertexColor);
+							VertexLinearColor.A = FMath::Clamp(SplitAlphas[VertexInstanceIdx], 0.0f, 1.0f);
 						}
-					}
-
-					if (NumUVLayers > 0)
-					{
-						// Dynamic mesh supports only 1 UV layer on the mesh it self. So we set the first layer
-						// on the mesh itself only, and we set all layers on the AttributeSet
-						for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVLayers; ++TexCoordIdx)
+						else if (ColorTupleSize >= 4)
 						{
-							const TArray<float>& SplitUVs = SplitUVSets[TexCoordIdx];
-							if (SplitUVs.IsValidIndex(TriVertIdx0 * 2 + 3 * 2 - 1))
-							{
-								for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-								{
-									const int32 UVIdx = TriVertIdx0 * 2 + ElementIdx * 2;
-									// We need to flip V coordinate when it's coming from HAPI.
-									const FVector2D UV(SplitUVs[UVIdx + 0], 1.0f - SplitUVs[UVIdx + 1]);
-									// Set the UV on the vertex instance in the UVLayer
-									FoundStaticMesh->SetTriangleVertexUV(TriangleIdx, TriWindingIndex[ElementIdx], TexCoordIdx, UV);
-								}
-							}
+							VertexLinearColor.A = FMath::Clamp(SplitColors[VertexInstanceIdx * ColorTupleSize + 3], 0.0f, 1.0f);
 						}
+						else
+						{
+							VertexLinearColor.A = 1.0f;
+						}
+
+						VertexColors[Idx - ElementIdx + TriWindingIndex[ElementIdx]] = VertexLinearColor.ToFColor(false);
 					}
+
+					FoundStaticMesh->SetVertexInstanceColors(InFirst, VertexColors);
+				});
+
+				for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVLayers; ++TexCoordIdx)
+				{
+					const TArray<FVector2D>& SplitUVs = SplitUVVectors[TexCoordIdx];
+					const int32 NumUVInstances = FMath::Min(SplitUVs.Num() / 3 * 3, NumVertexInstances);
+					FoundStaticMesh->SetVertexInstanceUVs(TexCoordIdx, 0, MakeArrayView(SplitUVs.GetData(), NumUVInstances));
 				}
 			}
 		}
@@ -4405,7 +4749,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 		//---------------------------------------------------------------------------------------------------------------------
 
 		// Get face indices for this split.
-		TArray<int32>& SplitFaceIndices = AllSplitFaceIndices[SplitGroupName];
+		TArray<int32>& SplitFaceIndices = AllSplitFaceIndices[SplitId];
 
 		// Process material overrides first
 		if (PartFaceMaterialOverrides.Num() > 0)
@@ -4599,14 +4943,17 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 		//TArray<FHoudiniGenericAttribute> PropertyAttributes;
 		//if (GetGenericPropertiesAttributes(
 		//	HGPO.GeoId, HGPO.PartId,
-		//	AllSplitFirstValidVertexIndex[SplitGroupName],
-		//	AllSplitFirstValidPrimIndex[SplitGroupName],
+		//	AllSplitFirstValidVertexIndex[SplitId],
+		//	AllSplitFirstValidPrimIndex[SplitId],
 		//	PropertyAttributes))
 		//{
 		//	UpdateGenericPropertiesAttributes(
 		//		FoundStaticMesh, PropertyAttributes);
 		//}
 
+		// Convert the mesh to the compact layout if enabled
+		const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+		FoundStaticMesh->SetUseCompactStorage(HoudiniRuntimeSettings && HoudiniRuntimeSettings->bEnableProxyStaticMeshCompactStorage);
 		FoundStaticMesh->Optimize();
 
 		//// Try to find the outer package so we can dirty it up
@@ -4636,6 +4983,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 		{
 			FoundOutputObject->ProxyObject = FoundStaticMesh;
 			FoundOutputObject->bProxyIsCurrent = true;
+			FoundOutputObject->GeometryHash = 0;
 			OutputObjects.FindOrAdd(OutputObjectIdentifier, *FoundOutputObject);
 		}
 	}
@@ -4647,122 +4995,614 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 }
 
 bool
-FHoudiniMeshTranslator::CreateNeededMaterials()
+FHoudiniMeshTranslator::CreateNeededMaterials()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateNeededMaterials"));
+
+	UpdatePartNeededMaterials();
+
+	TArray<UPackage*> MaterialAndTexturePackages;
+	FHoudiniMaterialTranslator::CreateHoudiniMaterials(
+		HGPO.AssetId, PackageParams,
+		PartUniqueMaterialIds, PartUniqueMaterialInfos,
+		InputAssignmentMaterials, OutputAssignmentMaterials,
+		MaterialAndTexturePackages, false, bTreatExistingMaterialsAsUpToDate);
+
+	/*
+	// Save the created packages if needed
+	// DPT: deactivated, only dirty for now, as we'll save them when saving the world.
+	if (MaterialAndTexturePackages.Num() > 0)
+		FEditorFileUtils::PromptForCheckoutAndSave(MaterialAndTexturePackages, true, false);
+	*/
+
+	if (bMaterialOverrideNeedsCreateInstance && PartFaceMaterialOverrides.Num() > 0)
+	{
+		// Map containing unique face materials override attribute
+		// and their first valid prim index
+		// We create only one material instance per attribute
+		TMap<FString, int32> UniqueFaceMaterialOverrides;
+		for (int FaceIdx = 0; FaceIdx < PartFaceMaterialOverrides.Num(); FaceIdx++)
+		{
+			FString MatOverrideAttr = PartFaceMaterialOverrides[FaceIdx];
+			if (UniqueFaceMaterialOverrides.Contains(MatOverrideAttr))
+				continue;
+
+			// Add the material override and face index to the map
+			UniqueFaceMaterialOverrides.Add(MatOverrideAttr, FaceIdx);
+		}
+
+		FHoudiniMaterialTranslator::CreateMaterialInstances(
+			HGPO, PackageParams,
+			UniqueFaceMaterialOverrides, MaterialAndTexturePackages,
+			InputAssignmentMaterials, OutputAssignmentMaterials,
+			false);
+	}
+
+	return true;
+}
+
+FString
+FHoudiniMeshTranslator::GetMeshIdentifierFromSplit(const FString& InSplitName, const EHoudiniSplitType& InSplitType)
+{
+	FString MeshIdentifier = TEXT("");
+	switch (InSplitType)
+	{
+		case EHoudiniSplitType::Normal:
+		case EHoudiniSplitType::LOD:
+		case EHoudiniSplitType::InvisibleUCXCollider:
+		case EHoudiniSplitType::InvisibleSimpleCollider:
+			// LODs and Invisible simple colliders use the main mesh
+			MeshIdentifier = HAPI_UNREAL_GROUP_GEOMETRY_NOT_COLLISION;
+			break;
+
+		case EHoudiniSplitType::InvisibleComplexCollider:
+		case EHoudiniSplitType::RenderedComplexCollider:
+		case EHoudiniSplitType::RenderedUCXCollider:
+		case EHoudiniSplitType::RenderedSimpleCollider:
+			// Rendered colliders or invisible complex colliders have their own static mesh
+			MeshIdentifier = InSplitName;
+			break;
+
+		default:
+			break;
+	}
+
+	return MeshIdentifier;
+}
+
+UStaticMesh*
+FHoudiniMeshTranslator::FindExistingStaticMesh(const FHoudiniOutputObjectIdentifier& InIdentifier)
+{
+	// See if we already have an input object for that output identifier
+	FHoudiniOutputObject const * FoundOutputObjectPtr = InputObjects.Find(InIdentifier);
+	UStaticMesh* FoundStaticMesh = nullptr;
+	if (FoundOutputObjectPtr)
+	{
+		// Make sure it's a valid static mesh
+		FoundStaticMesh = Cast<UStaticMesh>(FoundOutputObjectPtr->OutputObject);
+		if (!FoundStaticMesh || FoundStaticMesh->IsPendingKill())
+			FoundStaticMesh = nullptr;
+	}
+
+	if (!FoundStaticMesh)
+	{
+		// No input object matching this identifier, see if we have created an output object that matches
+		FoundOutputObjectPtr = OutputObjects.Find(InIdentifier);
+		if (!FoundOutputObjectPtr)
+			return nullptr;
+
+		// Make sure it's a valid static mesh
+		FoundStaticMesh = Cast<UStaticMesh>(FoundOutputObjectPtr->OutputObject);
+		if (!FoundStaticMesh || FoundStaticMesh->IsPendingKill())
+			return nullptr;
+	}
+
+	if (FoundStaticMesh)
+	{
+		UObject* OuterMost = FoundStaticMesh->GetOutermostObject();
+		if (OuterMost->IsA<ULevel>())
+		{
+			// The Outermost for this static mesh is a level
+			// This is likely a SM created by V1, and we should not reuse it.
+			// This will force the plugin to recreate a "proper" SM in the temp folder.
+			FoundStaticMesh->MarkPendingKill();
+			FoundStaticMesh = nullptr;
+		}
+	}
+
+	return FoundStaticMesh;
+}
+
+bool
+FHoudiniMeshTranslator::IsStaticMeshShared(const UStaticMesh* InStaticMesh, const FHoudiniOutputObjectIdentifier& InIdentifier) const
+{
+	if (!InStaticMesh)
+		return false;
+
+	for (const auto& Pair : InputObjects)
+	{
+		if (Pair.Value.OutputObject == InStaticMesh && !(Pair.Key == InIdentifier))
+			return true;
+	}
+
+	for (const auto& Pair : OutputObjects)
+	{
+		if (Pair.Value.OutputObject == InStaticMesh && !(Pair.Key == InIdentifier))
+			return true;
+	}
+
+	if (IsSharingAcrossOutputs() && StaticMeshesSharedByOutputs.Contains(InStaticMesh))
+		return true;
+
+	return false;
+}
+
+// Chains the hash of an array's content with a previous hash
+template<typename TYPE>
+static uint64
+HashPartData(const TArray<TYPE>& InData, const uint64& InHash)
+{
+	// Hash the size as well, so that the same values split differently give different hashes
+	const int32 Num = InData.Num();
+	uint64 Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Num), sizeof(int32), InHash);
+	if (Num > 0)
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(InData.GetData()), Num * sizeof(TYPE), Hash);
+
+	return Hash;
+}
+
+static uint64
+HashPartData(const FString& InString, const uint64& InHash)
+{
+	return HashPartData(InString.GetCharArray(), InHash);
+}
+
+// Position relative to a pivot, quantized so that translated copies of the same geometry get the same values
+struct FHoudiniQuantizedPosition
+{
+	int64 X;
+	int64 Y;
+	int64 Z;
+};
+
+static FHoudiniQuantizedPosition
+QuantizeRelativePosition(const FVector& InPosition, const FVector& InPivot, const float& InTolerance)
+{
+	FHoudiniQuantizedPosition Quantized;
+	Quantized.X = (int64)FMath::RoundToDouble(((double)InPosition.X - (double)InPivot.X) / InTolerance);
+	Quantized.Y = (int64)FMath::RoundToDouble(((double)InPosition.Y - (double)InPivot.Y) / InTolerance);
+	Quantized.Z = (int64)FMath::RoundToDouble(((double)InPosition.Z - (double)InPivot.Z) / InTolerance);
+	return Quantized;
+}
+
+static uint64
+HashSocketData(const TArray<FHoudiniMeshSocket>& InSockets, const FVector& InPivot, const uint64& InHash)
+{
+	const int32 Num = InSockets.Num();
+	uint64 Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Num), sizeof(int32), InHash);
+	for (const FHoudiniMeshSocket& Socket : InSockets)
+	{
+		const FHoudiniQuantizedPosition Location = QuantizeRelativePosition(
+			Socket.Transform.GetLocation(), InPivot, HOUDINI_PART_GEOMETRY_HASH_TOLERANCE * HAPI_UNREAL_SCALE_FACTOR_POSITION);
+		const FQuat Rotation = Socket.Transform.GetRotation();
+		const FVector Scale = Socket.Transform.GetScale3D();
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Location), sizeof(FHoudiniQuantizedPosition), Hash);
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Rotation), sizeof(FQuat), Hash);
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Scale), sizeof(FVector), Hash);
+		Hash = HashPartData(Socket.Name, Hash);
+		Hash = HashPartData(Socket.Actor, Hash);
+		Hash = HashPartData(Socket.Tag, Hash);
+	}
+
+	return Hash;
+}
+
+static uint64
+HashPropertyAttributeData(const TArray<FHoudiniGenericAttribute>& InAttributes, const uint64& InHash)
+{
+	const int32 Num = InAttributes.Num();
+	uint64 Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Num), sizeof(int32), InHash);
+	for (const FHoudiniGenericAttribute& Attribute : InAttributes)
+	{
+		const int32 Header[4] = {
+			(int32)Attribute.AttributeType, (int32)Attribute.AttributeOwner,
+			Attribute.AttributeCount, Attribute.AttributeTupleSize };
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(Header), sizeof(Header), Hash);
+		Hash = HashPartData(Attribute.AttributeName, Hash);
+		Hash = HashPartData(Attribute.DoubleValues, Hash);
+		Hash = HashPartData(Attribute.IntValues, Hash);
+		for (const FString& StringValue : Attribute.StringValues)
+			Hash = HashPartData(StringValue, Hash);
+	}
+
+	return Hash;
+}
+
+uint64
+FHoudiniMeshTranslator::ComputePartGeometryHash(const bool& bRemoveUnusedUVSets)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::ComputePartGeometryHash"));
+
+	// No need to read the tangents if we want unreal to recompute them after
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const bool bReadTangents = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->RecomputeTangentsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always : true;
+
+	// Fetch all the data used to build the meshes,
+	// the material IDs and overrides have already been fetched by CreateNeededMaterials()
+	UpdatePartPositionIfNeeded();
+	UpdatePartNormalsIfNeeded();
+	if (bReadTangents)
+		UpdatePartTangentsIfNeeded();
+	UpdatePartColorsIfNeeded();
+	UpdatePartAlphasIfNeeded();
+	UpdatePartUVSetsIfNeeded(bRemoveUnusedUVSets);
+	UpdatePartFaceSmoothingIfNeeded();
+	UpdatePartLightmapResolutionsIfNeeded();
+	UpdatePartLODScreensizeIfNeeded();
+
+	uint64 Hash = HashPartData(PartVertexList, 0);
+	for (int32 SplitId = 0; SplitId < AllSplitGroups.Num(); SplitId++)
+	{
+		Hash = HashPartData(AllSplitGroups[SplitId], Hash);
+		Hash = HashPartData(AllSplitVertexLists[SplitId], Hash);
+	}
+
+	// The static meshes of instanced parts can't be offset, hash their positions as they are.
+	// Other parts are hashed relative to their first point, so that they can share their meshes with their translated copies.
+	const bool bIsInstanced = HGPO.bIsInstanced || HGPO.PartInfo.bIsInstanced;
+	Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&bIsInstanced), sizeof(bool), Hash);
+	PartGeometryPivot = FVector::ZeroVector;
+	if (bIsInstanced || PartPositions.Num() < 3)
+	{
+		Hash = HashPartData(PartPositions, Hash);
+	}
+	else
+	{
+		const FVector HoudiniPivot(PartPositions[0], PartPositions[1], PartPositions[2]);
+		PartGeometryPivot = FVector(HoudiniPivot.X, HoudiniPivot.Z, HoudiniPivot.Y) * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+
+		const int32 NumPoints = PartPositions.Num() / 3;
+		TArray<FHoudiniQuantizedPosition> RelativePositions;
+		RelativePositions.SetNumUninitialized(NumPoints);
+		for (int32 PointIdx = 0; PointIdx < NumPoints; PointIdx++)
+		{
+			const FVector Position(PartPositions[PointIdx * 3 + 0], PartPositions[PointIdx * 3 + 1], PartPositions[PointIdx * 3 + 2]);
+			RelativePositions[PointIdx] = QuantizeRelativePosition(Position, HoudiniPivot, HOUDINI_PART_GEOMETRY_HASH_TOLERANCE);
+		}
+		Hash = HashPartData(RelativePositions, Hash);
+	}
+
+	Hash = HashPartData(PartNormals, Hash);
+	Hash = HashPartData(PartTangentU, Hash);
+	Hash = HashPartData(PartTangentV, Hash);
+	Hash = HashPartData(PartColors, Hash);
+	Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&AttribInfoColors.tupleSize), sizeof(int32), Hash);
+	Hash = HashPartData(PartAlphas, Hash);
+	for (const TArray<float>& UVSet : PartUVSets)
+		Hash = HashPartData(UVSet, Hash);
+	Hash = HashPartData(PartFaceSmoothingMasks, Hash);
+	Hash = HashPartData(PartLightMapResolutions, Hash);
+	Hash = HashPartData(PartLODScreensize, Hash);
+
+	Hash = HashPartData(PartFaceMaterialIds, Hash);
+	for (const FString& MaterialOverride : PartFaceMaterialOverrides)
+		Hash = HashPartData(MaterialOverride, Hash);
+
+	// Sockets are added to the static meshes
+	TArray<FHoudiniMeshSocket> AllSockets;
+	FHoudiniEngineUtils::AddMeshSocketsToArray_DetailAttribute(HGPO.GeoId, HGPO.PartId, AllSockets, HGPO.PartInfo.bIsInstanced);
+	FHoudiniEngineUtils::AddMeshSocketsToArray_Group(HGPO.GeoId, HGPO.PartId, AllSockets, HGPO.PartInfo.bIsInstanced);
+	Hash = HashSocketData(AllSockets, PartGeometryPivot, Hash);
+
+	// So are the generic uproperty attributes of each split
+	for (int32 SplitId = 0; SplitId < AllSplitGroups.Num(); SplitId++)
+	{
+		TArray<FHoudiniGenericAttribute> PropertyAttributes;
+		GetGenericPropertiesAttributes(
+			HGPO.GeoId, HGPO.PartId,
+			AllSplitFirstValidVertexIndex[SplitId],
+			AllSplitFirstValidPrimIndex[SplitId],
+			PropertyAttributes);
+
+		Hash = HashPropertyAttributeData(PropertyAttributes, Hash);
+	}
+
+	// 0 is used for output objects without a hash
+	return Hash != 0 ? Hash : 1;
+}
+
+void
+FHoudiniMeshTranslator::GetPartOutputIdentifiers(TMap<FString, FHoudiniOutputObjectIdentifier>& OutIdentifiers)
+{
+	for (int32 SplitId = 0; SplitId < AllSplitGroups.Num(); SplitId++)
+	{
+		const FString& SplitGroupName = AllSplitGroups[SplitId];
+		EHoudiniSplitType SplitType = GetSplitTypeFromSplitName(SplitGroupName);
+		if (SplitType == EHoudiniSplitType::Invalid)
+			continue;
+
+		FHoudiniOutputObjectIdentifier OutputObjectIdentifier(
+			HGPO.ObjectId, HGPO.GeoId, HGPO.PartId, GetMeshIdentifierFromSplit(SplitGroupName, SplitType));
+		OutputObjectIdentifier.PartName = HGPO.PartName;
+		OutputObjectIdentifier.PrimitiveIndex = AllSplitFirstValidVertexIndex[SplitId];
+		OutputObjectIdentifier.PointIndex = AllSplitFirstValidPrimIndex[SplitId];
+		OutIdentifiers.FindOrAdd(OutputObjectIdentifier.SplitIdentifier, OutputObjectIdentifier);
+	}
+}
+
+bool
+FHoudiniMeshTranslator::GetSharedMeshOffset(const FVector& InGeometryPivot, const FVector& InMeshOffset, FVector& OutMeshOffset) const
+{
+	// The mesh was built for a part whose pivot was at InGeometryPivot - InMeshOffset
+	OutMeshOffset = InMeshOffset + (PartGeometryPivot - InGeometryPivot);
+
+	// Instanced meshes are used by the instancers, their components can't be offset
+	if ((HGPO.bIsInstanced || HGPO.PartInfo.bIsInstanced) && !OutMeshOffset.IsNearlyZero())
+		return false;
+
+	return true;
+}
+
+bool
+FHoudiniMeshTranslator::IsSharingAcrossOutputs() const
+{
+	return StaticMeshSharingScopeCount > 0 && IsInGameThread() && PackageParams.ComponentGUID == SharingComponentGUID;
+}
+
+void
+FHoudiniMeshTranslator::RegisterSharedStaticMesh(const FString& InSplitIdentifier, const FHoudiniOutputObject& InOutputObject) const
+{
+	if (!IsSharingAcrossOutputs() || InOutputObject.GeometryHash == 0 || InOutputObject.bProxyIsCurrent)
+		return;
+
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(InOutputObject.OutputObject);
+	if (!StaticMesh || StaticMesh->IsPendingKill())
+		return;
+
+	// Keep the first mesh registered for a split, identical parts all use it
+	TMap<FString, FSharedSplitMesh>& SplitMeshes = SharedSplitMeshes.FindOrAdd(InOutputObject.GeometryHash);
+	if (SplitMeshes.Contains(InSplitIdentifier))
+		return;
+
+	FSharedSplitMesh& SharedSplitMesh = SplitMeshes.Add(InSplitIdentifier);
+	SharedSplitMesh.StaticMesh = StaticMesh;
+	SharedSplitMesh.GeometryPivot = InOutputObject.GeometryPivot;
+	SharedSplitMesh.MeshOffset = InOutputObject.MeshOffset;
+
+	StaticMeshesSharedByOutputs.Add(StaticMesh);
+}
+
+bool
+FHoudiniMeshTranslator::ReuseUnchangedStaticMeshes()
+{
+	if (ForceRebuild || PartGeometryHash == 0)
+		return false;
+
+	TMap<FString, FHoudiniOutputObjectIdentifier> PartIdentifiers;
+	GetPartOutputIdentifiers(PartIdentifiers);
+	if (PartIdentifiers.Num() <= 0)
+		return false;
+
+	// All of this part's previous output objects must match the current splits and geometry
+	TMap<FString, const FHoudiniOutputObject*> PreviousOutputObjects;
+	for (const auto& Pair : InputObjects)
+	{
+		const FHoudiniOutputObjectIdentifier& Identifier = Pair.Key;
+		if (Identifier.ObjectId != HGPO.ObjectId || Identifier.GeoId != HGPO.GeoId || Identifier.PartId != HGPO.PartId)
+			continue;
+
+		if (Pair.Value.GeometryHash != PartGeometryHash)
+			return false;
+
+		// The static mesh needs to be built if the proxy was used instead
+		if (Pair.Value.bProxyIsCurrent)
+			return false;
+
+		if (!PartIdentifiers.Contains(Identifier.SplitIdentifier))
+			return false;
+
+		UStaticMesh* StaticMesh = Cast<UStaticMesh>(Pair.Value.OutputObject);
+		if (!StaticMesh || StaticMesh->IsPendingKill())
+			return false;
+
+		FVector MeshOffset;
+		if (!GetSharedMeshOffset(Pair.Value.GeometryPivot, Pair.Value.MeshOffset, MeshOffset))
+			return false;
+
+		PreviousOutputObjects.Add(Identifier.SplitIdentifier, &Pair.Value);
+	}
+
+	if (PreviousOutputObjects.Num() != PartIdentifiers.Num())
+		return false;
+
+	for (const auto& IdentifierPair : PartIdentifiers)
+	{
+		const FHoudiniOutputObjectIdentifier& OutputObjectIdentifier = IdentifierPair.Value;
+		FHoudiniOutputObject NewOutputObject = *PreviousOutputObjects.FindChecked(IdentifierPair.Key);
+
+		// Only the cached attributes and the offset (if the part was moved) need to be updated,
+		// the proxy (if any) will be removed with the other outputs' ones
+		NewOutputObject.CachedAttributes.Empty();
+		NewOutputObject.CachedTokens.Empty();
+		NewOutputObject.bProxyIsCurrent = false;
+		GetSharedMeshOffset(NewOutputObject.GeometryPivot, NewOutputObject.MeshOffset, NewOutputObject.MeshOffset);
+		NewOutputObject.GeometryPivot = PartGeometryPivot;
+		CacheOutputObjectAttributes(NewOutputObject);
+
+		OutputObjects.Add(OutputObjectIdentifier, NewOutputObject);
+		RegisterSharedStaticMesh(IdentifierPair.Key, NewOutputObject);
+	}
+
+	if (OutputStats)
+		OutputStats->NotifyObjectsSkipped(EHoudiniOutputType::Mesh, PartIdentifiers.Num());
+
+	return true;
+}
+
+bool
+FHoudiniMeshTranslator::ShareStaticMeshesFromIdenticalPart()
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateNeededMaterials"));
+	if (PartGeometryHash == 0)
+		return false;
 
-	UpdatePartNeededMaterials();
+	TMap<FString, FHoudiniOutputObjectIdentifier> PartIdentifiers;
+	GetPartOutputIdentifiers(PartIdentifiers);
+	if (PartIdentifiers.Num() <= 0)
+		return false;
 
-	TArray<UPackage*> MaterialAndTexturePackages;
-	FHoudiniMaterialTranslator::CreateHoudiniMaterials(
-		HGPO.AssetId, PackageParams,
-		PartUniqueMaterialIds, PartUniqueMaterialInfos,
-		InputAssignmentMaterials, OutputAssignmentMaterials,
-		MaterialAndTexturePackages, false, bTreatExistingMaterialsAsUpToDate);
+	// Returns true if a part's static meshes can be used for all of our splits
+	auto CanShareSplitMeshes = [&](const TMap<FString, FSharedSplitMesh>& InSplitMeshes)
+	{
+		if (InSplitMeshes.Num() != PartIdentifiers.Num())
+			return false;
 
-	/*
-	// Save the created packages if needed
-	// DPT: deactivated, only dirty for now, as we'll save them when saving the world.
-	if (MaterialAndTexturePackages.Num() > 0)
-		FEditorFileUtils::PromptForCheckoutAndSave(MaterialAndTexturePackages, true, false);
-	*/
+		for (const auto& SplitPair : InSplitMeshes)
+		{
+			UStaticMesh* StaticMesh = SplitPair.Value.StaticMesh.Get();
+			if (!StaticMesh || StaticMesh->IsPendingKill() || !PartIdentifiers.Contains(SplitPair.Key))
+				return false;
 
-	if (bMaterialOverrideNeedsCreateInstance && PartFaceMaterialOverrides.Num() > 0)
+			FVector MeshOffset;
+			if (!GetSharedMeshOffset(SplitPair.Value.GeometryPivot, SplitPair.Value.MeshOffset, MeshOffset))
+				return false;
+		}
+
+		return true;
+	};
+
+	// Use the static meshes generated by the other outputs of the component during this cook first
+	const TMap<FString, FSharedSplitMesh>* SharedStaticMeshes = nullptr;
+	if (IsSharingAcrossOutputs())
 	{
-		// Map containing unique face materials override attribute
-		// and their first valid prim index
-		// We create only one material instance per attribute
-		TMap<FString, int32> UniqueFaceMaterialOverrides;
-		for (int FaceIdx = 0; FaceIdx < PartFaceMaterialOverrides.Num(); FaceIdx++)
+		const TMap<FString, FSharedSplitMesh>* FoundSplitMeshes = SharedSplitMeshes.Find(PartGeometryHash);
+		if (FoundSplitMeshes && CanShareSplitMeshes(*FoundSplitMeshes))
+			SharedStaticMeshes = FoundSplitMeshes;
+	}
+
+	// Then look for the static meshes generated by other parts of this output with the same hash.
+	// Meshes created during this cook come first, the ones from the previous cook can only be used
+	// if they haven't been updated by this cook, and if we're not forcing the meshes to be rebuilt.
+	TMap<TTuple<int32, int32, int32>, TMap<FString, FSharedSplitMesh>> IdenticalParts;
+	auto AddIdenticalParts = [&](const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InObjects, const bool& bInPreviousCook)
+	{
+		for (const auto& Pair : InObjects)
 		{
-			FString MatOverrideAttr = PartFaceMaterialOverrides[FaceIdx];
-			if (UniqueFaceMaterialOverrides.Contains(MatOverrideAttr))
+			const FHoudiniOutputObjectIdentifier& Identifier = Pair.Key;
+			if (Pair.Value.GeometryHash != PartGeometryHash || Pair.Value.bProxyIsCurrent)
 				continue;
 
-			// Add the material override and face index to the map
-			UniqueFaceMaterialOverrides.Add(MatOverrideAttr, FaceIdx);
+			if (Identifier.ObjectId == HGPO.ObjectId && Identifier.GeoId == HGPO.GeoId && Identifier.PartId == HGPO.PartId)
+				continue;
+
+			if (bInPreviousCook && OutputObjects.Contains(Identifier))
+				continue;
+
+			FSharedSplitMesh SharedSplitMesh;
+			SharedSplitMesh.StaticMesh = Cast<UStaticMesh>(Pair.Value.OutputObject);
+			SharedSplitMesh.GeometryPivot = Pair.Value.GeometryPivot;
+			SharedSplitMesh.MeshOffset = Pair.Value.MeshOffset;
+			IdenticalParts.FindOrAdd(MakeTuple(Identifier.ObjectId, Identifier.GeoId, Identifier.PartId)).Add(Identifier.SplitIdentifier, SharedSplitMesh);
 		}
+	};
 
-		FHoudiniMaterialTranslator::CreateMaterialInstances(
-			HGPO, PackageParams,
-			UniqueFaceMaterialOverrides, MaterialAndTexturePackages,
-			InputAssignmentMaterials, OutputAssignmentMaterials,
-			false);
+	if (!SharedStaticMeshes)
+	{
+		AddIdenticalParts(OutputObjects, false);
+		if (!ForceRebuild)
+			AddIdenticalParts(InputObjects, true);
+
+		for (const auto& IdenticalPart : IdenticalParts)
+		{
+			if (CanShareSplitMeshes(IdenticalPart.Value))
+			{
+				SharedStaticMeshes = &IdenticalPart.Value;
+				break;
+			}
+		}
 	}
 
-	return true;
-}
+	if (!SharedStaticMeshes)
+		return false;
 
-FString
-FHoudiniMeshTranslator::GetMeshIdentifierFromSplit(const FString& InSplitName, const EHoudiniSplitType& InSplitType)
-{
-	FString MeshIdentifier = TEXT("");
-	switch (InSplitType)
+	for (const auto& SplitPair : *SharedStaticMeshes)
 	{
-		case EHoudiniSplitType::Normal:
-		case EHoudiniSplitType::LOD:
-		case EHoudiniSplitType::InvisibleUCXCollider:
-		case EHoudiniSplitType::InvisibleSimpleCollider:
-			// LODs and Invisible simple colliders use the main mesh
-			MeshIdentifier = HAPI_UNREAL_GROUP_GEOMETRY_NOT_COLLISION;
-			break;
-
-		case EHoudiniSplitType::InvisibleComplexCollider:
-		case EHoudiniSplitType::RenderedComplexCollider:
-		case EHoudiniSplitType::RenderedUCXCollider:
-		case EHoudiniSplitType::RenderedSimpleCollider:
-			// Rendered colliders or invisible complex colliders have their own static mesh
-			MeshIdentifier = InSplitName;
-			break;
+		const FHoudiniOutputObjectIdentifier& OutputObjectIdentifier = PartIdentifiers.FindChecked(SplitPair.Key);
 
-		default:
-			break;
+		// Keep the existing properties (components) for this identifier, but not the cached values of the previous cook
+		FHoudiniOutputObject* FoundOutputObject = InputObjects.Find(OutputObjectIdentifier);
+		FHoudiniOutputObject NewOutputObject = FoundOutputObject ? *FoundOutputObject : FHoudiniOutputObject();
+		NewOutputObject.CachedAttributes.Empty();
+		NewOutputObject.CachedTokens.Empty();
+		NewOutputObject.OutputObject = SplitPair.Value.StaticMesh.Get();
+		NewOutputObject.GeometryHash = PartGeometryHash;
+		NewOutputObject.GeometryPivot = PartGeometryPivot;
+		GetSharedMeshOffset(SplitPair.Value.GeometryPivot, SplitPair.Value.MeshOffset, NewOutputObject.MeshOffset);
+		NewOutputObject.bProxyIsCurrent = false;
+		CacheOutputObjectAttributes(NewOutputObject);
+
+		OutputObjects.Add(OutputObjectIdentifier, NewOutputObject);
+		RegisterSharedStaticMesh(SplitPair.Key, NewOutputObject);
 	}
 
-	return MeshIdentifier;
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] has the same geometry as another part, sharing its %d static mesh(es)."),
+		HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SharedStaticMeshes->Num());
+
+	return true;
 }
 
-UStaticMesh*
-FHoudiniMeshTranslator::FindExistingStaticMesh(const FHoudiniOutputObjectIdentifier& InIdentifier)
+void
+FHoudiniMeshTranslator::CacheOutputObjectAttributes(FHoudiniOutputObject& InOutputObject) const
 {
-	// See if we already have an input object for that output identifier
-	FHoudiniOutputObject const * FoundOutputObjectPtr = InputObjects.Find(InIdentifier);
-	UStaticMesh* FoundStaticMesh = nullptr;
-	if (FoundOutputObjectPtr)
+	TArray<FString> LevelPaths;
+	if (FHoudiniEngineUtils::GetLevelPathAttribute(HGPO.GeoId, HGPO.PartId, LevelPaths))
 	{
-		// Make sure it's a valid static mesh
-		FoundStaticMesh = Cast<UStaticMesh>(FoundOutputObjectPtr->OutputObject);
-		if (!FoundStaticMesh || FoundStaticMesh->IsPendingKill())
-			FoundStaticMesh = nullptr;
+		if (LevelPaths.Num() > 0 && !LevelPaths[0].IsEmpty())
+		{
+			// cache the level path attribute on the output object
+			InOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_LEVEL_PATH, LevelPaths[0]);
+		}
 	}
 
-	if (!FoundStaticMesh)
+	TArray<FString> OutputNames;
+	if (FHoudiniEngineUtils::GetOutputNameAttribute(HGPO.GeoId, HGPO.PartId, OutputNames))
 	{
-		// No input object matching this identifier, see if we have created an output object that matches
-		FoundOutputObjectPtr = OutputObjects.Find(InIdentifier);
-		if (!FoundOutputObjectPtr)
-			return nullptr;
+		if (OutputNames.Num() > 0 && !OutputNames[0].IsEmpty())
+		{
+			// cache the output name attribute on the output object
+			InOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_CUSTOM_OUTPUT_NAME_V2, OutputNames[0]);
+		}
+	}
 
-		// Make sure it's a valid static mesh
-		FoundStaticMesh = Cast<UStaticMesh>(FoundOutputObjectPtr->OutputObject);
-		if (!FoundStaticMesh || FoundStaticMesh->IsPendingKill())
-			return nullptr;
+	TArray<int32> TileValues;
+	if (FHoudiniEngineUtils::GetTileAttribute(HGPO.GeoId, HGPO.PartId, TileValues))
+	{
+		if (TileValues.Num() > 0 && TileValues[0] >= 0)
+		{
+			// cache the tile attribute as a token on the output object
+			InOutputObject.CachedTokens.Add(TEXT("tile"), FString::FromInt(TileValues[0]));
+		}
 	}
 
-	if (FoundStaticMesh)
+	TArray<FString> BakeOutputActorNames;
+	if (FHoudiniEngineUtils::GetBakeActorAttribute(HGPO.GeoId, HGPO.PartId, BakeOutputActorNames))
 	{
-		UObject* OuterMost = FoundStaticMesh->GetOutermostObject();
-		if (OuterMost->IsA<ULevel>())
+		if (BakeOutputActorNames.Num() > 0 && !BakeOutputActorNames[0].IsEmpty())
 		{
-			// The Outermost for this static mesh is a level
-			// This is likely a SM created by V1, and we should not reuse it.
-			// This will force the plugin to recreate a "proper" SM in the temp folder.
-			FoundStaticMesh->MarkPendingKill();
-			FoundStaticMesh = nullptr;
+			// cache the bake actor attribute on the output object
+			InOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_ACTOR, BakeOutputActorNames[0]);
 		}
 	}
 
-	return FoundStaticMesh;
+	TArray<FString> BakeOutlinerFolders;
+	if (FHoudiniEngineUtils::GetBakeOutlinerFolderAttribute(HGPO.GeoId, HGPO.PartId, BakeOutlinerFolders))
+	{
+		if (BakeOutlinerFolders.Num() > 0 && !BakeOutlinerFolders[0].IsEmpty())
+		{
+			// cache the bake actor attribute on the output object
+			InOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_OUTLINER_FOLDER, BakeOutlinerFolders[0]);
+		}
+	}
 }
 
 UHoudiniStaticMesh*
@@ -4856,21 +5696,16 @@ FHoudiniMeshTranslator::GetSplitTypeFromSplitName(const FString& InSplitName)
 }
 
 bool
-FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions)
+FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const int32 SplitId, FKAggregateGeom& AggCollisions)
 {
+	const FString& SplitGroupName = AllSplitGroups[SplitId];
+
 	// Get the vertex indices for the split group
-	TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
+	TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitId];
 
 	// We're only interested in unique vertices
 	TArray<int32> UniqueVertexIndexes;
-	for (int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx++)
-	{
-		int32 Index = SplitGroupVertexList[VertexIdx];
-		if (!PartPositions.IsValidIndex(Index))
-			continue;
-
-		UniqueVertexIndexes.AddUnique(Index);
-	}
+	GetUniqueSplitVertexIndices(SplitGroupVertexList, UniqueVertexIndexes);
 
 	// Extract the collision geo's vertices
 	TArray< FVector > VertexArray;
@@ -4957,23 +5792,79 @@ FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupN
 	return true;
 }
 
-bool
-FHoudiniMeshTranslator::AddSimpleCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions)
+void
+FHoudiniMeshTranslator::GetUniqueSplitVertexIndices(const TArray<int32>& InSplitVertexList, TArray<int32>& OutUniqueVertexIndices) const
 {
-	// Get the vertex indices for the split group
-	TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
-
-	// We're only interested in unique vertices
-	TArray<int32> UniqueVertexIndexes;
-	for (int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx++)
+	// Keep the order of first use, like AddUnique would, without its quadratic cost
+	TSet<int32> FoundIndices;
+	FoundIndices.Reserve(InSplitVertexList.Num());
+	OutUniqueVertexIndices.Reset();
+	for (int32 VertexIdx = 0; VertexIdx < InSplitVertexList.Num(); VertexIdx++)
 	{
-		int32 Index = SplitGroupVertexList[VertexIdx];
+		int32 Index = InSplitVertexList[VertexIdx];
 		if (!PartPositions.IsValidIndex(Index))
 			continue;
 
-		UniqueVertexIndexes.AddUnique(Index);
+		bool bAlreadyFound = false;
+		FoundIndices.Add(Index, &bAlreadyFound);
+		if (!bAlreadyFound)
+			OutUniqueVertexIndices.Add(Index);
+	}
+}
+
+void
+FHoudiniMeshTranslator::GenerateAllSimpleCollisions(TArray<FKAggregateGeom>& OutSimpleCollisions)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::GenerateAllSimpleCollisions"));
+
+	OutSimpleCollisions.Empty();
+	TArray<int32> SimpleColliderSplits;
+	for (int32 SplitId = 0; SplitId < AllSplitGroups.Num(); SplitId++)
+	{
+		const EHoudiniSplitType SplitType = GetSplitTypeFromSplitName(AllSplitGroups[SplitId]);
+		if (SplitType == EHoudiniSplitType::InvisibleSimpleCollider || SplitType == EHoudiniSplitType::RenderedSimpleCollider)
+			SimpleColliderSplits.Add(SplitId);
 	}
 
+	if (SimpleColliderSplits.Num() <= 0)
+		return;
+
+	// Get the part position if needed
+	UpdatePartPositionIfNeeded();
+
+	// The colliders are generated from the positions only, without creating any UObject,
+	// so each split can be processed on its own thread and write to its own slot
+	OutSimpleCollisions.SetNum(AllSplitGroups.Num());
+	ParallelFor(SimpleColliderSplits.Num(), [&](int32 Index)
+	{
+		const int32 SplitId = SimpleColliderSplits[Index];
+		AddSimpleCollisionToAggregate(SplitId, OutSimpleCollisions[SplitId]);
+	});
+}
+
+void
+FHoudiniMeshTranslator::AppendAggregateCollisions(const FKAggregateGeom& InCollisions, FKAggregateGeom& OutAggregateCollisions)
+{
+	OutAggregateCollisions.SphereElems.Append(InCollisions.SphereElems);
+	OutAggregateCollisions.BoxElems.Append(InCollisions.BoxElems);
+	OutAggregateCollisions.SphylElems.Append(InCollisions.SphylElems);
+	OutAggregateCollisions.ConvexElems.Append(InCollisions.ConvexElems);
+	OutAggregateCollisions.TaperedCapsuleElems.Append(InCollisions.TaperedCapsuleElems);
+}
+
+bool
+FHoudiniMeshTranslator::AddSimpleCollisionToAggregate(const int32 SplitId, FKAggregateGeom& AggCollisions)
+{
+	const FString& SplitGroupName = AllSplitGroups[SplitId];
+
+
+	// Get the vertex indices for the split group
+	TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitId];
+
+	// We're only interested in unique vertices
+	TArray<int32> UniqueVertexIndexes;
+	GetUniqueSplitVertexIndices(SplitGroupVertexList, UniqueVertexIndexes);
+
 	// Extract the collision geo's vertices
 	TArray< FVector > VertexArray;
 	VertexArray.SetNum(UniqueVertexIndexes.Num());
@@ -5319,8 +6210,11 @@ int32 FHoudiniMeshTranslator::TransferPartAttributesToSplit(
 }
 
 float
-FHoudiniMeshTranslator::GetLODSCreensizeForSplit(const FString& SplitGroupName)
+FHoudiniMeshTranslator::GetLODSCreensizeForSplit(const int32 SplitId)
 {
+	const FString& SplitGroupName = AllSplitGroups[SplitId];
+
+
 	// LOD Screensize
 	// default values has already been set, see if we have any attribute override for this
 	float screensize = -1.0f;
@@ -5332,7 +6226,7 @@ FHoudiniMeshTranslator::GetLODSCreensizeForSplit(const FString& SplitGroupName)
 	if (PartLODScreensize.Num() > 0)
 	{
 		// use the "lod_screensize" primitive attribute
-		int32 FirstValidPrimIndex = AllSplitFirstValidPrimIndex[SplitGroupName];
+		int32 FirstValidPrimIndex = AllSplitFirstValidPrimIndex[SplitId];
 		if (PartLODScreensize.IsValidIndex(FirstValidPrimIndex))
 			screensize = PartLODScreensize[FirstValidPrimIndex];
 	}
@@ -5376,7 +6270,7 @@ FHoudiniMeshTranslator::GetLODSCreensizeForSplit(const FString& SplitGroupName)
 			}
 			else if (AttribInfoScreenSize.owner == HAPI_ATTROWNER_PRIM)
 			{
-				int32 FirstValidPrimIndex = AllSplitFirstValidPrimIndex[SplitGroupName];
+				int32 FirstValidPrimIndex = AllSplitFirstValidPrimIndex[SplitId];
 				if (LODScreenSizes.IsValidIndex(FirstValidPrimIndex))
 					screensize = LODScreenSizes[FirstValidPrimIndex];
 			}
@@ -5732,6 +6626,9 @@ FHoudiniMeshTranslator::GenerateKDopAsSimpleCollision(const TArray<FVector>& InP
 {
 	//
 	// Code simplified and adapted to work with a simple vector array from GeomFitUtils.cpp
+	// The faces of the kdop are clipped directly against each other and their vertices are used for a convex element,
+	// instead of going through a temporary UModel, a BSP build and a temporary UBodySetup.
+	// No UObject is created, so this can be called from any thread.
 	//
 
 	const float my_flt_max = 3.402823466e+38F;
@@ -5740,15 +6637,7 @@ FHoudiniMeshTranslator::GenerateKDopAsSimpleCollision(const TArray<FVector>& InP
 	int32 kCount = Dirs.Num();
 
 	TArray<float> maxDist;
-	maxDist.Init(-my_flt_max, kCount);	
-	/*
-	for (int32 i = 0; i < kCount; i++)
-		maxDist.Add(my_flt_max);
-	*/
-
-	// Construct temporary UModel for kdop creation. We keep no refs to it, so it can be GC'd.
-	auto TempModel = NewObject<UModel>();
-	TempModel->Initialize(nullptr, 1);
+	maxDist.Init(-my_flt_max, kCount);
 
 	// For each vertex, project along each kdop direction, to find the max in that direction.
 	for (int32 i = 0; i < InPositionArray.Num(); i++)
@@ -5772,79 +6661,237 @@ FHoudiniMeshTranslator::GenerateKDopAsSimpleCollision(const TArray<FVector>& InP
 	for (int32 i = 0; i < kCount; i++)
 		planes.Add(FPlane(Dirs[i], maxDist[i]));
 
+	int32 NumFaces = 0;
+	TArray<FVector> HullVertices;
 	for (int32 i = 0; i < planes.Num(); i++)
 	{
-		FPoly*	Polygon = new(TempModel->Polys->Element) FPoly();
+		FPoly Polygon;
 		FVector Base, AxisX, AxisY;
 
-		Polygon->Init();
-		Polygon->Normal = planes[i];
-		Polygon->Normal.FindBestAxisVectors(AxisX, AxisY);
+		Polygon.Init();
+		Polygon.Normal = planes[i];
+		Polygon.Normal.FindBestAxisVectors(AxisX, AxisY);
 
 		Base = planes[i] * planes[i].W;
 
-		new(Polygon->Vertices) FVector(Base + AxisX * HALF_WORLD_MAX + AxisY * HALF_WORLD_MAX);
-		new(Polygon->Vertices) FVector(Base + AxisX * HALF_WORLD_MAX - AxisY * HALF_WORLD_MAX);
-		new(Polygon->Vertices) FVector(Base - AxisX * HALF_WORLD_MAX - AxisY * HALF_WORLD_MAX);
-		new(Polygon->Vertices) FVector(Base - AxisX * HALF_WORLD_MAX + AxisY * HALF_WORLD_MAX);
+		Polygon.Vertices.Add(Base + AxisX * HALF_WORLD_MAX + AxisY * HALF_WORLD_MAX);
+		Polygon.Vertices.Add(Base + AxisX * HALF_WORLD_MAX - AxisY * HALF_WORLD_MAX);
+		Polygon.Vertices.Add(Base - AxisX * HALF_WORLD_MAX - AxisY * HALF_WORLD_MAX);
+		Polygon.Vertices.Add(Base - AxisX * HALF_WORLD_MAX + AxisY * HALF_WORLD_MAX);
 
 		for (int32 j = 0; j < planes.Num(); j++)
 		{
 			if (i != j)
 			{
-				if (!Polygon->Split(-FVector(planes[j]), planes[j] * planes[j].W))
+				if (!Polygon.Split(-FVector(planes[j]), planes[j] * planes[j].W))
 				{
-					Polygon->Vertices.Empty();
+					Polygon.Vertices.Empty();
 					break;
 				}
 			}
 		}
 
+		// Faces that have been clipped away don't contribute to the kdop
+		if (Polygon.Vertices.Num() < 3)
+			continue;
+
+		NumFaces++;
+
+		// Faces share their vertices with their neighbours, only keep one of each
+		for (const FVector& Vertex : Polygon.Vertices)
+		{
+			const bool bFound = HullVertices.ContainsByPredicate([&Vertex](const FVector& HullVertex)
+			{
+				return FVector::PointsAreNear(Vertex, HullVertex, THRESH_POINTS_ARE_SAME);
+			});
+
+			if (!bFound)
+				HullVertices.Add(Vertex);
+		}
+	}
+
+	if (NumFaces < 4 || HullVertices.Num() < 4)
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to generate a simple KDOP collider."));
+		return 0;
+	}
+
+	FKConvexElem ConvexCollision;
+	ConvexCollision.VertexData = MoveTemp(HullVertices);
+	ConvexCollision.UpdateElemBox();
+
+	OutAggregateCollisions.ConvexElems.Add(ConvexCollision);
+
+	return 1;
+}
+
+#if WITH_EDITOR
+// Previous kdop generation, kept for Houdini.BenchmarkKDopColliders: the kdop faces are added to a temporary UModel,
+// a BSP is built from it and a temporary UBodySetup creates the convex elements from the BSP.
+static int32
+GenerateKDopWithBSP(const TArray<FVector>& InPositionArray, const TArray<FVector>& Dirs, FKAggregateGeom& OutAggregateCollisions)
+{
+	const int32 kCount = Dirs.Num();
+	TArray<float> maxDist;
+	maxDist.Init(-3.402823466e+38F, kCount);
+	for (int32 i = 0; i < InPositionArray.Num(); i++)
+	{
+		for (int32 j = 0; j < kCount; j++)
+			maxDist[j] = FMath::Max(InPositionArray[i] | Dirs[j], maxDist[j]);
+	}
+
+	UModel* TempModel = NewObject<UModel>();
+	TempModel->Initialize(nullptr, 1);
+
+	for (int32 i = 0; i < kCount; i++)
+	{
+		const FPlane Plane(Dirs[i], maxDist[i] + 0.1f);
+		FPoly* Polygon = new(TempModel->Polys->Element) FPoly();
+		FVector AxisX, AxisY;
+
+		Polygon->Init();
+		Polygon->Normal = Plane;
+		Polygon->Normal.FindBestAxisVectors(AxisX, AxisY);
+
+		const FVector Base = Plane * Plane.W;
+		new(Polygon->Vertices) FVector(Base + AxisX * HALF_WORLD_MAX + AxisY * HALF_WORLD_MAX);
+		new(Polygon->Vertices) FVector(Base + AxisX * HALF_WORLD_MAX - AxisY * HALF_WORLD_MAX);
+		new(Polygon->Vertices) FVector(Base - AxisX * HALF_WORLD_MAX - AxisY * HALF_WORLD_MAX);
+		new(Polygon->Vertices) FVector(Base - AxisX * HALF_WORLD_MAX + AxisY * HALF_WORLD_MAX);
+
+		for (int32 j = 0; j < kCount; j++)
+		{
+			const FPlane OtherPlane(Dirs[j], maxDist[j] + 0.1f);
+			if (i != j && !Polygon->Split(-FVector(OtherPlane), OtherPlane * OtherPlane.W))
+			{
+				Polygon->Vertices.Empty();
+				break;
+			}
+		}
+
 		if (Polygon->Vertices.Num() < 3)
 		{
-			// If poly resulted in no verts, remove from array
 			TempModel->Polys->Element.RemoveAt(TempModel->Polys->Element.Num() - 1);
 		}
 		else
 		{
-			// Other stuff...
 			Polygon->iLink = i;
 			Polygon->CalcNormal(1);
 		}
 	}
 
 	if (TempModel->Polys->Element.Num() < 4)
-	{
-		TempModel = NULL;
-		HOUDINI_LOG_WARNING(TEXT("Failed to generate a simple KDOP collider."));
 		return 0;
-	}
 
-	// Build bounding box.
 	TempModel->BuildBound();
-
-	// Build BSP for the brush.
 	FBSPOps::bspBuild(TempModel, FBSPOps::BSP_Good, 15, 70, 1, 0);
 	FBSPOps::bspRefresh(TempModel, 1);
 	FBSPOps::bspBuildBounds(TempModel);
 
-	// Now, create a temporary BodySetup to build the colliders
 	UBodySetup* TempBS = NewObject<UBodySetup>();
 	TempBS->CreateFromModel(TempModel, false);
+	OutAggregateCollisions.ConvexElems.Append(TempBS->AggGeom.ConvexElems);
+
+	return TempBS->AggGeom.ConvexElems.Num();
+}
+
+void
+FHoudiniMeshTranslator::RunKDopBenchmark(const int32& InNumPoints, const int32& InNumIterations)
+{
+	const int32 NumPoints = FMath::Max(InNumPoints, 4);
+	const int32 NumIterations = FMath::Max(InNumIterations, 1);
+
+	// Generate the points in a rotated ellipsoid, so every kdop direction clips the hull
+	FRandomStream RandomStream(0x4b444f50);
+	const FQuat Rotation(FVector(1.0f, 2.0f, 3.0f).GetSafeNormal(), 0.5f);
+	TArray<FVector> Positions;
+	Positions.SetNumUninitialized(NumPoints);
+	for (FVector& Position : Positions)
+		Position = Rotation.RotateVector(RandomStream.GetUnitVector() * FVector(300.0f, 100.0f, 50.0f) * RandomStream.FRand());
+
+	struct FKDopType
+	{
+		const TCHAR* Name;
+		const FVector* Directions;
+		int32 NumDirections;
+	};
+	const FKDopType KDopTypes[] =
+	{
+		{ TEXT("kdop10X"), KDopDir10X, 10 },
+		{ TEXT("kdop18"), KDopDir18, 18 },
+		{ TEXT("kdop26"), KDopDir26, 26 }
+	};
 
-	// Copy the convex elements back to our aggregate
-	int32 NewConvexElems = 0;
-	if (TempBS && TempBS->AggGeom.ConvexElems.Num() > 0)
+	for (const FKDopType& KDopType : KDopTypes)
 	{
-		for (const auto& CurConvexElem : TempBS->AggGeom.ConvexElems)
+		TArray<FVector> DirArray(KDopType.Directions, KDopType.NumDirections);
+
+		FKAggregateGeom BSPCollisions;
+		double Tick = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			BSPCollisions.EmptyElements();
+			GenerateKDopWithBSP(Positions, DirArray, BSPCollisions);
+		}
+		const double BSPTime = (FPlatformTime::Seconds() - Tick) / NumIterations;
+
+		FKAggregateGeom NativeCollisions;
+		Tick = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
 		{
-			OutAggregateCollisions.ConvexElems.Add(CurConvexElem);
-			NewConvexElems++;
+			NativeCollisions.EmptyElements();
+			GenerateKDopAsSimpleCollision(Positions, DirArray, NativeCollisions);
 		}
+		const double NativeTime = (FPlatformTime::Seconds() - Tick) / NumIterations;
+
+		// Both routes should produce the same hull, compare their bounds
+		FBox BSPBox(ForceInit);
+		for (const FKConvexElem& ConvexElem : BSPCollisions.ConvexElems)
+			BSPBox += ConvexElem.ElemBox;
+
+		FBox NativeBox(ForceInit);
+		for (const FKConvexElem& ConvexElem : NativeCollisions.ConvexElems)
+			NativeBox += ConvexElem.ElemBox;
+
+		const bool bMatch = BSPBox.IsValid && NativeBox.IsValid
+			&& BSPBox.Min.Equals(NativeBox.Min, KINDA_SMALL_NUMBER * 100.0f)
+			&& BSPBox.Max.Equals(NativeBox.Max, KINDA_SMALL_NUMBER * 100.0f);
+
+		HOUDINI_LOG_MESSAGE(
+			TEXT("KDop collider benchmark - %s: BSP %.3fms, native %.3fms (x%.1f), %d/%d hull vertices%s"),
+			KDopType.Name, BSPTime * 1000.0, NativeTime * 1000.0,
+			NativeTime > 0.0 ? BSPTime / NativeTime : 0.0,
+			BSPCollisions.ConvexElems.Num() > 0 ? BSPCollisions.ConvexElems[0].VertexData.Num() : 0,
+			NativeCollisions.ConvexElems.Num() > 0 ? NativeCollisions.ConvexElems[0].VertexData.Num() : 0,
+			bMatch ? TEXT("") : TEXT(" - RESULTS DIFFER"));
 	}
+}
 
-	return NewConvexElems;
+static void
+HoudiniBenchmarkKDopCollidersCommand(const TArray<FString>& Args)
+{
+	int32 NumPoints = HOUDINI_KDOP_BENCHMARK_POINTS;
+	if (Args.Num() > 0 && Args[0].IsNumeric())
+		NumPoints = FCString::Atoi(*Args[0]);
+
+	int32 NumIterations = HOUDINI_KDOP_BENCHMARK_ITERATIONS;
+	if (Args.Num() > 1 && Args[1].IsNumeric())
+		NumIterations = FCString::Atoi(*Args[1]);
+
+	FHoudiniMeshTranslator::RunKDopBenchmark(NumPoints, NumIterations);
+}
+
+static FAutoConsoleCommand CCmdHoudiniBenchmarkKDopColliders(
+	TEXT("Houdini.BenchmarkKDopColliders"),
+	TEXT("Compares the kdop collider generation to the previous BSP based generation and logs the timings.\n")
+	TEXT("Houdini.BenchmarkKDopColliders [NumPoints] [NumIterations]: defaults to 10000 points and 100 iterations per kdop type.\n"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&HoudiniBenchmarkKDopCollidersCommand));
+#else
+void
+FHoudiniMeshTranslator::RunKDopBenchmark(const int32& InNumPoints, const int32& InNumIterations)
+{
 }
+#endif
 
 
 bool
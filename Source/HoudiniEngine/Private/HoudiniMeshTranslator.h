@@ -48,6 +48,8 @@ class UHoudiniStaticMeshComponent;
 
 struct FKAggregateGeom;
 struct FHoudiniGenericAttribute;
+struct FMeshDescription;
+struct FHoudiniEngineOutputStats;
 
 
 UENUM()
@@ -85,7 +87,8 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 			const FHoudiniStaticMeshGenerationProperties& InSMGenerationProperties,
 			UObject* InOuterComponent,
 			bool bInTreatExistingMaterialsAsUpToDate=false,
-			bool bInDestroyProxies=false);
+			bool bInDestroyProxies=false,
+			FHoudiniEngineOutputStats* OutStats=nullptr);
 	
 		static bool CreateStaticMeshFromHoudiniGeoPartObject(
 			const FHoudiniGeoPartObject& InHGPO,
@@ -97,7 +100,8 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 			const bool& InForceRebuild,
 			const EHoudiniStaticMeshMethod& InStaticMeshMethod,
 			const FHoudiniStaticMeshGenerationProperties& InSMGenerationProperties,
-			bool bInTreatExistingMaterialsAsUpToDate = false);
+			bool bInTreatExistingMaterialsAsUpToDate = false,
+			FHoudiniEngineOutputStats* OutStats = nullptr);
 
 		static bool CreateOrUpdateAllComponents(
 			UHoudiniOutput* InOutput,
@@ -174,11 +178,40 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		static bool UpdateGenericPropertiesAttributes(
 			UObject* InObject, const TArray<FHoudiniGenericAttribute>& InAllPropertyAttributes);
 
+		// Compares the kdop collider generation to the previous BSP based generation on generated points and logs the timings.
+		// Needs to be called on the game thread, as the BSP route creates UObjects.
+		static void RunKDopBenchmark(const int32& InNumPoints, const int32& InNumIterations);
+
+		// Compares the split bookkeeping indexed by split id to the previous split name keyed maps on generated split groups,
+		// and logs the timings.
+		static void RunSplitGroupsBenchmark(const int32& InNumSplits, const int32& InNumFacesPerSplit, const int32& InNumIterations);
+
 	protected:
 
+		// Data needed to build a split's MeshDescription outside of the game thread
+		struct FMeshDescriptionBuildData
+		{
+			int32 SplitId = -1;
+			FString SplitGroupName;
+			// MeshDescription created on the game thread, filled by the build
+			FMeshDescription* MeshDescription = nullptr;
+			// Polygon group index for each of the split's faces
+			TArray<int32> SplitFaceMaterialIndices;
+			bool bReadTangents = true;
+
+			// Results of the build
+			bool bHasNormal = false;
+			bool bHasTangents = false;
+			double BuildTime = 0.0;
+		};
+
 		// Create a StaticMesh using the MeshDescription format
 		bool CreateStaticMesh_MeshDescription();
 
+		// Fills a split's MeshDescription using the part caches, which must have been updated beforehand.
+		// Doesn't modify the translator or any UObject, so splits can be built concurrently on worker threads.
+		void BuildSplitMeshDescription(FMeshDescriptionBuildData& InOutBuildData) const;
+
 		// Legacy function using RawMesh for static Mesh creation
 		bool CreateStaticMesh_RawMesh();
 
@@ -232,20 +265,70 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// Updates and create the material that are needed for this part
 		bool CreateNeededMaterials();
 
-		UStaticMesh* CreateNewStaticMesh(const FString& InMeshIdentifierString);
+		// Creates a new static mesh for a split. If bInUniquePackage is true, existing packages
+		// are never replaced (used when the existing mesh is shared with identical parts)
+		UStaticMesh* CreateNewStaticMesh(const FString& InMeshIdentifierString, const bool& bInUniquePackage = false);
 
 		UStaticMesh* FindExistingStaticMesh(const FHoudiniOutputObjectIdentifier& InIdentifier);
 
+		// Indicates if a static mesh is also used by output objects with a different identifier,
+		// or by other outputs of the component
+		bool IsStaticMeshShared(const UStaticMesh* InStaticMesh, const FHoudiniOutputObjectIdentifier& InIdentifier) const;
+
+		// Computes a hash of all the part data used to build its static meshes:
+		// vertex list, split groups, positions, normals, tangents, colors, alpha, UVs, face smoothing, lightmap resolution,
+		// LOD screensizes, materials, sockets and generic uproperty attributes.
+		// Positions and sockets are hashed relative to the part's pivot (its first point) so that translated copies
+		// of a part have the same hash. Instanced parts are hashed in part space, as their meshes can't be offset.
+		// The part caches filled here are then reused when building the meshes.
+		uint64 ComputePartGeometryHash(const bool& bRemoveUnusedUVSets);
+
+		// Looks for static meshes generated by another part with the same geometry hash, in this cook (in any
+		// output of the component if a FHoudiniStaticMeshSharingScope is opened) or in the previous one, and shares
+		// them with this part's splits. The difference between the parts' pivots is applied to the components.
+		// Returns false if no identical part was found and the static meshes need to be created.
+		bool ShareStaticMeshesFromIdenticalPart();
+
+		// Returns the offset to apply to this part's components when using a static mesh generated
+		// for the given output object. Returns false if the static mesh can't be used by this part.
+		bool GetSharedMeshOffset(const FVector& InGeometryPivot, const FVector& InMeshOffset, FVector& OutMeshOffset) const;
+
+		// Indicates if the static meshes of this part can be shared with the other outputs of the component
+		bool IsSharingAcrossOutputs() const;
+
+		// Makes a static mesh generated by this part available to the other outputs of the component
+		void RegisterSharedStaticMesh(const FString& InSplitIdentifier, const FHoudiniOutputObject& InOutputObject) const;
+
+		// Reuses this part's static meshes from the previous cook as they are, if their geometry hash matches the
+		// current one, even if Houdini flagged the part as changed.
+		// Returns false if the static meshes need to be updated.
+		bool ReuseUnchangedStaticMeshes();
+
+		// Fills a map of the output identifiers for all this part's valid splits, by split identifier
+		void GetPartOutputIdentifiers(TMap<FString, FHoudiniOutputObjectIdentifier>& OutIdentifiers);
+
+		// Caches the attributes needed for baking (level path, output name, tile...) on an output object
+		void CacheOutputObjectAttributes(FHoudiniOutputObject& InOutputObject) const;
+
 		UHoudiniStaticMesh* CreateNewHoudiniStaticMesh(const FString& InMeshIdentifierString);
 
 		UHoudiniStaticMesh* FindExistingHoudiniStaticMesh(const FHoudiniOutputObjectIdentifier& InIdentifier);
 
-		float GetLODSCreensizeForSplit(const FString& SplitGroupName);
+		float GetLODSCreensizeForSplit(const int32 SplitId);
+
+		// Returns the split id of a split group, INDEX_NONE if the part doesn't have this split
+		int32 GetSplitId(const FString& SplitGroupName) const;
 
 		// Create convex/UCX collider for a split and add to the aggregate
-		bool AddConvexCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions);
+		bool AddConvexCollisionToAggregate(const int32 SplitId, FKAggregateGeom& AggCollisions);
 		// Create simple colliders for a split and add to the aggregate
-		bool AddSimpleCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions);
+		bool AddSimpleCollisionToAggregate(const int32 SplitId, FKAggregateGeom& AggCollisions);
+		// Create the simple colliders of all the simple collider splits, in parallel. The result is indexed by split id.
+		void GenerateAllSimpleCollisions(TArray<FKAggregateGeom>& OutSimpleCollisions);
+		// Returns the valid vertex indices used by a split, in order of first use
+		void GetUniqueSplitVertexIndices(const TArray<int32>& InSplitVertexList, TArray<int32>& OutUniqueVertexIndices) const;
+
+		static void AppendAggregateCollisions(const FKAggregateGeom& InCollisions, FKAggregateGeom& OutAggregateCollisions);
 		
 		// Helper functions to generate the simple colliders and add them to the aggregate
 		static int32 GenerateBoxAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions);
@@ -289,6 +372,53 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		static bool AddActorsToMeshSocket(UStaticMeshSocket * Socket, UStaticMeshComponent * StaticMeshComponent, 
 			TArray<AActor*>& HoudiniCreatedSocketActors, TArray<AActor*>& HoudiniAttachedSocketActors);
 
+		// Build batches are opened and closed with FHoudiniStaticMeshBuildBatchScope
+		friend struct FHoudiniStaticMeshBuildBatchScope;
+
+		// Opens a static mesh build batch, calls can be nested.
+		// While a batch is opened, the generated static meshes are not built right away, but all
+		// together via UStaticMesh::BatchBuild when the outermost batch is closed.
+		static void BeginStaticMeshBuildBatch();
+
+		// Closes a build batch, and builds all the pending static meshes if it was the outermost one.
+		static void EndStaticMeshBuildBatch();
+
+		// Builds a static mesh, or defers its build to the end of the current build batch
+		static void BuildStaticMesh(UStaticMesh* InStaticMesh);
+
+		// Builds the static meshes in parallel and refreshes the components using them
+		static void BuildStaticMeshes(const TArray<UStaticMesh*>& InStaticMeshes);
+
+		// Static meshes waiting for the current build batch to be closed
+		static TArray<TWeakObjectPtr<UStaticMesh>> PendingStaticMeshBuilds;
+
+		// Number of opened build batches
+		static int32 StaticMeshBuildBatchCount;
+
+		// Sharing scopes are opened and closed with FHoudiniStaticMeshSharingScope
+		friend struct FHoudiniStaticMeshSharingScope;
+
+		// Static mesh generated for a split, that can be shared with the identical parts of other outputs
+		struct FSharedSplitMesh
+		{
+			TWeakObjectPtr<UStaticMesh> StaticMesh;
+			FVector GeometryPivot = FVector::ZeroVector;
+			FVector MeshOffset = FVector::ZeroVector;
+		};
+
+		// Static meshes generated during the current sharing scope, per geometry hash and split identifier
+		static TMap<uint64, TMap<FString, FSharedSplitMesh>> SharedSplitMeshes;
+
+		// Static meshes used by more than one output of the component when the sharing scope was opened,
+		// or made available to the other outputs since. They must not be updated in place or destroyed by an output.
+		static TSet<const UObject*> StaticMeshesSharedByOutputs;
+
+		// Component whose outputs are sharing their static meshes
+		static FGuid SharingComponentGUID;
+
+		// Number of opened sharing scopes
+		static int32 StaticMeshSharingScopeCount;
+
 	protected:
 
 		// Data cache for this translator
@@ -328,23 +458,27 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// The generated simple/UCX colliders
 		TMap <FHoudiniOutputObjectIdentifier, FKAggregateGeom> AllAggregateCollisions;
 
-		// Names of the groups used for splitting the geometry
+		// Names of the groups used for splitting the geometry, in processing order.
+		// The index of a split group in this array is its split id, used to index the per-split arrays below.
 		TArray<FString> AllSplitGroups;
 
+		// Split id of each split group name
+		TMap<FString, int32> AllSplitGroupIds;
+
 		// Per-split lists of faces
-		TMap<FString, TArray<int32>> AllSplitVertexLists;
+		TArray<TArray<int32>> AllSplitVertexLists;
 
 		// Per-split number of faces
-		TMap<FString, int32> AllSplitVertexCounts;
+		TArray<int32> AllSplitVertexCounts;
 
 		// Per-split indices arrays
-		TMap<FString, TArray<int32>> AllSplitFaceIndices;
+		TArray<TArray<int32>> AllSplitFaceIndices;
 
 		// Per-split first valid vertex index
-		TMap<FString, int32> AllSplitFirstValidVertexIndex;
+		TArray<int32> AllSplitFirstValidVertexIndex;
 
 		// Per-split first valid prim index
-		TMap<FString, int32> AllSplitFirstValidPrimIndex;
+		TArray<int32> AllSplitFirstValidPrimIndex;
 
 		// Vertex Indices for the part
 		TArray<int32> PartVertexList;
@@ -409,6 +543,14 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 
 		int32 DefaultMeshSmoothing;
 
+		// Hash of the part's geometry, see ComputePartGeometryHash()
+		uint64 PartGeometryHash = 0;
+		// Pivot the part's geometry was hashed relative to, in unreal space
+		FVector PartGeometryPivot = FVector::ZeroVector;
+
+		// Optional stats receiving the number of skipped static meshes
+		FHoudiniEngineOutputStats* OutputStats = nullptr;
+
 		// When building a mesh, if an associated material already exists, treat
 		// it as up to date, regardless of the MaterialInfo.bHasChanged flag
 		bool bTreatExistingMaterialsAsUpToDate;
@@ -416,3 +558,19 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// Default properties to be used when generating Static Meshes
 		FHoudiniStaticMeshGenerationProperties StaticMeshGenerationProperties;
 };
+
+// Defers the build of the static meshes created by FHoudiniMeshTranslator for the lifetime of this object.
+// Components can be assigned the deferred meshes, their bounds and render state are refreshed once the meshes are built.
+struct HOUDINIENGINE_API FHoudiniStaticMeshBuildBatchScope
+{
+	FHoudiniStaticMeshBuildBatchScope();
+	~FHoudiniStaticMeshBuildBatchScope();
+};
+
+// Lets the identical parts of all the outputs of a Houdini Asset Component share their static meshes
+// for the lifetime of this object. Scopes can be nested, only the outermost one is used.
+struct HOUDINIENGINE_API FHoudiniStaticMeshSharingScope
+{
+	FHoudiniStaticMeshSharingScope(UHoudiniAssetComponent* InHAC);
+	~FHoudiniStaticMeshSharingScope();
+};
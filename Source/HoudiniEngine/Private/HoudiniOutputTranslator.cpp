@@ -31,6 +31,8 @@
 #include "HoudiniEngine.h"
 
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineOutputStats.h"
+#include "HoudiniPartAttributeCache.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniEnginePrivatePCH.h"
@@ -68,6 +70,9 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
+	// The asset has finished cooking, its parts' attributes can be cached while updating the outputs
+	FHoudiniPartAttributeCacheScope AttributeCacheScope;
+
 	// Get the bake folder override
 	FHoudiniOutputTranslator::GetBakeFolderFromAttribute(HAC);
 
@@ -217,173 +222,187 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 	// ----------------------------------------------------
 	// Process outputs
 	// ----------------------------------------------------
+	FHoudiniEngineOutputStats OutputStats;
 	TArray<UPackage*> CreatedPackages;
-	for (int32 OutputIdx = 0; OutputIdx < NumOutputs; OutputIdx++)
 	{
-		UHoudiniOutput* CurOutput = HAC->GetOutputAt(OutputIdx);
-		if (!CurOutput || CurOutput->IsPendingKill())
-			continue;
+		// The static meshes of all the outputs are built together when this scope closes, once they have all been created
+		FHoudiniStaticMeshBuildBatchScope BuildBatchScope;
+		// Identical parts of different outputs can share their static meshes
+		FHoudiniStaticMeshSharingScope SharingScope(HAC);
+		for (int32 OutputIdx = 0; OutputIdx < NumOutputs; OutputIdx++)
+		{
+			UHoudiniOutput* CurOutput = HAC->GetOutputAt(OutputIdx);
+			if (!CurOutput || CurOutput->IsPendingKill())
+				continue;
 
-		FString Notification = FString::Format(TEXT("Processing output {0} / {1}..."), {FString::FromInt(OutputIdx + 1), FString::FromInt(NumOutputs)});
-		FHoudiniEngine::Get().UpdateTaskSlateNotification(FText::FromString(Notification));
+			FString Notification = FString::Format(TEXT("Processing output {0} / {1}..."), {FString::FromInt(OutputIdx + 1), FString::FromInt(NumOutputs)});
+			FHoudiniEngine::Get().UpdateTaskSlateNotification(FText::FromString(Notification));
 
-		if (!HAC->IsOutputTypeSupported(CurOutput->GetType()))
-			continue;
+			if (!HAC->IsOutputTypeSupported(CurOutput->GetType()))
+				continue;
 
-		switch (CurOutput->GetType())
-		{
-			case EHoudiniOutputType::Mesh:
+			switch (CurOutput->GetType())
 			{
-				bool bIsProxyStaticMeshEnabled = (
-					HAC->IsProxyStaticMeshEnabled() &&
-					!HAC->HasNoProxyMeshNextCookBeenRequested() &&
-					!HAC->IsBakeAfterNextCookEnabled());
-				if (bIsProxyStaticMeshEnabled && NumInstances > 1)
+				case EHoudiniOutputType::Mesh:
 				{
-					if (bHasObjectInstancer)
+					bool bIsProxyStaticMeshEnabled = (
+						HAC->IsProxyStaticMeshEnabled() &&
+						!HAC->HasNoProxyMeshNextCookBeenRequested() &&
+						!HAC->IsBakeAfterNextCookEnabled());
+					if (bIsProxyStaticMeshEnabled && NumInstances > 1)
 					{
-						// Completely disable proxies if we have object instancers/old school attribute instancers
-						// as they rely on having a static mesh created (and the instanced mesh HGPO is not marked as instanced...)
-						bIsProxyStaticMeshEnabled = false;
-					}
-					else
-					{
-						// If we dont have proxy instancer, enable proxy only for non-instanced mesh
-						for (const FHoudiniGeoPartObject &HGPO : CurOutput->GetHoudiniGeoPartObjects())
+						if (bHasObjectInstancer)
+						{
+							// Completely disable proxies if we have object instancers/old school attribute instancers
+							// as they rely on having a static mesh created (and the instanced mesh HGPO is not marked as instanced...)
+							bIsProxyStaticMeshEnabled = false;
+						}
+						else
 						{
-							if (HGPO.bIsInstanced && HGPO.Type == EHoudiniPartType::Mesh)
+							// If we dont have proxy instancer, enable proxy only for non-instanced mesh
+							for (const FHoudiniGeoPartObject &HGPO : CurOutput->GetHoudiniGeoPartObjects())
 							{
-								bIsProxyStaticMeshEnabled = false;
-								break;
+								if (HGPO.bIsInstanced && HGPO.Type == EHoudiniPartType::Mesh)
+								{
+									bIsProxyStaticMeshEnabled = false;
+									break;
+								}
 							}
 						}
 					}
-				}
 
-				FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
-					CurOutput, 
-					PackageParams, 
-					bIsProxyStaticMeshEnabled ? EHoudiniStaticMeshMethod::UHoudiniStaticMesh : HAC->StaticMeshMethod,
-					HAC->StaticMeshGenerationProperties,
-					OuterComponent);
+					FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
+						CurOutput, 
+						PackageParams, 
+						bIsProxyStaticMeshEnabled ? EHoudiniStaticMeshMethod::UHoudiniStaticMesh : HAC->StaticMeshMethod,
+						HAC->StaticMeshGenerationProperties,
+						OuterComponent,
+						false,
+						false,
+						&OutputStats);
 
-				NumVisibleOutputs++;
+					NumVisibleOutputs++;
 
-				// Look for UHoudiniStaticMesh in the output, and set bOutHasHoudiniStaticMeshOutput accordingly
-				if (bIsProxyStaticMeshEnabled && !bOutHasHoudiniStaticMeshOutput)
-				{
-					bOutHasHoudiniStaticMeshOutput &= CurOutput->HasAnyCurrentProxy();
-				}
+					// Look for UHoudiniStaticMesh in the output, and set bOutHasHoudiniStaticMeshOutput accordingly
+					if (bIsProxyStaticMeshEnabled && !bOutHasHoudiniStaticMeshOutput)
+					{
+						bOutHasHoudiniStaticMeshOutput &= CurOutput->HasAnyCurrentProxy();
+					}
 
-				break;
-			}
+					break;
+				}
 
-			case EHoudiniOutputType::Curve:
-			{
-				const TArray<FHoudiniGeoPartObject> &GeoPartObjects = CurOutput->GetHoudiniGeoPartObjects();
+				case EHoudiniOutputType::Curve:
+				{
+					const TArray<FHoudiniGeoPartObject> &GeoPartObjects = CurOutput->GetHoudiniGeoPartObjects();
 
-				if (GeoPartObjects.Num() <= 0)
-					continue;
+					if (GeoPartObjects.Num() <= 0)
+						continue;
 
-				const FHoudiniGeoPartObject & CurHGPO = GeoPartObjects[0];
+					const FHoudiniGeoPartObject & CurHGPO = GeoPartObjects[0];
 
-				if (CurOutput->IsEditableNode())
-				{
-					if (!CurOutput->HasEditableNodeBuilt())
+					if (CurOutput->IsEditableNode())
 					{
-						// Editable curve, only need to be built once. 
-						UHoudiniSplineComponent* HoudiniSplineComponent = FHoudiniSplineTranslator::CreateHoudiniSplineComponentFromHoudiniEditableNode(
-							CurHGPO.GeoId, 
-							CurHGPO.PartName,
-							HAC);
-
-						HoudiniSplineComponent->SetIsEditableOutputCurve(true);
-
-						FHoudiniOutputObjectIdentifier EditableSplineComponentIdentifier;
-						EditableSplineComponentIdentifier.ObjectId = CurHGPO.ObjectId;
-						EditableSplineComponentIdentifier.GeoId = CurHGPO.GeoId;
-						EditableSplineComponentIdentifier.PartId = CurHGPO.PartId;
-						EditableSplineComponentIdentifier.PartName = CurHGPO.PartName;
+						if (!CurOutput->HasEditableNodeBuilt())
+						{
+							// Editable curve, only need to be built once. 
+							UHoudiniSplineComponent* HoudiniSplineComponent = FHoudiniSplineTranslator::CreateHoudiniSplineComponentFromHoudiniEditableNode(
+								CurHGPO.GeoId, 
+								CurHGPO.PartName,
+								HAC);
+
+							HoudiniSplineComponent->SetIsEditableOutputCurve(true);
+
+							FHoudiniOutputObjectIdentifier EditableSplineComponentIdentifier;
+							EditableSplineComponentIdentifier.ObjectId = CurHGPO.ObjectId;
+							EditableSplineComponentIdentifier.GeoId = CurHGPO.GeoId;
+							EditableSplineComponentIdentifier.PartId = CurHGPO.PartId;
+							EditableSplineComponentIdentifier.PartName = CurHGPO.PartName;
 						
-						TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& OutputObjects = CurOutput->GetOutputObjects();
-						FHoudiniOutputObject& FoundOutputObject = OutputObjects.FindOrAdd(EditableSplineComponentIdentifier);
-						FoundOutputObject.OutputComponent = HoudiniSplineComponent;
+							TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& OutputObjects = CurOutput->GetOutputObjects();
+							FHoudiniOutputObject& FoundOutputObject = OutputObjects.FindOrAdd(EditableSplineComponentIdentifier);
+							FoundOutputObject.OutputComponent = HoudiniSplineComponent;
 
-						CurOutput->SetHasEditableNodeBuilt(true);
+							CurOutput->SetHasEditableNodeBuilt(true);
+						}
+					}
+					else
+					{	
+						// Output curve
+						FHoudiniSplineTranslator::CreateAllSplinesFromHoudiniOutput(CurOutput, OuterComponent);
+						NumVisibleOutputs += CurOutput->GetOutputObjects().Num();
+						break;
 					}
 				}
-				else
-				{	
-					// Output curve
-					FHoudiniSplineTranslator::CreateAllSplinesFromHoudiniOutput(CurOutput, OuterComponent);
-					NumVisibleOutputs += CurOutput->GetOutputObjects().Num();
+				break;
+
+			case EHoudiniOutputType::Instancer:
+				InstancerOutputs.Add(CurOutput);
+				break;
+
+			case EHoudiniOutputType::Landscape:
+			{
+				NumVisibleOutputs++;
+
+				// This gets called for each heightfield primitive from Houdini, i.e., each "tile".
+				bool bNewMapCreated = false;
+				// Registering of untracked actors is not currently used in the HDA
+				// workflow. HDA cleanup will manually search for shared landscapes
+				// and remove them. That aforementioned behaviour should really be updated to 
+				// make use of untracked actors on the HAC (similar to PDG Asset Link).
+				TArray<TWeakObjectPtr<AActor>> UntrackedActors;
+
+				FHoudiniLandscapeTranslator::CreateLandscape(
+					CurOutput,
+					UntrackedActors,
+					InputLandscapesToUpdate,
+					AllInputLandscapes,
+					HAC,
+					TEXT("{hda_actor_name}_"),
+					PersistentWorld,
+					LandscapeLayerGlobalMinimums,
+					LandscapeLayerGlobalMaximums,
+					PackageParams,
+					CreatedPackages);
+
+				bHasLandscape = true;
+
+				// Attach the created landscape to the parent HAC.
+				ALandscapeProxy* OutputLandscape = nullptr;
+				for (auto& Pair : CurOutput->GetOutputObjects()) 
+				{
+					UHoudiniLandscapePtr* LandscapePtr = Cast<UHoudiniLandscapePtr>(Pair.Value.OutputObject);
+					OutputLandscape = LandscapePtr->GetRawPtr();
 					break;
 				}
-			}
-			break;
 
-		case EHoudiniOutputType::Instancer:
-			InstancerOutputs.Add(CurOutput);
-			break;
+				if (OutputLandscape) 
+				{
+					// Attach the created landscapes to HAC
+					// Output Transforms are always relative to the HDA
+					HAC->SetMobility(EComponentMobility::Static);
+					OutputLandscape->AttachToComponent(HAC, FAttachmentTransformRules::KeepWorldTransform);
+					// Note that the above attach will cause the collision components to crap out. This manifests
+					// itself via the Landscape editor tools not being able to trace Landscape collision components.
+					// By recreating collision components here, it appears to put things back into working order. 
+					OutputLandscape->RecreateCollisionComponents();
+				}
+
+				bCreatedNewMaps |= bNewMapCreated;
 
-		case EHoudiniOutputType::Landscape:
-		{
-			NumVisibleOutputs++;
-
-			// This gets called for each heightfield primitive from Houdini, i.e., each "tile".
-			bool bNewMapCreated = false;
-			// Registering of untracked actors is not currently used in the HDA
-			// workflow. HDA cleanup will manually search for shared landscapes
-			// and remove them. That aforementioned behaviour should really be updated to 
-			// make use of untracked actors on the HAC (similar to PDG Asset Link).
-			TArray<TWeakObjectPtr<AActor>> UntrackedActors;
-
-			FHoudiniLandscapeTranslator::CreateLandscape(
-				CurOutput,
-				UntrackedActors,
-				InputLandscapesToUpdate,
-				AllInputLandscapes,
-				HAC,
-				TEXT("{hda_actor_name}_"),
-				PersistentWorld,
-				LandscapeLayerGlobalMinimums,
-				LandscapeLayerGlobalMaximums,
-				PackageParams,
-				CreatedPackages);
-
-			bHasLandscape = true;
-
-			// Attach the created landscape to the parent HAC.
-			ALandscapeProxy* OutputLandscape = nullptr;
-			for (auto& Pair : CurOutput->GetOutputObjects()) 
-			{
-				UHoudiniLandscapePtr* LandscapePtr = Cast<UHoudiniLandscapePtr>(Pair.Value.OutputObject);
-				OutputLandscape = LandscapePtr->GetRawPtr();
 				break;
 			}
-
-			if (OutputLandscape) 
-			{
-				// Attach the created landscapes to HAC
-				// Output Transforms are always relative to the HDA
-				HAC->SetMobility(EComponentMobility::Static);
-				OutputLandscape->AttachToComponent(HAC, FAttachmentTransformRules::KeepWorldTransform);
-				// Note that the above attach will cause the collision components to crap out. This manifests
-				// itself via the Landscape editor tools not being able to trace Landscape collision components.
-				// By recreating collision components here, it appears to put things back into working order. 
-				OutputLandscape->RecreateCollisionComponents();
+			default:
+				// Do Nothing for now
+				break;
 			}
-
-			bCreatedNewMaps |= bNewMapCreated;
-
-			break;
-		}
-		default:
-			// Do Nothing for now
-			break;
 		}
 	}
 
+	const int32 NumSkippedMeshes = OutputStats.GetNumObjectsSkipped(EHoudiniOutputType::Mesh);
+	if (NumSkippedMeshes > 0)
+		HOUDINI_LOG_MESSAGE(TEXT("%s: %d static mesh(es) with unchanged geometry were not rebuilt."), *HAC->GetName(), NumSkippedMeshes);
+
 	// Now that all meshes have been created, process the instancers
 	for (auto& CurOutput : InstancerOutputs)
 	{
@@ -512,6 +531,37 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(UHoudiniAss
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
+	bool bFoundProxies = false;
+	{
+		// Build the refined static meshes together when this scope closes, once they have all been created
+		FHoudiniStaticMeshBuildBatchScope BuildBatchScope;
+		FHoudiniStaticMeshSharingScope SharingScope(HAC);
+		for (auto& CurOutput : HAC->Outputs)
+		{
+			if (BuildStaticMeshesOnHoudiniProxyMeshOutput(HAC, CurOutput, bInDestroyProxies))
+				bFoundProxies = true;
+		}
+	}
+
+	// Rebuild instancers if we built any static meshes from proxies
+	if (bFoundProxies)
+		UpdateInstancersAfterProxyMeshRefinement(HAC);
+
+	return true;
+}
+
+bool
+FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutput(UHoudiniAssetComponent* HAC, UHoudiniOutput* InOutput, bool bInDestroyProxies)
+{
+	if (!HAC || HAC->IsPendingKill())
+		return false;
+
+	if (!InOutput || InOutput->IsPendingKill())
+		return false;
+
+	if (InOutput->GetType() != EHoudiniOutputType::Mesh || !InOutput->HasAnyCurrentProxy())
+		return false;
+
 	UObject* OuterComponent = HAC;
 
 	FHoudiniPackageParams PackageParams;
@@ -527,43 +577,40 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(UHoudiniAss
 	PackageParams.ComponentGUID = HAC->GetComponentGUID();
 	PackageParams.ObjectName = FString();
 
-	bool bFoundProxies = false;
-	TArray<UHoudiniOutput*> InstancerOutputs;
+	// The meshes are built at the end of the batch, or with the caller's batch if one is already started
+	FHoudiniStaticMeshBuildBatchScope BuildBatchScope;
+	// The output's static meshes can be shared with the other outputs
+	FHoudiniStaticMeshSharingScope SharingScope(HAC);
+
+	FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
+		InOutput,
+		PackageParams,
+		HAC->StaticMeshMethod != EHoudiniStaticMeshMethod::UHoudiniStaticMesh ? HAC->StaticMeshMethod : EHoudiniStaticMeshMethod::RawMesh,
+		HAC->StaticMeshGenerationProperties,
+		OuterComponent,
+		true,  // bInTreatExistingMaterialsAsUpToDate
+		bInDestroyProxies
+	);
+
+	return true;
+}
+
+void
+FHoudiniOutputTranslator::UpdateInstancersAfterProxyMeshRefinement(UHoudiniAssetComponent* HAC)
+{
+	if (!HAC || HAC->IsPendingKill())
+		return;
+
+	// Instancers may reference the proxy meshes, rebuild them so they use the new static meshes
+	UObject* OuterComponent = HAC;
 	for (auto& CurOutput : HAC->Outputs)
 	{
-		const EHoudiniOutputType OutputType = CurOutput->GetType();
-		if (OutputType == EHoudiniOutputType::Mesh)
-		{
-			if (CurOutput->HasAnyCurrentProxy())
-			{
-				bFoundProxies = true;
-				FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
-					CurOutput,
-					PackageParams,
-					HAC->StaticMeshMethod != EHoudiniStaticMeshMethod::UHoudiniStaticMesh ? HAC->StaticMeshMethod : EHoudiniStaticMeshMethod::RawMesh,
-					HAC->StaticMeshGenerationProperties,
-					OuterComponent,
-					true,  // bInTreatExistingMaterialsAsUpToDate
-					bInDestroyProxies
-				);  
-			}
-		}
-		else if (OutputType == EHoudiniOutputType::Instancer)
-		{
-			InstancerOutputs.Add(CurOutput);
-		}
-	}
+		if (!CurOutput || CurOutput->IsPendingKill())
+			continue;
 
-	// Rebuild instancers if we built any static meshes from proxies
-	if (bFoundProxies)
-	{
-		for (auto& CurOutput : InstancerOutputs)
-		{
+		if (CurOutput->GetType() == EHoudiniOutputType::Instancer)
 			FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(CurOutput, HAC->Outputs, OuterComponent);
-		}
 	}
-
-	return true;
 }
 
 //
@@ -818,6 +865,8 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 		return false;
 	}
 
+	FHoudiniPartAttributeCacheScope AttributeCacheScope;
+
 	// Get the AssetInfo
 	HAPI_AssetInfo AssetInfo;
 	FHoudiniApi::AssetInfo_Init(&AssetInfo);
@@ -1570,6 +1619,7 @@ FHoudiniOutputTranslator::UpdateChangedOutputs(UHoudiniAssetComponent* HAC)
 						// This is because CreateAllInstancersFromHoudiniOutput() actually reads the transform from HAPI
 						// Calling it on a HDA not yet instantiated causes a crash...
 						HAC->AssetState = EHoudiniAssetState::PreInstantiation;
+						HAC->MarkAsNeedProcessing();
 					}
 					else
 					{
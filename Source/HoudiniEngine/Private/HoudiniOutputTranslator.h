@@ -55,6 +55,13 @@ struct HOUDINIENGINE_API FHoudiniOutputTranslator
 	//
 	static bool BuildStaticMeshesOnHoudiniProxyMeshOutputs(UHoudiniAssetComponent* HAC, bool bInDestroyProxies=false);
 
+	// Builds the UStaticMeshes of a single mesh output's current proxies.
+	// Returns false if the output had no current proxies.
+	static bool BuildStaticMeshesOnHoudiniProxyMeshOutput(UHoudiniAssetComponent* HAC, UHoudiniOutput* InOutput, bool bInDestroyProxies=false);
+
+	// Rebuilds the HAC's instancers once its proxy meshes have been refined
+	static void UpdateInstancersAfterProxyMeshRefinement(UHoudiniAssetComponent* HAC);
+
 	//
 	static bool UpdateLoadedOutputs(UHoudiniAssetComponent* HAC);
 
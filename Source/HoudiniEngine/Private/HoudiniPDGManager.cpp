@@ -172,6 +172,7 @@ FHoudiniPDGManager::UpdatePDGAssetLink(UHoudiniPDGAssetLink* PDGAssetLink)
 		{
 			PDGAssetLink->LinkState = EPDGLinkState::Linking;
 			ParentHAC->AssetState = EHoudiniAssetState::PreInstantiation;
+			ParentHAC->MarkAsNeedProcessing();
 		}
 		else
 		{
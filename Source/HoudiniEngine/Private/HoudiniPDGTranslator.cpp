@@ -36,6 +36,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniPartAttributeCache.h"
 #include "HoudiniGeoImporter.h"
 #include "HoudiniPackageParams.h"
 #include "HoudiniOutput.h"
@@ -84,6 +85,9 @@ FHoudiniPDGTranslator::CreateAllResultObjectsForPDGWorkItem(
 	if (bResult)
 		bResult = UHoudiniGeoImporter::CookFileNode(FileNodeId);
 
+	// The file node has been cooked, its parts' attributes can be cached while building the outputs
+	FHoudiniPartAttributeCacheScope AttributeCacheScope;
+
 	// If the cook was successful, build outputs
 	if (bResult)
 	{
@@ -295,99 +299,103 @@ FHoudiniPDGTranslator::CreateAllResultObjectsFromPDGOutputs(
 	//bool bCreatedNewMaps = false;
 	UWorld* PersistentWorld = InOuterComponent->GetTypedOuter<UWorld>();
 	check(PersistentWorld);
-	
-	for (UHoudiniOutput* CurOutput : InOutputs)
+
 	{
-		const EHoudiniOutputType OutputType = CurOutput->GetType();
-		if (InOutputTypesToProcess.Num() > 0 && !InOutputTypesToProcess.Contains(OutputType))
+		// The static meshes of all the outputs are built together when this scope closes, once they have all been created
+		FHoudiniStaticMeshBuildBatchScope BuildBatchScope;
+		for (UHoudiniOutput* CurOutput : InOutputs)
 		{
-			continue;
-		}
-		switch (OutputType)
-		{
-			case EHoudiniOutputType::Mesh:
+			const EHoudiniOutputType OutputType = CurOutput->GetType();
+			if (InOutputTypesToProcess.Num() > 0 && !InOutputTypesToProcess.Contains(OutputType))
 			{
-				const bool bInDestroyProxies = false;
-				if (bInOnlyUseExistingAssets)
+				continue;
+			}
+			switch (OutputType)
+			{
+				case EHoudiniOutputType::Mesh:
 				{
-					const bool bInApplyGenericProperties = false;
-					TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> NewOutputObjects(CurOutput->GetOutputObjects());
-					FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
-						CurOutput,
-						InOuterComponent,
-						NewOutputObjects,
-						bInDestroyProxies,
-						bInApplyGenericProperties
-					);
+					const bool bInDestroyProxies = false;
+					if (bInOnlyUseExistingAssets)
+					{
+						const bool bInApplyGenericProperties = false;
+						TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> NewOutputObjects(CurOutput->GetOutputObjects());
+						FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
+							CurOutput,
+							InOuterComponent,
+							NewOutputObjects,
+							bInDestroyProxies,
+							bInApplyGenericProperties
+						);
+					}
+					else
+					{
+						FHoudiniStaticMeshGenerationProperties SMGP = FHoudiniEngineRuntimeUtils::GetDefaultStaticMeshGenerationProperties();
+						FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
+							CurOutput,
+							InPackageParams,
+							EHoudiniStaticMeshMethod::RawMesh,
+							SMGP,
+							InOuterComponent,
+							bInTreatExistingMaterialsAsUpToDate,
+							bInDestroyProxies
+						);
+					}
 				}
-				else
+				break;
+
+				case EHoudiniOutputType::Curve:
 				{
-					FHoudiniStaticMeshGenerationProperties SMGP = FHoudiniEngineRuntimeUtils::GetDefaultStaticMeshGenerationProperties();
-					FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
-						CurOutput,
-						InPackageParams,
-						EHoudiniStaticMeshMethod::RawMesh,
-						SMGP,
-						InOuterComponent,
-						bInTreatExistingMaterialsAsUpToDate,
-						bInDestroyProxies
-					);
+					// Output curve
+					FHoudiniSplineTranslator::CreateAllSplinesFromHoudiniOutput(CurOutput, InOuterComponent);
+					break;
 				}
-			}
-			break;
 
-			case EHoudiniOutputType::Curve:
-			{
-				// Output curve
-				FHoudiniSplineTranslator::CreateAllSplinesFromHoudiniOutput(CurOutput, InOuterComponent);
+				case EHoudiniOutputType::Instancer:
+				{
+					InstancerOutputs.Add(CurOutput);
+				}
 				break;
-			}
-
-			case EHoudiniOutputType::Instancer:
-			{
-				InstancerOutputs.Add(CurOutput);
-			}
-			break;
 
-			case EHoudiniOutputType::Landscape:
-			{
-				TArray<ALandscapeProxy*> EmptyInputLandscapes;
-				// Retrieve the topnet parent to which Sharedlandscapes will be attached.
-				AActor* WorkItemActor = InOuterComponent->GetTypedOuter<AActor>();
-				USceneComponent* TopnetParent = nullptr;
-				if (WorkItemActor)
+				case EHoudiniOutputType::Landscape:
 				{
-					AActor* TopnetParentActor = WorkItemActor->GetAttachParentActor();
-					if (TopnetParentActor)
+					TArray<ALandscapeProxy*> EmptyInputLandscapes;
+					// Retrieve the topnet parent to which Sharedlandscapes will be attached.
+					AActor* WorkItemActor = InOuterComponent->GetTypedOuter<AActor>();
+					USceneComponent* TopnetParent = nullptr;
+					if (WorkItemActor)
 					{
-						TopnetParent = TopnetParentActor->GetRootComponent();
+						AActor* TopnetParentActor = WorkItemActor->GetAttachParentActor();
+						if (TopnetParentActor)
+						{
+							TopnetParent = TopnetParentActor->GetRootComponent();
+						}
 					}
+					TArray<TWeakObjectPtr<AActor>> CreatedUntrackedOutputs;
+
+					FHoudiniLandscapeTranslator::CreateLandscape(
+						CurOutput,
+						CreatedUntrackedOutputs,
+						EmptyInputLandscapes,
+						EmptyInputLandscapes,
+						TopnetParent,
+						TEXT("{hda_actor_name}_{pdg_topnet_name}_"),
+						PersistentWorld,
+						LandscapeLayerGlobalMinimums,
+						LandscapeLayerGlobalMaximums,
+						InPackageParams,
+						//bCreatedNewMaps,
+						CreatedPackages);
+					// Attach any landscape actors to InOuterComponent
+					LandscapeOutputs.Add(CurOutput);
 				}
-				TArray<TWeakObjectPtr<AActor>> CreatedUntrackedOutputs;
-
-				FHoudiniLandscapeTranslator::CreateLandscape(
-					CurOutput,
-					CreatedUntrackedOutputs,
-					EmptyInputLandscapes,
-					EmptyInputLandscapes,
-					TopnetParent,
-					TEXT("{hda_actor_name}_{pdg_topnet_name}_"),
-					PersistentWorld,
-					LandscapeLayerGlobalMinimums,
-					LandscapeLayerGlobalMaximums,
-					InPackageParams,
-					//bCreatedNewMaps,
-					CreatedPackages);
-				// Attach any landscape actors to InOuterComponent
-				LandscapeOutputs.Add(CurOutput);
-			}
-			break;
+				break;
 
-			default:
-			{
-				HOUDINI_LOG_WARNING(TEXT("[FTOPWorkResultObject::UpdateResultOutputs]: Unsupported output type: %s"), *UHoudiniOutput::OutputTypeToString(OutputType));
+				default:
+				{
+					HOUDINI_LOG_WARNING(TEXT("[FTOPWorkResultObject::UpdateResultOutputs]: Unsupported output type: %s"), *UHoudiniOutput::OutputTypeToString(OutputType));
+				}
+				break;
 			}
-			break;
 		}
 	}
 
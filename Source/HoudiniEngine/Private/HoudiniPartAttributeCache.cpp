@@ -0,0 +1,213 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniPartAttributeCache.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+TMap<TPair<HAPI_NodeId, HAPI_PartId>, FHoudiniPartAttributeCache::FPartAttributes>
+FHoudiniPartAttributeCache::CachedParts;
+
+int32
+FHoudiniPartAttributeCache::CachingScopeCount = 0;
+
+void
+FHoudiniPartAttributeCache::BeginCaching()
+{
+	if (!IsInGameThread())
+		return;
+
+	CachingScopeCount++;
+}
+
+void
+FHoudiniPartAttributeCache::EndCaching()
+{
+	if (!IsInGameThread())
+		return;
+
+	CachingScopeCount--;
+	if (CachingScopeCount <= 0)
+	{
+		CachingScopeCount = 0;
+		Empty();
+	}
+}
+
+bool
+FHoudiniPartAttributeCache::IsCaching()
+{
+	return CachingScopeCount > 0 && IsInGameThread();
+}
+
+void
+FHoudiniPartAttributeCache::Empty()
+{
+	if (!IsInGameThread())
+		return;
+
+	CachedParts.Empty();
+}
+
+FHoudiniPartAttributeCache::FPartAttributes*
+FHoudiniPartAttributeCache::GetPartAttributes(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId)
+{
+	if (!IsCaching())
+		return nullptr;
+
+	const TPair<HAPI_NodeId, HAPI_PartId> PartKey(InGeoId, InPartId);
+	FPartAttributes* FoundPart = CachedParts.Find(PartKey);
+	if (FoundPart)
+		return FoundPart;
+
+	// Get the part info to get the attribute count per owner
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
+		FHoudiniEngine::Get().GetSession(), InGeoId, InPartId, &PartInfo))
+		return nullptr;
+
+	FPartAttributes PartAttributes;
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+	{
+		int32 AttribCount = PartInfo.attributeCounts[OwnerIdx];
+		if (AttribCount <= 0)
+			continue;
+
+		// Get all the attribute names for that owner
+		TArray<HAPI_StringHandle> AttribNameSHArray;
+		AttribNameSHArray.SetNum(AttribCount);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeNames(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoId, InPartId, (HAPI_AttributeOwner)OwnerIdx,
+			AttribNameSHArray.GetData(), AttribCount))
+			return nullptr;
+
+		TArray<FString> AttribNames;
+		if (!FHoudiniEngineString::SHArrayToFStringArray(AttribNameSHArray, AttribNames))
+			return nullptr;
+
+		// The attribute infos will be fetched when needed
+		PartAttributes.Attributes[OwnerIdx].SetNum(AttribNames.Num());
+		for (int32 Idx = 0; Idx < AttribNames.Num(); Idx++)
+		{
+			FCachedAttribute& CurrentAttribute = PartAttributes.Attributes[OwnerIdx][Idx];
+			CurrentAttribute.Name = AttribNames[Idx];
+			FHoudiniApi::AttributeInfo_Init(&CurrentAttribute.Info);
+		}
+	}
+
+	return &CachedParts.Add(PartKey, MoveTemp(PartAttributes));
+}
+
+bool
+FHoudiniPartAttributeCache::FindAttributeInfo(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char * InAttribName,
+	const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeInfo& OutAttributeInfo)
+{
+	if (!InAttribName)
+		return false;
+
+	FPartAttributes* PartAttributes = GetPartAttributes(InGeoId, InPartId);
+	if (!PartAttributes)
+		return false;
+
+	FHoudiniApi::AttributeInfo_Init(&OutAttributeInfo);
+	OutAttributeInfo.exists = false;
+
+	const FString AttribName = UTF8_TO_TCHAR(InAttribName);
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+	{
+		if (InOwner != HAPI_ATTROWNER_INVALID && InOwner != (HAPI_AttributeOwner)OwnerIdx)
+			continue;
+
+		FCachedAttribute* FoundAttribute = PartAttributes->Attributes[OwnerIdx].FindByPredicate(
+			[&AttribName](const FCachedAttribute& Attribute) { return Attribute.Name.Equals(AttribName, ESearchCase::CaseSensitive); });
+		if (!FoundAttribute)
+			continue;
+
+		if (!FoundAttribute->bInfoFetched)
+		{
+			// First access to this attribute, fetch its info
+			// On failure, let the caller query HAPI itself to handle the error
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo(
+				FHoudiniEngine::Get().GetSession(),
+				InGeoId, InPartId, InAttribName,
+				(HAPI_AttributeOwner)OwnerIdx, &FoundAttribute->Info))
+				return false;
+
+			FoundAttribute->bInfoFetched = true;
+		}
+
+		if (!FoundAttribute->Info.exists)
+			continue;
+
+		OutAttributeInfo = FoundAttribute->Info;
+		return true;
+	}
+
+	// The attribute doesn't exist
+	return true;
+}
+
+bool
+FHoudiniPartAttributeCache::GetAttributeNames(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const HAPI_AttributeOwner& InOwner,
+	TArray<FString>& OutAttributeNames)
+{
+	if (InOwner < 0 || InOwner >= HAPI_ATTROWNER_MAX)
+		return false;
+
+	FPartAttributes* PartAttributes = GetPartAttributes(InGeoId, InPartId);
+	if (!PartAttributes)
+		return false;
+
+	OutAttributeNames.Empty(PartAttributes->Attributes[InOwner].Num());
+	for (const FCachedAttribute& CurrentAttribute : PartAttributes->Attributes[InOwner])
+		OutAttributeNames.Add(CurrentAttribute.Name);
+
+	return true;
+}
+
+FHoudiniPartAttributeCacheScope::FHoudiniPartAttributeCacheScope()
+{
+	FHoudiniPartAttributeCache::BeginCaching();
+	FHoudiniEngineString::BeginCaching();
+}
+
+FHoudiniPartAttributeCacheScope::~FHoudiniPartAttributeCacheScope()
+{
+	FHoudiniEngineString::EndCaching();
+	FHoudiniPartAttributeCache::EndCaching();
+}
@@ -0,0 +1,108 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "CoreMinimal.h"
+
+// Caches the attribute names and infos of the parts being translated, so the attribute helpers
+// in FHoudiniEngineUtils don't need to query HAPI for every owner on every attribute lookup.
+// All attribute names of a part are retrieved (via GetAttributeNames) the first time the part is accessed,
+// this allows answering lookups for non-existing attributes without any HAPI call.
+// Attribute infos are then fetched once, the first time the attribute is accessed.
+//
+// The cache is only enabled between BeginCaching()/EndCaching() (see FHoudiniPartAttributeCacheScope),
+// this should only be done when the parts' geometry can't change (ie, when translating the outputs of a cook).
+// The cache is emptied when the outermost scope ends, and is only used on the game thread.
+class HOUDINIENGINE_API FHoudiniPartAttributeCache
+{
+	public:
+
+		// Enables the cache, calls can be nested.
+		static void BeginCaching();
+
+		// Disables the cache and empties it when the outermost caching scope ends.
+		static void EndCaching();
+
+		// Indicates if the cache can currently be used.
+		static bool IsCaching();
+
+		// Removes all the cached data, needs to be called when a node is cooked while caching.
+		static void Empty();
+
+		// Look for an attribute on the given part.
+		// If InOwner is HAPI_ATTROWNER_INVALID, the owners are checked in order (vertex, point, prim, detail).
+		// Returns false if the cache couldn't be used, HAPI must then be queried directly.
+		// If the cache could be used, OutAttributeInfo.exists indicates if the attribute was found.
+		static bool FindAttributeInfo(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char * InAttribName,
+			const HAPI_AttributeOwner& InOwner,
+			HAPI_AttributeInfo& OutAttributeInfo);
+
+		// Returns the names of all the attributes of the given owner on a part.
+		// Returns false if the cache couldn't be used, HAPI must then be queried directly.
+		static bool GetAttributeNames(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const HAPI_AttributeOwner& InOwner,
+			TArray<FString>& OutAttributeNames);
+
+	private:
+
+		struct FCachedAttribute
+		{
+			FString Name;
+			bool bInfoFetched = false;
+			HAPI_AttributeInfo Info;
+		};
+
+		struct FPartAttributes
+		{
+			// Attributes per owner. Arrays are used instead of maps as
+			// attribute names are case sensitive and parts only have a few attributes.
+			TArray<FCachedAttribute> Attributes[HAPI_ATTROWNER_MAX];
+		};
+
+		// Returns the cached attributes for a part, retrieves the part's attribute names if needed.
+		// Returns null if the cache is disabled or if the names couldn't be retrieved.
+		static FPartAttributes* GetPartAttributes(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId);
+
+		// Cached attributes, per Geo/Part Id
+		static TMap<TPair<HAPI_NodeId, HAPI_PartId>, FPartAttributes> CachedParts;
+
+		// Number of active caching scopes.
+		static int32 CachingScopeCount;
+};
+
+// Enables FHoudiniPartAttributeCache and FHoudiniEngineString's string cache for the lifetime of this object.
+struct HOUDINIENGINE_API FHoudiniPartAttributeCacheScope
+{
+	FHoudiniPartAttributeCacheScope();
+	~FHoudiniPartAttributeCacheScope();
+};
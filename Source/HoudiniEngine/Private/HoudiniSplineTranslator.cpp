@@ -34,6 +34,7 @@
 #include "HoudiniSplineComponent.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniEngineRuntimeUtils.h"
 
 #include "HoudiniGeoPartObject.h"
 #include "Components/SplineComponent.h"
@@ -224,6 +225,9 @@ FHoudiniSplineTranslator::HapiUpdateNodeForHoudiniSplineComponent(UHoudiniSpline
 	if (!HoudiniSplineComponent || HoudiniSplineComponent->IsPendingKill())
 		return true;
 
+	// The curve node lives in the session of the HAC the spline belongs to
+	FHoudiniEngineSessionScope SessionScope(FHoudiniEngineRuntimeUtils::GetOwnerSessionIndex(HoudiniSplineComponent));
+
 	TArray<FVector> PositionArray;
 	TArray<FQuat> RotationArray;
 	TArray<FVector> Scales3dArray;
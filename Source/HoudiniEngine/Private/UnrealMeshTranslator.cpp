@@ -28,7 +28,10 @@
 
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineString.h"
 #include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniInputNodeCache.h"
+#include "HoudiniRuntimeSettings.h"
 
 #include "RawMesh.h"
 #include "MeshDescription.h"
@@ -41,11 +44,116 @@
 #include "Materials/MaterialInterface.h"
 #include "MeshAttributes.h"
 #include "StaticMeshAttributes.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopeExit.h"
 
 #if WITH_EDITOR
 	#include "EditorFramework/AssetImportData.h"
 #endif
 
+// Number of vertex instances processed by each ParallelFor batch when building the input mesh buffers
+#define HOUDINI_INPUT_MESH_BATCH_SIZE 16384
+
+// Runs InBody(Start, End) on batches of the [0, InNum[ range, in parallel if there's more than one batch
+template<typename TBody>
+static void
+ParallelForInputMeshBatches(const int32& InNum, const TBody& InBody)
+{
+	const int32 NumBatches = FMath::DivideAndRoundUp(InNum, HOUDINI_INPUT_MESH_BATCH_SIZE);
+	ParallelFor(NumBatches, [&](int32 BatchIdx)
+	{
+		const int32 Start = BatchIdx * HOUDINI_INPUT_MESH_BATCH_SIZE;
+		const int32 End = FMath::Min(Start + HOUDINI_INPUT_MESH_BATCH_SIZE, InNum);
+		InBody(Start, End);
+	}, NumBatches <= 1);
+}
+
+// Hashes the streams of a LOD that CreateInputNodeForStaticMeshLODResources() can upload on their own (the materials are hashed there),
+// and everything else it uploads in the geometry hash. The hashes are invalid if the mesh's data isn't accessible on the CPU.
+static FHoudiniMeshStreamHashes
+GetStaticMeshLODStreamHashes(
+	const FStaticMeshLODResources& LODResources,
+	const TArray<uint32>& HoudiniVertexToUEVertexIdx,
+	const FColorVertexBuffer* ColorVertexBuffer,
+	const int32& InLODIndex,
+	const bool& bAddLODGroups,
+	UStaticMesh* StaticMesh,
+	UStaticMeshComponent* StaticMeshComponent)
+{
+	FHoudiniMeshStreamHashes Hashes;
+
+	const FStaticMeshVertexBuffer& StaticMeshVertexBuffer = LODResources.VertexBuffers.StaticMeshVertexBuffer;
+	const FPositionVertexBuffer& PositionVertexBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
+	if (!StaticMeshVertexBuffer.GetTangentData() || !StaticMeshVertexBuffer.GetTexCoordData() || PositionVertexBuffer.GetNumVertices() == 0)
+		return Hashes;
+
+	// Points and triangles
+	uint32 Crc = 0;
+	for (uint32 VertexIdx = 0; VertexIdx < PositionVertexBuffer.GetNumVertices(); ++VertexIdx)
+		Crc = FCrc::MemCrc32(&PositionVertexBuffer.VertexPosition(VertexIdx), sizeof(FVector), Crc);
+
+	Crc = FCrc::MemCrc32(HoudiniVertexToUEVertexIdx.GetData(), HoudiniVertexToUEVertexIdx.Num() * sizeof(uint32), Crc);
+
+	const FVector BuildScaleVector = StaticMesh->GetSourceModel(InLODIndex).BuildSettings.BuildScale3D;
+	Crc = FCrc::MemCrc32(&BuildScaleVector, sizeof(FVector), Crc);
+
+	// Attributes that can't be uploaded on their own: which streams exist and the mesh/LOD data
+	const uint32 NumUVLayers = StaticMeshVertexBuffer.GetNumTexCoords();
+	const int32 Flags[] = {
+		(int32)NumUVLayers, ColorVertexBuffer ? 1 : 0, InLODIndex, bAddLODGroups ? 1 : 0,
+		StaticMesh->bAutoComputeLODScreenSize ? 1 : 0, StaticMesh->LightMapResolution };
+	Crc = FCrc::MemCrc32(Flags, sizeof(Flags), Crc);
+
+	const float ScreenSize = StaticMesh->GetSourceModel(InLODIndex).ScreenSize.Default;
+	Crc = FCrc::MemCrc32(&ScreenSize, sizeof(float), Crc);
+	Crc = FCrc::StrCrc32(*StaticMesh->GetPathName(), Crc);
+
+	if (UAssetImportData* ImportData = StaticMesh->AssetImportData)
+	{
+		for (const auto& SourceFile : ImportData->SourceData.SourceFiles)
+		{
+			Crc = FCrc::StrCrc32(*SourceFile.RelativeFilename, Crc);
+			break;
+		}
+	}
+
+	if (StaticMeshComponent && !StaticMeshComponent->IsPendingKill())
+	{
+		for (const FName& Tag : StaticMeshComponent->ComponentTags)
+			Crc = FCrc::StrCrc32(*Tag.ToString(), Crc);
+
+		AActor* ParentActor = StaticMeshComponent->GetOwner();
+		if (ParentActor && !ParentActor->IsPendingKill())
+		{
+			for (const FName& Tag : ParentActor->Tags)
+				Crc = FCrc::StrCrc32(*Tag.ToString(), Crc);
+
+			Crc = FCrc::StrCrc32(*ParentActor->GetPathName(), Crc);
+			if (ParentActor->GetLevel())
+				Crc = FCrc::StrCrc32(*ParentActor->GetLevel()->GetPathName(), Crc);
+		}
+	}
+
+	Hashes.Geometry = Crc;
+
+	// Normals, tangents and binormals
+	Hashes.Normals = FCrc::MemCrc32(StaticMeshVertexBuffer.GetTangentData(), StaticMeshVertexBuffer.GetTangentSize());
+
+	// UVs
+	Hashes.UVs = FCrc::MemCrc32(StaticMeshVertexBuffer.GetTexCoordData(), StaticMeshVertexBuffer.GetTexCoordSize());
+
+	// Colors and alpha
+	if (ColorVertexBuffer)
+	{
+		for (uint32 VertexIdx = 0; VertexIdx < ColorVertexBuffer->GetNumVertices(); ++VertexIdx)
+			Hashes.Colors = FCrc::MemCrc32(&ColorVertexBuffer->VertexColor(VertexIdx), sizeof(FColor), Hashes.Colors);
+	}
+
+	Hashes.bValid = true;
+	return Hashes;
+}
+
 bool
 FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 	UStaticMesh* StaticMesh,
@@ -54,15 +162,13 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 	UStaticMeshComponent* StaticMeshComponent /* = nullptr */,
 	const bool& ExportAllLODs /* = false */,
 	const bool& ExportSockets /* = false */,
-	const bool& ExportColliders /* = false */)
+	const bool& ExportColliders /* = false */,
+	FString* InOutUploadedDataKey /* = nullptr */)
 {
 	// If we don't have a static mesh there's nothing to do.
 	if (!StaticMesh || StaticMesh->IsPendingKill())
 		return false;
 
-	// Node ID for the newly created node
-	HAPI_NodeId NewNodeId = -1;
-
 	// Export sockets if there are some
 	bool DoExportSockets = ExportSockets && (StaticMesh->Sockets.Num() > 0);
 
@@ -84,34 +190,92 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 		}
 	}
 
-	// We need to use a merge node if we export lods OR sockets
-	bool UseMergeNode = DoExportLODs || DoExportSockets || DoExportColliders;
-	if (UseMergeNode)
+	// Send the materials as a table and per face indices if needed
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const bool bMaterialsAsIndices = HoudiniRuntimeSettings && HoudiniRuntimeSettings->MarshallingMaterialsAsIndices;
+
+	// Identifies the data uploaded for this mesh/component and export options
+	const FString UploadedDataKey = FHoudiniInputNodeCache::GetStaticMeshKey(
+		StaticMesh, StaticMeshComponent, DoExportLODs, DoExportSockets, DoExportColliders, bMaterialsAsIndices);
+
+	// If we know what was uploaded to the existing input node, only upload what has changed.
+	// (the key is only valid for the node it was uploaded to)
+	if (InOutUploadedDataKey && !UploadedDataKey.IsEmpty()
+		&& InputNodeId >= 0 && InOutUploadedDataKey->Equals(GetInputNodeDataKey(InputNodeId, *InOutUploadedDataKey))
+		&& FHoudiniEngineUtils::IsHoudiniNodeValid(InputNodeId))
 	{
-		// TODO:
-		// What if OutInputNodeId already exists? 
-		// Delete previous merge?/input?
+		bool bUpdated = false;
+		if (!UpdateInputNodeForStaticMesh(
+			StaticMesh, InputNodeId, StaticMeshComponent, UploadedDataKey, *InOutUploadedDataKey,
+			DoExportLODs, DoExportSockets, DoExportColliders, bMaterialsAsIndices, bUpdated))
+			return false;
 
-		// Create a merge SOP asset. This will be our "InputNodeId"
-		// as all the different LOD meshes and sockets will be plugged into it
-		HOUDINI_CHECK_ERROR_RETURN(	FHoudiniEngineUtils::CreateNode(
-			-1, TEXT("SOP/merge"), InputNodeName, true, &NewNodeId), false);
+		if (bUpdated)
+		{
+			*InOutUploadedDataKey = GetInputNodeDataKey(InputNodeId, UploadedDataKey);
+			return true;
+		}
 	}
-	else
+
+	// Meshes exported without a component only depend on the mesh and the export options,
+	// so their input node can be shared by all the inputs using them instead of being uploaded again.
+	// Component exports have per-component data (materials/vertex colors overrides, tags, actor attributes...)
+	FString SharedNodeKey;
+	if (!StaticMeshComponent)
+		SharedNodeKey = UploadedDataKey;
+
+	// Node ID for the newly created node
+	HAPI_NodeId NewNodeId = -1;
+	bool bSuccess = true;
+	if (!SharedNodeKey.IsEmpty())
 	{
-		// No LODs/Sockets, we just need a single input node
-		// If InputNodeId is invalid, we need to create an input node.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateInputNode(
-			FHoudiniEngine::Get().GetSession(), &NewNodeId, TCHAR_TO_ANSI(*InputNodeName)), false);
+		HAPI_NodeId SharedNodeId = -1;
+		if (!FHoudiniInputNodeCache::FindNode(SharedNodeKey, SharedNodeId))
+		{
+			if (!CreateInputNodeForStaticMeshData(
+				StaticMesh, SharedNodeId, StaticMesh->GetName() + TEXT("_shared"), nullptr,
+				DoExportLODs, DoExportSockets, DoExportColliders, bMaterialsAsIndices))
+			{
+				// Don't keep a partially uploaded mesh around
+				if (SharedNodeId >= 0)
+				{
+					HAPI_NodeId SharedOBJNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(SharedNodeId);
+					FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), SharedNodeId);
+					FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), SharedOBJNodeId);
+				}
+				return false;
+			}
 
-		if (!FHoudiniEngineUtils::HapiCookNode(NewNodeId, nullptr, true))
+			FHoudiniInputNodeCache::AddNode(SharedNodeKey, SharedNodeId);
+		}
+
+		// Each input object merges the shared node in its own OBJ node, so it can still have its own transform
+		HAPI_StringHandle SharedNodePathSH = -1;
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetNodePath(
+			FHoudiniEngine::Get().GetSession(), SharedNodeId, -1, &SharedNodePathSH), false);
+
+		FString SharedNodePath;
+		if (!FHoudiniEngineString::ToFString(SharedNodePathSH, SharedNodePath))
 			return false;
 
-		/*
-		HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
-			FHoudiniEngine::Get().GetSession(), NewNodeId, &CookOptions), false);
-		*/
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::CreateNode(
+			-1, TEXT("SOP/object_merge"), InputNodeName, false, &NewNodeId), false);
+
+		HAPI_ParmId ObjPathParmId = FHoudiniEngineUtils::HapiFindParameterByNameOrTag(NewNodeId, "objpath1");
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmStringValue(
+			FHoudiniEngine::Get().GetSession(), NewNodeId, TCHAR_TO_UTF8(*SharedNodePath), ObjPathParmId, 0), false);
+
+		// The shared geometry is merged as is, the transform is applied by our OBJ node
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmIntValue(
+			FHoudiniEngine::Get().GetSession(), NewNodeId, "xformtype", 0, 0), false);
+
+		FHoudiniInputNodeCache::AddUser(SharedNodeKey, NewNodeId);
+	}
+	else
+	{
+		bSuccess = CreateInputNodeForStaticMeshData(
+			StaticMesh, NewNodeId, InputNodeName, StaticMeshComponent,
+			DoExportLODs, DoExportSockets, DoExportColliders, bMaterialsAsIndices);
 	}
 
 	// Check if we have a valid id for this new input asset.
@@ -122,12 +286,13 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 
 	// Update our input NodeId
 	InputNodeId = NewNodeId;
-	// Get our parent OBJ NodeID
-	HAPI_NodeId InputObjectNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(NewNodeId);
 
 	// We have now created a valid new input node, delete the previous one
 	if (PreviousInputNodeId >= 0)
 	{
+		// The previous node doesn't use its shared node anymore
+		FHoudiniInputNodeCache::RemoveNode(PreviousInputNodeId);
+
 		// Get the parent OBJ node ID before deleting!
 		HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(PreviousInputNodeId);
 
@@ -144,19 +309,184 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 		}		
 	}
 
-	// TODO:
-	// Setting for lightmap resolution?
-	//const uint8 ExportMethod = 0; // Raw mesh
-	//const uint8 ExportMethod = 1; // Mesh description
-	const uint8 ExportMethod = 2; // LODResources (render mesh)
-	//bool bExportViaRawMesh = false;
+	if (InOutUploadedDataKey)
+		*InOutUploadedDataKey = (bSuccess && !UploadedDataKey.IsEmpty()) ? GetInputNodeDataKey(InputNodeId, UploadedDataKey) : FString();
+
+	return bSuccess;
+}
+
+FString
+FUnrealMeshTranslator::GetInputNodeDataKey(const HAPI_NodeId& InNodeId, const FString& InDataKey)
+{
+	// Strip the previous node id if any
+	FString DataKey = InDataKey;
+	int32 SeparatorIndex = INDEX_NONE;
+	if (DataKey.FindChar(TEXT('@'), SeparatorIndex))
+		DataKey.RightChopInline(SeparatorIndex + 1, false);
+
+	return FString::FromInt(InNodeId) + TEXT("@") + DataKey;
+}
+
+bool
+FUnrealMeshTranslator::UpdateInputNodeForStaticMesh(
+	UStaticMesh* StaticMesh,
+	const HAPI_NodeId& InputNodeId,
+	UStaticMeshComponent* StaticMeshComponent,
+	const FString& InDataKey,
+	const FString& InPreviousInputNodeDataKey,
+	const bool& DoExportLODs,
+	const bool& DoExportSockets,
+	const bool& DoExportColliders,
+	const bool& bMaterialsAsIndices,
+	bool& bOutUpdated)
+{
+	bOutUpdated = false;
+
+	FString PreviousDataKey;
+	if (!InPreviousInputNodeDataKey.Split(TEXT("@"), nullptr, &PreviousDataKey))
+		return true;
+
+	// Nothing to upload if the data hasn't changed, transform changes are handled by the callers
+	if (PreviousDataKey.Equals(InDataKey))
+	{
+		bOutUpdated = true;
+		return true;
+	}
+
+	// Only the data of the same mesh with the same export options can be updated in place
+	if (!FHoudiniInputNodeCache::HaveSameSource(PreviousDataKey, InDataKey))
+		return true;
+
+	if (StaticMeshComponent)
+	{
+		// The changed streams are uploaded, but we keep the nodes and their downstream connections
+		return UpdateStaticMeshDataLODs(
+			StaticMesh, InputNodeId, StaticMeshComponent,
+			DoExportLODs, DoExportSockets, DoExportColliders, bMaterialsAsIndices, bOutUpdated);
+	}
+
+	// Find the shared node merged by our input node
+	FString SharedNodeKey;
+	HAPI_NodeId SharedNodeId = -1;
+	if (!FHoudiniInputNodeCache::FindUserNode(InputNodeId, SharedNodeKey, SharedNodeId))
+		return true;
+
+	// All the inputs merging that shared node use the same mesh, so they all want its new data.
+	// Another of these inputs might have updated it already.
+	if (!SharedNodeKey.Equals(InDataKey))
+	{
+		// If another input has already uploaded the new data to a new shared node, merge that one instead
+		HAPI_NodeId ExistingNodeId = -1;
+		if (FHoudiniInputNodeCache::FindNode(InDataKey, ExistingNodeId))
+			return true;
+
+		bool bSharedNodeUpdated = false;
+		if (!UpdateStaticMeshDataLODs(
+			StaticMesh, SharedNodeId, nullptr,
+			DoExportLODs, DoExportSockets, DoExportColliders, bMaterialsAsIndices, bSharedNodeUpdated))
+			return false;
+
+		if (!bSharedNodeUpdated)
+			return true;
+
+		FHoudiniInputNodeCache::UpdateNodeKey(SharedNodeKey, InDataKey);
+	}
+
+	bOutUpdated = true;
+	return true;
+}
+
+bool
+FUnrealMeshTranslator::UpdateStaticMeshDataLODs(
+	UStaticMesh* StaticMesh,
+	const HAPI_NodeId& InNodeId,
+	UStaticMeshComponent* StaticMeshComponent,
+	const bool& DoExportLODs,
+	const bool& DoExportSockets,
+	const bool& DoExportColliders,
+	const bool& bMaterialsAsIndices,
+	bool& bOutUpdated)
+{
+	bOutUpdated = false;
+
+	// The LODs/sockets/colliders nodes need to be rebuilt if they don't match the mesh anymore
+	FHoudiniInputNodeCache::FUploadedStaticMesh* UploadedMesh = FHoudiniInputNodeCache::FindUploadedStaticMesh(InNodeId);
+	if (!UploadedMesh || UploadedMesh->NetworkHash != FHoudiniInputNodeCache::GetStaticMeshNetworkHash(
+		StaticMesh, DoExportLODs, DoExportSockets, DoExportColliders))
+		return true;
+
+	for (int32 LODIndex = 0; LODIndex < UploadedMesh->LODNodeIds.Num(); LODIndex++)
+	{
+		const HAPI_NodeId& LODNodeId = UploadedMesh->LODNodeIds[LODIndex];
+		if (!FHoudiniEngineUtils::IsHoudiniNodeValid(LODNodeId))
+			return true;
+
+		// Only the streams that changed are uploaded to the LOD node
+		if (!CreateInputNodeForStaticMeshLOD(
+			LODNodeId, StaticMesh, LODIndex, DoExportLODs, StaticMeshComponent,
+			bMaterialsAsIndices, &UploadedMesh->LODStreams[LODIndex]))
+			return false;
+	}
+
+	bOutUpdated = true;
+	return true;
+}
+
+bool
+FUnrealMeshTranslator::CreateInputNodeForStaticMeshData(
+	UStaticMesh* StaticMesh,
+	HAPI_NodeId& OutNewNodeId,
+	const FString& InputNodeName,
+	UStaticMeshComponent* StaticMeshComponent,
+	const bool& DoExportLODs,
+	const bool& DoExportSockets,
+	const bool& DoExportColliders,
+	const bool& bMaterialsAsIndices)
+{
+	HAPI_NodeId& NewNodeId = OutNewNodeId;
+
+	// We need to use a merge node if we export lods OR sockets
+	// (or if the LODs' materials need to be converted back from indices)
+	bool UseMergeNode = DoExportLODs || DoExportSockets || DoExportColliders || bMaterialsAsIndices;
+	if (UseMergeNode)
+	{
+		// Create a merge SOP asset. This will be our "InputNodeId"
+		// as all the different LOD meshes and sockets will be plugged into it
+		HOUDINI_CHECK_ERROR_RETURN(	FHoudiniEngineUtils::CreateNode(
+			-1, TEXT("SOP/merge"), InputNodeName, true, &NewNodeId), false);
+	}
+	else
+	{
+		// No LODs/Sockets, we just need a single input node
+		// If InputNodeId is invalid, we need to create an input node.
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateInputNode(
+			FHoudiniEngine::Get().GetSession(), &NewNodeId, TCHAR_TO_ANSI(*InputNodeName)), false);
+
+		if (!FHoudiniEngineUtils::HapiCookNode(NewNodeId, nullptr, true))
+			return false;
+
+		/*
+		HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
+			FHoudiniEngine::Get().GetSession(), NewNodeId, &CookOptions), false);
+		*/
+	}
+
+	// Check if we have a valid id for this new input asset.
+	if (!FHoudiniEngineUtils::IsHoudiniNodeValid(NewNodeId))
+		return false;
+
+	// Get our parent OBJ NodeID
+	HAPI_NodeId InputObjectNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(NewNodeId);
+
+	// Keep track of the LOD nodes, so the mesh's data can be updated in place later
+	FHoudiniInputNodeCache::FUploadedStaticMesh UploadedMesh;
+	UploadedMesh.NetworkHash = FHoudiniInputNodeCache::GetStaticMeshNetworkHash(
+		StaticMesh, DoExportLODs, DoExportSockets, DoExportColliders);
 
 	int32 NumLODsToExport = DoExportLODs ? StaticMesh->GetNumLODs() : 1;
 	for (int32 LODIndex = 0; LODIndex < NumLODsToExport; LODIndex++)
 	{
-		// Grab the LOD level.
-		FStaticMeshSourceModel & SrcModel = StaticMesh->GetSourceModel(LODIndex);
-
 		// If we're using a merge node, we need to create a new input null
 		HAPI_NodeId CurrentLODNodeId = -1;
 		if (UseMergeNode)
@@ -178,69 +508,25 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 			CurrentLODNodeId = NewNodeId;
 		}
 
-		// Either export the current LOD Mesh by using RawMEsh or MeshDescription (legacy)
-		FMeshDescription* MeshDesc = nullptr;
-		// if (!bExportViaRawMesh)
-		if (ExportMethod == 1)
-		{
-			// This will either fetch the mesh description that is cached on the SrcModel
-			// or load it from bulk data / DDC once
-			if (SrcModel.MeshDescription.IsValid())
-			{
-				MeshDesc = SrcModel.MeshDescription.Get();
-			}
-			else
-			{
-				const double StartTime = FPlatformTime::Seconds();
-				MeshDesc = StaticMesh->GetMeshDescription(LODIndex);
-				HOUDINI_LOG_MESSAGE(TEXT("StaticMesh->GetMeshDescription completed in %.4f seconds"), FPlatformTime::Seconds() - StartTime);
-			}
-		}
+		FHoudiniMeshStreamHashes& LODStreams = UploadedMesh.LODStreams.AddDefaulted_GetRef();
+		UploadedMesh.LODNodeIds.Add(CurrentLODNodeId);
 
-		bool bMeshSuccess = false;
-		if (ExportMethod == 1 && MeshDesc)
-		{
-			// Convert the Mesh using FMeshDescription
-			const double StartTime = FPlatformTime::Seconds();
-			bMeshSuccess = FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
-				CurrentLODNodeId,
-				*MeshDesc,
-				LODIndex,
-				DoExportLODs,
-				StaticMesh,
-				StaticMeshComponent);
-			HOUDINI_LOG_MESSAGE(TEXT("FUnrealMeshTranslator::CreateInputNodeForMeshDescription completed in %.4f seconds"), FPlatformTime::Seconds() - StartTime);
-		}
-		else if (ExportMethod == 2)
-		{
-			// Convert the LOD Mesh using FStaticMeshLODResources
-			const double StartTime = FPlatformTime::Seconds();
-			bMeshSuccess = FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
-				CurrentLODNodeId,
-				StaticMesh->GetLODForExport(LODIndex),
-				LODIndex,
-				DoExportLODs,
-				StaticMesh,
-				StaticMeshComponent);
-			HOUDINI_LOG_MESSAGE(TEXT("FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources completed in %.4f seconds"), FPlatformTime::Seconds() - StartTime);
-		}
-		else
-		{
-			// Convert the LOD Mesh using FRawMesh
-			const double StartTime = FPlatformTime::Seconds();
-			bMeshSuccess = FUnrealMeshTranslator::CreateInputNodeForRawMesh(
-				CurrentLODNodeId,
-				SrcModel,
-				LODIndex,
-				DoExportLODs,
-				StaticMesh,
-				StaticMeshComponent);
-			HOUDINI_LOG_MESSAGE(TEXT("FUnrealMeshTranslator::CreateInputNodeForRawMesh completed in %.4f seconds"), FPlatformTime::Seconds() - StartTime);
-		}
+		bool bMeshSuccess = CreateInputNodeForStaticMeshLOD(
+			CurrentLODNodeId, StaticMesh, LODIndex, DoExportLODs, StaticMeshComponent, bMaterialsAsIndices, &LODStreams);
 
 		if (!bMeshSuccess)
 			continue;
 
+		if (bMaterialsAsIndices)
+		{
+			// Restore the per face material paths before merging the LODs, as their material tables differ
+			HAPI_NodeId ConversionNodeId = -1;
+			if (!CreateMaterialIndicesConversionNode(CurrentLODNodeId, InputObjectNodeId, ConversionNodeId))
+				return false;
+
+			CurrentLODNodeId = ConversionNodeId;
+		}
+
 		if (UseMergeNode)
 		{
 			// Connect the LOD node to the merge node.
@@ -359,10 +645,101 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 		}
 	}
 
+	FHoudiniInputNodeCache::SetUploadedStaticMesh(NewNodeId, UploadedMesh);
+
 	//
 	return true;
 }
 
+bool
+FUnrealMeshTranslator::CreateInputNodeForStaticMeshLOD(
+	const HAPI_NodeId& NodeId,
+	UStaticMesh* StaticMesh,
+	const int32& LODIndex,
+	const bool& DoExportLODs,
+	UStaticMeshComponent* StaticMeshComponent,
+	const bool& bMaterialsAsIndices /* = false */,
+	FHoudiniMeshStreamHashes* InOutStreamHashes /* = nullptr */)
+{
+	// TODO:
+	// Setting for lightmap resolution?
+	//const uint8 ExportMethod = 0; // Raw mesh
+	//const uint8 ExportMethod = 1; // Mesh description
+	const uint8 ExportMethod = 2; // LODResources (render mesh)
+	//bool bExportViaRawMesh = false;
+
+	// Grab the LOD level.
+	FStaticMeshSourceModel & SrcModel = StaticMesh->GetSourceModel(LODIndex);
+
+	// Either export the current LOD Mesh by using RawMEsh or MeshDescription (legacy)
+	FMeshDescription* MeshDesc = nullptr;
+	// if (!bExportViaRawMesh)
+	if (ExportMethod == 1)
+	{
+		// This will either fetch the mesh description that is cached on the SrcModel
+		// or load it from bulk data / DDC once
+		if (SrcModel.MeshDescription.IsValid())
+		{
+			MeshDesc = SrcModel.MeshDescription.Get();
+		}
+		else
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			MeshDesc = StaticMesh->GetMeshDescription(LODIndex);
+			HOUDINI_LOG_MESSAGE(TEXT("StaticMesh->GetMeshDescription completed in %.4f seconds"), FPlatformTime::Seconds() - StartTime);
+		}
+	}
+
+	bool bMeshSuccess = false;
+	if (ExportMethod == 1 && MeshDesc)
+	{
+		// Convert the Mesh using FMeshDescription
+		const double StartTime = FPlatformTime::Seconds();
+		bMeshSuccess = FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
+			NodeId,
+			*MeshDesc,
+			LODIndex,
+			DoExportLODs,
+			StaticMesh,
+			StaticMeshComponent);
+		HOUDINI_LOG_MESSAGE(TEXT("FUnrealMeshTranslator::CreateInputNodeForMeshDescription completed in %.4f seconds"), FPlatformTime::Seconds() - StartTime);
+	}
+	else if (ExportMethod == 2)
+	{
+		// Convert the LOD Mesh using FStaticMeshLODResources
+		const double StartTime = FPlatformTime::Seconds();
+		bMeshSuccess = FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
+			NodeId,
+			StaticMesh->GetLODForExport(LODIndex),
+			LODIndex,
+			DoExportLODs,
+			StaticMesh,
+			StaticMeshComponent,
+			bMaterialsAsIndices,
+			InOutStreamHashes);
+		HOUDINI_LOG_MESSAGE(TEXT("FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources completed in %.4f seconds"), FPlatformTime::Seconds() - StartTime);
+	}
+	else
+	{
+		// Convert the LOD Mesh using FRawMesh
+		const double StartTime = FPlatformTime::Seconds();
+		bMeshSuccess = FUnrealMeshTranslator::CreateInputNodeForRawMesh(
+			NodeId,
+			SrcModel,
+			LODIndex,
+			DoExportLODs,
+			StaticMesh,
+			StaticMeshComponent);
+		HOUDINI_LOG_MESSAGE(TEXT("FUnrealMeshTranslator::CreateInputNodeForRawMesh completed in %.4f seconds"), FPlatformTime::Seconds() - StartTime);
+	}
+
+	// Only the LODResources export keeps track of the uploaded streams, the whole mesh will be uploaded next time
+	if (InOutStreamHashes && ExportMethod != 2)
+		*InOutStreamHashes = FHoudiniMeshStreamHashes();
+
+	return bMeshSuccess;
+}
+
 bool
 FUnrealMeshTranslator::CreateInputNodeForMeshSockets(
 	const TArray<UStaticMeshSocket*>& InMeshSocket, const HAPI_NodeId& InParentNodeId, HAPI_NodeId& OutSocketsNodeId)
@@ -1486,7 +1863,9 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 	const int32& InLODIndex,
 	const bool& bAddLODGroups,
 	UStaticMesh* StaticMesh,
-	UStaticMeshComponent* StaticMeshComponent)
+	UStaticMeshComponent* StaticMeshComponent,
+	const bool& bMaterialsAsIndices /* = false */,
+	FHoudiniMeshStreamHashes* InOutStreamHashes /* = nullptr */)
 {
 	// Convert the Mesh using FStaticMeshLODResources
 
@@ -1513,46 +1892,208 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 	const FStaticMeshSourceModel &SourceModel = StaticMesh->GetSourceModel(InLODIndex);
 	FVector BuildScaleVector = SourceModel.BuildSettings.BuildScale3D;
 
+	// Determine which attributes we have
+	const bool bIsVertexInstanceNormalsValid = true;
+	const bool bIsVertexInstanceTangentsValid = true;
+	const bool bIsVertexInstanceBinormalsValid = true;
+	const bool bIsVertexInstanceColorsValid = LODResources.bHasColorVertexData;
+	const uint32 NumUVLayers = FMath::Min<uint32>(LODResources.VertexBuffers.StaticMeshVertexBuffer.GetNumTexCoords(), MAX_STATIC_TEXCOORDS);
+	const bool bIsVertexInstanceUVsValid = NumUVLayers > 0;
+
+	bool bUseComponentOverrideColors = false;
+	// Determine if have override colors on the static mesh component, if so prefer to use those
+	if (StaticMeshComponent &&
+		StaticMeshComponent->LODData.IsValidIndex(InLODIndex) &&
+		StaticMeshComponent->LODData[InLODIndex].OverrideVertexColors)
+	{
+		FStaticMeshComponentLODInfo& ComponentLODInfo = StaticMeshComponent->LODData[InLODIndex];
+		FColorVertexBuffer& ColorVertexBuffer = *ComponentLODInfo.OverrideVertexColors;
+
+		if (ColorVertexBuffer.GetNumVertices() == LODResources.GetNumVertices())
+		{
+			bUseComponentOverrideColors = true;
+		}
+	}
+
 	//--------------------------------------------------------------------------------------------------------------------- 
-	// POSITION (P)
+	// TRIANGLE/FACE VERTICES
+	//---------------------------------------------------------------------------------------------------------------------
+	// UE vertex index of each Houdini vertex, the winding order is reversed for Houdini (but still starts at 0)
+	TArray<uint32> HoudiniVertexToUEVertexIdx;
+	HoudiniVertexToUEVertexIdx.SetNumUninitialized(NumVertexInstances);
+	{
+		FIndexArrayView TriangleVertexIndices = LODResources.IndexBuffer.GetArrayView();
+		uint32 SectionFirstVertexIdx = 0;
+		for (uint32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+		{
+			const FStaticMeshSection& Section = LODResources.Sections[SectionIndex];
+			ParallelForInputMeshBatches(Section.NumTriangles * 3, [&](const int32& Start, const int32& End)
+			{
+				for (int32 SectionVertexIdx = Start; SectionVertexIdx < End; ++SectionVertexIdx)
+				{
+					const int32 TriangleVertexIndex = SectionVertexIdx % 3;
+					const int32 WindingIdx = (3 - TriangleVertexIndex) % 3;
+					HoudiniVertexToUEVertexIdx[SectionFirstVertexIdx + SectionVertexIdx] =
+						TriangleVertexIndices[Section.FirstIndex + SectionVertexIdx - TriangleVertexIndex + WindingIdx];
+				}
+			});
+			SectionFirstVertexIdx += Section.NumTriangles * 3;
+		}
+	}
+
+	// Fetch the color buffer here, the component must not be accessed from the worker threads
+	const FColorVertexBuffer* ColorVertexBuffer = nullptr;
+	if (bUseComponentOverrideColors)
+		ColorVertexBuffer = StaticMeshComponent->LODData[InLODIndex].OverrideVertexColors;
+	else if (bIsVertexInstanceColorsValid)
+		ColorVertexBuffer = &LODResources.VertexBuffers.ColorVertexBuffer;
+
 	//--------------------------------------------------------------------------------------------------------------------- 
-	// In FStaticMeshLODResources each vertex instances stores its position, even if the positions are not unique (in other
-	// words, in Houdini terminology, the number of points and vertices are the same. We'll do the same thing that Epic
-	// does in FBX export: we'll run through all vertex instances and use a hash to determine which instances share a 
-	// position, so that we can a smaller number of points than vertices, and vertices share point positions
-	TArray<int32> UEVertexInstanceIdxToPointIdx;
-	UEVertexInstanceIdxToPointIdx.Reserve(OrigNumVertexInstances);
+	// STREAM HASHES
+	//---------------------------------------------------------------------------------------------------------------------
+	// If the geometry already uploaded to the node hasn't changed, only the streams that changed are uploaded
+	FHoudiniMeshStreamHashes PreviousStreamHashes;
+	FHoudiniMeshStreamHashes NewStreamHashes;
+	if (InOutStreamHashes)
+	{
+		PreviousStreamHashes = *InOutStreamHashes;
+		NewStreamHashes = GetStaticMeshLODStreamHashes(
+			LODResources, HoudiniVertexToUEVertexIdx, ColorVertexBuffer, InLODIndex, bAddLODGroups, StaticMesh, StaticMeshComponent);
 
-	TMap<FVector, int32> PositionToPointIndexMap;
-	PositionToPointIndexMap.Reserve(OrigNumVertexInstances);
+		// Until the upload succeeds, we don't know what's on the node
+		*InOutStreamHashes = FHoudiniMeshStreamHashes();
+	}
 
-	TArray<float> StaticMeshVertices;
-	StaticMeshVertices.Reserve(OrigNumVertexInstances * 3);
-	for (uint32 VertexInstanceIndex = 0; VertexInstanceIndex < OrigNumVertexInstances; ++VertexInstanceIndex)
+	const bool bKeepGeometry = PreviousStreamHashes.bValid && NewStreamHashes.bValid
+		&& PreviousStreamHashes.Geometry == NewStreamHashes.Geometry;
+	const bool bUploadUVs = !bKeepGeometry || PreviousStreamHashes.UVs != NewStreamHashes.UVs;
+	const bool bUploadNormals = !bKeepGeometry || PreviousStreamHashes.Normals != NewStreamHashes.Normals;
+	const bool bUploadColors = !bKeepGeometry || PreviousStreamHashes.Colors != NewStreamHashes.Colors;
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// VERTEX INSTANCE ATTRIBUTES
+	//---------------------------------------------------------------------------------------------------------------------
+	// UV layer array. Each layer has an array of floats, 3 floats per vertex instance
+	TArray<TArray<float>> UVs;
+	// Normals: 3 floats per vertex instance
+	TArray<float> Normals;
+	// Tangents: 3 floats per vertex instance
+	TArray<float> Tangents;
+	// Binormals: 3 floats per vertex instance
+	TArray<float> Binormals;
+	// RGBColors: 3 floats per vertex instance
+	TArray<float> RGBColors;
+	// Alphas: 1 float per vertex instance
+	TArray<float> Alphas;
+
+	// Each stream is filled by its own builder, on a range of Houdini vertices
+	TArray<TFunction<void(const int32&, const int32&)>> StreamBuilders;
+	const FStaticMeshVertexBuffer& StaticMeshVertexBuffer = LODResources.VertexBuffers.StaticMeshVertexBuffer;
+
+	if (bIsVertexInstanceUVsValid && bUploadUVs)
 	{
-		// Convert Unreal to Houdini
-		const FVector &PositionVector = LODResources.VertexBuffers.PositionVertexBuffer.VertexPosition(VertexInstanceIndex);
-		const int32 *FoundPointIndexPtr = PositionToPointIndexMap.Find(PositionVector);
-		if (!FoundPointIndexPtr)
+		UVs.SetNum(NumUVLayers);
+		for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
 		{
-			const int32 NewPointIndex = StaticMeshVertices.Add(PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.X) / 3;
-			StaticMeshVertices.Add(PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Z);
-			StaticMeshVertices.Add(PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Y);
-
-			PositionToPointIndexMap.Add(PositionVector, NewPointIndex);
-			UEVertexInstanceIdxToPointIdx.Add(NewPointIndex);
+			UVs[UVLayerIndex].SetNumUninitialized(NumVertexInstances * 3);
+			StreamBuilders.Add([&, UVLayerIndex](const int32& Start, const int32& End)
+			{
+				float* UVData = UVs[UVLayerIndex].GetData();
+				for (int32 HoudiniVertexIdx = Start; HoudiniVertexIdx < End; ++HoudiniVertexIdx)
+				{
+					const FVector2D UV = StaticMeshVertexBuffer.GetVertexUV(HoudiniVertexToUEVertexIdx[HoudiniVertexIdx], UVLayerIndex);
+					UVData[HoudiniVertexIdx * 3 + 0] = UV.X;
+					UVData[HoudiniVertexIdx * 3 + 1] = 1.0f - UV.Y;
+					UVData[HoudiniVertexIdx * 3 + 2] = 0;
+				}
+			});
 		}
-		else
+	}
+
+	if (bIsVertexInstanceNormalsValid && bUploadNormals)
+	{
+		Normals.SetNumUninitialized(NumVertexInstances * 3);
+		StreamBuilders.Add([&](const int32& Start, const int32& End)
 		{
-			UEVertexInstanceIdxToPointIdx.Add(*FoundPointIndexPtr);
-		}
+			for (int32 HoudiniVertexIdx = Start; HoudiniVertexIdx < End; ++HoudiniVertexIdx)
+			{
+				const FVector Normal = StaticMeshVertexBuffer.VertexTangentZ(HoudiniVertexToUEVertexIdx[HoudiniVertexIdx]);
+				Normals[HoudiniVertexIdx * 3 + 0] = Normal.X;
+				Normals[HoudiniVertexIdx * 3 + 1] = Normal.Z;
+				Normals[HoudiniVertexIdx * 3 + 2] = Normal.Y;
+			}
+		});
+	}
+
+	if (bIsVertexInstanceTangentsValid && bUploadNormals)
+	{
+		Tangents.SetNumUninitialized(NumVertexInstances * 3);
+		StreamBuilders.Add([&](const int32& Start, const int32& End)
+		{
+			for (int32 HoudiniVertexIdx = Start; HoudiniVertexIdx < End; ++HoudiniVertexIdx)
+			{
+				const FVector Tangent = StaticMeshVertexBuffer.VertexTangentX(HoudiniVertexToUEVertexIdx[HoudiniVertexIdx]);
+				Tangents[HoudiniVertexIdx * 3 + 0] = Tangent.X;
+				Tangents[HoudiniVertexIdx * 3 + 1] = Tangent.Z;
+				Tangents[HoudiniVertexIdx * 3 + 2] = Tangent.Y;
+			}
+		});
+	}
+
+	if (bIsVertexInstanceBinormalsValid && bUploadNormals)
+	{
+		Binormals.SetNumUninitialized(NumVertexInstances * 3);
+		StreamBuilders.Add([&](const int32& Start, const int32& End)
+		{
+			for (int32 HoudiniVertexIdx = Start; HoudiniVertexIdx < End; ++HoudiniVertexIdx)
+			{
+				const FVector Binormal = StaticMeshVertexBuffer.VertexTangentY(HoudiniVertexToUEVertexIdx[HoudiniVertexIdx]);
+				Binormals[HoudiniVertexIdx * 3 + 0] = Binormal.X;
+				Binormals[HoudiniVertexIdx * 3 + 1] = Binormal.Z;
+				Binormals[HoudiniVertexIdx * 3 + 2] = Binormal.Y;
+			}
+		});
 	}
 
-	StaticMeshVertices.Shrink();
-	const uint32 NumVertices = StaticMeshVertices.Num() / 3;
+	if (ColorVertexBuffer && bUploadColors)
+	{
+		RGBColors.SetNumUninitialized(NumVertexInstances * 3);
+		Alphas.SetNumUninitialized(NumVertexInstances);
+
+		StreamBuilders.Add([&, ColorVertexBuffer](const int32& Start, const int32& End)
+		{
+			for (int32 HoudiniVertexIdx = Start; HoudiniVertexIdx < End; ++HoudiniVertexIdx)
+			{
+				const FLinearColor Color = ColorVertexBuffer->VertexColor(HoudiniVertexToUEVertexIdx[HoudiniVertexIdx]).ReinterpretAsLinear();
+				RGBColors[HoudiniVertexIdx * 3 + 0] = Color.R;
+				RGBColors[HoudiniVertexIdx * 3 + 1] = Color.G;
+				RGBColors[HoudiniVertexIdx * 3 + 2] = Color.B;
+				Alphas[HoudiniVertexIdx] = Color.A;
+			}
+		});
+	}
 
-	// Now that we know how many vertices (points), vertex instances (vertices) and triagnles we have,
-	// we can create the part.
+	// Build the streams in the background while the positions are hashed and sent to Houdini.
+	// Each job fills one batch of one stream, the HAPI calls have to stay on this thread.
+	const int32 NumStreamBatches = FMath::DivideAndRoundUp((int32)NumVertexInstances, HOUDINI_INPUT_MESH_BATCH_SIZE);
+	TFuture<void> StreamsFuture = Async(EAsyncExecution::TaskGraph, [&]()
+	{
+		ParallelFor(StreamBuilders.Num() * NumStreamBatches, [&](int32 JobIdx)
+		{
+			const int32 Start = (JobIdx % NumStreamBatches) * HOUDINI_INPUT_MESH_BATCH_SIZE;
+			const int32 End = FMath::Min(Start + HOUDINI_INPUT_MESH_BATCH_SIZE, (int32)NumVertexInstances);
+			StreamBuilders[JobIdx / NumStreamBatches](Start, End);
+		});
+	});
+
+	// The streams' buffers must outlive the task, even if we return early
+	ON_SCOPE_EXIT
+	{
+		if (StreamsFuture.IsValid())
+			StreamsFuture.Wait();
+	};
+
+	// The part's point count is only known once the positions have been deduplicated below.
 	HAPI_PartInfo Part;
 	FHoudiniApi::PartInfo_Init(&Part);
 
@@ -1564,54 +2105,73 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 	Part.attributeCounts[HAPI_ATTROWNER_DETAIL] = 0;
 	Part.vertexCount = NumVertexInstances;
 	Part.faceCount = NumTriangles;
-	Part.pointCount = NumVertices;
 	Part.type = HAPI_PARTTYPE_MESH;
 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
-		FHoudiniEngine::Get().GetSession(), NodeId, 0, &Part), false);
-
-	// Create point attribute info.
-	HAPI_AttributeInfo AttributeInfoPoint;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfoPoint);
-	//FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoPoint );
-	AttributeInfoPoint.count = Part.pointCount;
-	AttributeInfoPoint.tupleSize = 3;
-	AttributeInfoPoint.exists = true;
-	AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
-	AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
-	AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
-
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-		FHoudiniEngine::Get().GetSession(), NodeId, 0,
-		HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint), false);
-
-	// Now that we have raw positions, we can upload them for our attribute.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-		FHoudiniEngine::Get().GetSession(),
-		NodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
-		StaticMeshVertices.GetData(), 0, AttributeInfoPoint.count), false);
-
-	// Determine which attributes we have
-	const bool bIsVertexInstanceNormalsValid = true;
-	const bool bIsVertexInstanceTangentsValid = true;
-	const bool bIsVertexInstanceBinormalsValid = true;
-	const bool bIsVertexInstanceColorsValid = LODResources.bHasColorVertexData;
-	const uint32 NumUVLayers = FMath::Min<uint32>(LODResources.VertexBuffers.StaticMeshVertexBuffer.GetNumTexCoords(), MAX_STATIC_TEXCOORDS);
-	const bool bIsVertexInstanceUVsValid = NumUVLayers > 0;
-
-	bool bUseComponentOverrideColors = false;
-	// Determine if have override colors on the static mesh component, if so prefer to use those
-	if (StaticMeshComponent &&
-		StaticMeshComponent->LODData.IsValidIndex(InLODIndex) &&
-		StaticMeshComponent->LODData[InLODIndex].OverrideVertexColors)
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// POSITION (P)
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// In FStaticMeshLODResources each vertex instances stores its position, even if the positions are not unique (in other
+	// words, in Houdini terminology, the number of points and vertices are the same. We'll do the same thing that Epic
+	// does in FBX export: we'll run through all vertex instances and use a hash to determine which instances share a 
+	// position, so that we can a smaller number of points than vertices, and vertices share point positions.
+	// The points of a kept geometry are already on the node.
+	TArray<int32> UEVertexInstanceIdxToPointIdx;
+	if (!bKeepGeometry)
 	{
-		FStaticMeshComponentLODInfo& ComponentLODInfo = StaticMeshComponent->LODData[InLODIndex];
-		FColorVertexBuffer& ColorVertexBuffer = *ComponentLODInfo.OverrideVertexColors;
+		UEVertexInstanceIdxToPointIdx.Reserve(OrigNumVertexInstances);
 
-		if (ColorVertexBuffer.GetNumVertices() == LODResources.GetNumVertices())
+		TMap<FVector, int32> PositionToPointIndexMap;
+		PositionToPointIndexMap.Reserve(OrigNumVertexInstances);
+
+		TArray<float> StaticMeshVertices;
+		StaticMeshVertices.Reserve(OrigNumVertexInstances * 3);
+		for (uint32 VertexInstanceIndex = 0; VertexInstanceIndex < OrigNumVertexInstances; ++VertexInstanceIndex)
 		{
-			bUseComponentOverrideColors = true;
+			// Convert Unreal to Houdini
+			const FVector &PositionVector = LODResources.VertexBuffers.PositionVertexBuffer.VertexPosition(VertexInstanceIndex);
+			const int32 *FoundPointIndexPtr = PositionToPointIndexMap.Find(PositionVector);
+			if (!FoundPointIndexPtr)
+			{
+				const int32 NewPointIndex = StaticMeshVertices.Add(PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.X) / 3;
+				StaticMeshVertices.Add(PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Z);
+				StaticMeshVertices.Add(PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Y);
+
+				PositionToPointIndexMap.Add(PositionVector, NewPointIndex);
+				UEVertexInstanceIdxToPointIdx.Add(NewPointIndex);
+			}
+			else
+			{
+				UEVertexInstanceIdxToPointIdx.Add(*FoundPointIndexPtr);
+			}
 		}
+
+		StaticMeshVertices.Shrink();
+		const uint32 NumVertices = StaticMeshVertices.Num() / 3;
+		Part.pointCount = NumVertices;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
+			FHoudiniEngine::Get().GetSession(), NodeId, 0, &Part), false);
+
+		// Create point attribute info.
+		HAPI_AttributeInfo AttributeInfoPoint;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoPoint);
+		//FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoPoint );
+		AttributeInfoPoint.count = Part.pointCount;
+		AttributeInfoPoint.tupleSize = 3;
+		AttributeInfoPoint.exists = true;
+		AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
+		AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(), NodeId, 0,
+			HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint), false);
+
+		// Now that we have raw positions, we can upload them for our attribute.
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(),
+			NodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
+			StaticMeshVertices.GetData(), 0, AttributeInfoPoint.count), false);
 	}
 
 	//--------------------------------------------------------------------------------------------------------------------- 
@@ -1657,211 +2217,101 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 			MaterialInterfaces.Add(Material);
 		}
 
-		TriangleMaterialIndices.Reserve(NumTriangles);
 	}
 
-	// If we haven't created UEDefaultMaterial yet, check that all the sections' MaterialIndex
-	// is valid, if not, create UEDefaultMaterial and add to MaterialInterfaces to get UEDefaultMaterialIndex
-	if (!UEDefaultMaterial || UEDefaultMaterialIndex == INDEX_NONE)
+	// Check that all the sections' MaterialIndex is valid, if not, use UEDefaultMaterial (create it and add it 
+	// to MaterialInterfaces to get UEDefaultMaterialIndex if needed)
+	TArray<int32> SectionMaterialIndices;
+	SectionMaterialIndices.SetNumUninitialized(NumSections);
+	for (uint32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
 	{
-		for (uint32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+		// If the MaterialIndex referenced by this Section is out of range, fill MaterialInterfaces with UEDefaultMaterial
+		// up to and including MaterialIndex and log a warning
+		const int32 MaterialIndex = LODResources.Sections[SectionIndex].MaterialIndex;
+		if (MaterialInterfaces.IsValidIndex(MaterialIndex))
 		{
-			// If the MaterialIndex referenced by this Section is out of range, fill MaterialInterfaces with UEDefaultMaterial
-			// up to and including MaterialIndex and log a warning
-			const int32 MaterialIndex = LODResources.Sections[SectionIndex].MaterialIndex;
-			if (!MaterialInterfaces.IsValidIndex(MaterialIndex))
-			{
-				if (!UEDefaultMaterial)
-				{
-					UEDefaultMaterial = UMaterial::GetDefaultMaterial(EMaterialDomain::MD_Surface);
-					// Add the UEDefaultMaterial to MaterialInterfaces
-					UEDefaultMaterialIndex = MaterialInterfaces.Add(UEDefaultMaterial);
-				}
-				HOUDINI_LOG_WARNING(TEXT("Section Index %d references an invalid Material Index %d, falling back to default material: %s"), SectionIndex, MaterialIndex, *(UEDefaultMaterial->GetPathName()));
-			}
+			SectionMaterialIndices[SectionIndex] = MaterialIndex;
+			continue;
 		}
+
+		if (!UEDefaultMaterial || UEDefaultMaterialIndex == INDEX_NONE)
+		{
+			UEDefaultMaterial = UMaterial::GetDefaultMaterial(EMaterialDomain::MD_Surface);
+			// Add the UEDefaultMaterial to MaterialInterfaces
+			UEDefaultMaterialIndex = MaterialInterfaces.Add(UEDefaultMaterial);
+		}
+		HOUDINI_LOG_WARNING(TEXT("Section Index %d references an invalid Material Index %d, falling back to default material: %s"), SectionIndex, MaterialIndex, *(UEDefaultMaterial->GetPathName()));
+		SectionMaterialIndices[SectionIndex] = UEDefaultMaterialIndex;
 	}
 
 	// Determine the final number of materials we have, with default for missing/invalid indices
 	const int32 NumMaterials = MaterialInterfaces.Num();
 
-	// Now we deal with vertex instance attributes. 
-	if (NumTriangles > 0)
+	// The materials assigned to each section
+	if (NewStreamHashes.bValid)
 	{
-		// UV layer array. Each layer has an array of floats, 3 floats per vertex instance
-		TArray<TArray<float>> UVs;
-		// Normals: 3 floats per vertex instance
-		TArray<float> Normals;
-		// Tangents: 3 floats per vertex instance
-		TArray<float> Tangents;
-		// Binormals: 3 floats per vertex instance
-		TArray<float> Binormals;
-		// RGBColors: 3 floats per vertex instance
-		TArray<float> RGBColors;
-		// Alphas: 1 float per vertex instance
-		TArray<float> Alphas;
-
-		// Initialize the arrays for the attributes that are valid
-		if (bIsVertexInstanceUVsValid)
-		{
-			UVs.SetNum(NumUVLayers);
-			for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
-			{
-				UVs[UVLayerIndex].SetNumUninitialized(NumVertexInstances * 3);
-			}
-		}
-
-		if (bIsVertexInstanceNormalsValid)
-		{
-			Normals.SetNumUninitialized(NumVertexInstances * 3);
-		}
+		uint32 Crc = bMaterialsAsIndices ? 1 : 0;
+		for (UMaterialInterface* MaterialInterface : MaterialInterfaces)
+			Crc = FCrc::StrCrc32(MaterialInterface ? *MaterialInterface->GetPathName() : TEXT(""), Crc);
 
-		if (bIsVertexInstanceTangentsValid)
+		for (uint32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
 		{
-			Tangents.SetNumUninitialized(NumVertexInstances * 3);
+			const uint32 SectionData[] = { (uint32)SectionMaterialIndices[SectionIndex], LODResources.Sections[SectionIndex].NumTriangles };
+			Crc = FCrc::MemCrc32(SectionData, sizeof(SectionData), Crc);
 		}
 
-		if (bIsVertexInstanceBinormalsValid)
-		{
-			Binormals.SetNumUninitialized(NumVertexInstances * 3);
-		}
+		NewStreamHashes.Materials = Crc;
+	}
 
-		if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
-		{
-			RGBColors.SetNumUninitialized(NumVertexInstances * 3);
-			Alphas.SetNumUninitialized(NumVertexInstances);
-		}
+	const bool bUploadMaterials = !bKeepGeometry || PreviousStreamHashes.Materials != NewStreamHashes.Materials;
 
+	// Now we deal with vertex instance attributes. 
+	if (NumTriangles > 0)
+	{
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// TRIANGLE/FACE VERTEX INDICES
+		//---------------------------------------------------------------------------------------------------------------------
 		// Array of vertex (point position) indices per triangle
 		TArray<int32> MeshTriangleVertexIndices;
-		MeshTriangleVertexIndices.SetNumUninitialized(NumVertexInstances);
-		// Array of vertex counts per triangle/face
-		TArray<int32> MeshTriangleVertexCounts;
-		MeshTriangleVertexCounts.SetNumUninitialized(NumTriangles);
-
-		int32 TriangleIdx = 0;
-		int32 HoudiniVertexIdx = 0;
-		FIndexArrayView TriangleVertexIndices = LODResources.IndexBuffer.GetArrayView();
-		for (uint32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+		if (!bKeepGeometry)
 		{
-			const FStaticMeshSection& Section = LODResources.Sections[SectionIndex];
-			for (uint32 SectionTriangleIndex = 0; SectionTriangleIndex < Section.NumTriangles; ++SectionTriangleIndex)
+			MeshTriangleVertexIndices.SetNumZeroed(NumVertexInstances);
+			ParallelForInputMeshBatches(NumVertexInstances, [&](const int32& Start, const int32& End)
 			{
-				MeshTriangleVertexCounts[TriangleIdx] = 3;
-				for (int32 TriangleVertexIndex = 0; TriangleVertexIndex < 3; ++TriangleVertexIndex)
+				for (int32 HoudiniVertexIdx = Start; HoudiniVertexIdx < End; ++HoudiniVertexIdx)
 				{
-					// Reverse the winding order for Houdini (but still start at 0)
-					const int32 WindingIdx = (3 - TriangleVertexIndex) % 3;
-					const uint32 UEVertexIndex = TriangleVertexIndices[Section.FirstIndex + SectionTriangleIndex * 3 + WindingIdx];
-
-					// Calculate the index of the first component of a vertex instance's value in an inline float array 
-					// representing vectors (3 float) per vertex instance
-					const int32 Float3Index = HoudiniVertexIdx * 3;
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// UVS (uvX)
-					//--------------------------------------------------------------------------------------------------------------------- 
-					if (bIsVertexInstanceUVsValid)
-					{
-						for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
-						{
-							const FVector2D &UV = LODResources.VertexBuffers.StaticMeshVertexBuffer.GetVertexUV(UEVertexIndex, UVLayerIndex);
-							UVs[UVLayerIndex][Float3Index + 0] = UV.X;
-							UVs[UVLayerIndex][Float3Index + 1] = 1.0f - UV.Y;
-							UVs[UVLayerIndex][Float3Index + 2] = 0;
-						}
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// NORMALS (N)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bIsVertexInstanceNormalsValid)
-					{
-						const FVector &Normal = LODResources.VertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(UEVertexIndex);
-						Normals[Float3Index + 0] = Normal.X;
-						Normals[Float3Index + 1] = Normal.Z;
-						Normals[Float3Index + 2] = Normal.Y;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// TANGENT (tangentu)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bIsVertexInstanceTangentsValid)
-					{
-						const FVector &Tangent = LODResources.VertexBuffers.StaticMeshVertexBuffer.VertexTangentX(UEVertexIndex);
-						Tangents[Float3Index + 0] = Tangent.X;
-						Tangents[Float3Index + 1] = Tangent.Z;
-						Tangents[Float3Index + 2] = Tangent.Y;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// BINORMAL (tangentv)
-					//---------------------------------------------------------------------------------------------------------------------
-					// In order to calculate the binormal we also need the tangent and normal
-					if (bIsVertexInstanceBinormalsValid)
-					{
-						FVector Binormal = LODResources.VertexBuffers.StaticMeshVertexBuffer.VertexTangentY(UEVertexIndex);
-						Binormals[Float3Index + 0] = Binormal.X;
-						Binormals[Float3Index + 1] = Binormal.Z;
-						Binormals[Float3Index + 2] = Binormal.Y;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// COLORS (Cd)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
-					{
-						FVector4 Color = FLinearColor::White;
-						if (bUseComponentOverrideColors)
-						{
-							FStaticMeshComponentLODInfo& ComponentLODInfo = StaticMeshComponent->LODData[InLODIndex];
-							FColorVertexBuffer& ColorVertexBuffer = *ComponentLODInfo.OverrideVertexColors;
-							Color = ColorVertexBuffer.VertexColor(UEVertexIndex).ReinterpretAsLinear();
-						}
-						else
-						{
-							Color = LODResources.VertexBuffers.ColorVertexBuffer.VertexColor(UEVertexIndex).ReinterpretAsLinear();
-						}
-						RGBColors[Float3Index + 0] = Color[0];
-						RGBColors[Float3Index + 1] = Color[1];
-						RGBColors[Float3Index + 2] = Color[2];
-						Alphas[HoudiniVertexIdx] = Color[3];
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// TRIANGLE/FACE VERTEX INDICES
-					//---------------------------------------------------------------------------------------------------------------------
+					const uint32 UEVertexIndex = HoudiniVertexToUEVertexIdx[HoudiniVertexIdx];
 					if (UEVertexInstanceIdxToPointIdx.IsValidIndex(UEVertexIndex))
-					{
 						MeshTriangleVertexIndices[HoudiniVertexIdx] = UEVertexInstanceIdxToPointIdx[UEVertexIndex];
-					}
-
-					HoudiniVertexIdx++;
 				}
+			});
+		}
 
-				//--------------------------------------------------------------------------------------------------------------------- 
-				// TRIANGLE MATERIAL ASSIGNMENT
-				//---------------------------------------------------------------------------------------------------------------------
-				if (MaterialInterfaces.IsValidIndex(Section.MaterialIndex))
-				{
-					TriangleMaterialIndices.Add(Section.MaterialIndex);
-				}
-				else
-				{
-					TriangleMaterialIndices.Add(UEDefaultMaterialIndex);
-					HOUDINI_LOG_WARNING(TEXT("Section Index %d references an invalid Material Index %d, falling back to default material: %s"), SectionIndex, Section.MaterialIndex, *(UEDefaultMaterial->GetPathName()));
-				}
+		// Array of vertex counts per triangle/face
+		TArray<int32> MeshTriangleVertexCounts;
+		MeshTriangleVertexCounts.Init(3, NumTriangles);
 
-				TriangleIdx++;
-			}
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// TRIANGLE MATERIAL ASSIGNMENT
+		//---------------------------------------------------------------------------------------------------------------------
+		TriangleMaterialIndices.SetNumUninitialized(NumTriangles);
+		int32 TriangleIdx = 0;
+		for (uint32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+		{
+			const uint32 SectionNumTriangles = LODResources.Sections[SectionIndex].NumTriangles;
+			for (uint32 SectionTriangleIndex = 0; SectionTriangleIndex < SectionNumTriangles; ++SectionTriangleIndex)
+				TriangleMaterialIndices[TriangleIdx++] = SectionMaterialIndices[SectionIndex];
 		}
 
+		// The vertex instance attributes have to be ready before being sent
+		StreamsFuture.Wait();
+
 		// Now transfer valid vertex instance attributes to Houdini vertex attributes
 
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// UVS (uvX)
 		//--------------------------------------------------------------------------------------------------------------------- 
-		if (bIsVertexInstanceUVsValid)
+		if (bIsVertexInstanceUVsValid && bUploadUVs)
 		{
 			for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; UVLayerIndex++)
 			{
@@ -1896,7 +2346,7 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// NORMALS (N)
 		//---------------------------------------------------------------------------------------------------------------------
-		if (bIsVertexInstanceNormalsValid)
+		if (bIsVertexInstanceNormalsValid && bUploadNormals)
 		{
 			// Create attribute for normals.
 			HAPI_AttributeInfo AttributeInfoVertex;
@@ -1923,7 +2373,7 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// TANGENT (tangentu)
 		//---------------------------------------------------------------------------------------------------------------------
-		if (bIsVertexInstanceTangentsValid)
+		if (bIsVertexInstanceTangentsValid && bUploadNormals)
 		{
 			// Create attribute for tangentu.
 			HAPI_AttributeInfo AttributeInfoVertex;
@@ -1949,7 +2399,7 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// BINORMAL (tangentv)
 		//---------------------------------------------------------------------------------------------------------------------
-		if (bIsVertexInstanceBinormalsValid)
+		if (bIsVertexInstanceBinormalsValid && bUploadNormals)
 		{
 			// Create attribute for normals.
 			HAPI_AttributeInfo AttributeInfoVertex;
@@ -1975,7 +2425,7 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// COLORS (Cd)
 		//---------------------------------------------------------------------------------------------------------------------
-		if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
+		if (ColorVertexBuffer && bUploadColors)
 		{
 			// Create attribute for colors.
 			HAPI_AttributeInfo AttributeInfoVertex;
@@ -2018,20 +2468,38 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// TRIANGLE/FACE VERTEX INDICES
 		//---------------------------------------------------------------------------------------------------------------------
-		// We can now set vertex list.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetVertexList(
-			FHoudiniEngine::Get().GetSession(),
-			NodeId, 0, MeshTriangleVertexIndices.GetData(), 0, MeshTriangleVertexIndices.Num()), false);
+		if (!bKeepGeometry)
+		{
+			// We can now set vertex list.
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetVertexList(
+				FHoudiniEngine::Get().GetSession(),
+				NodeId, 0, MeshTriangleVertexIndices.GetData(), 0, MeshTriangleVertexIndices.Num()), false);
 
-		// Send the array of face vertex counts.
-		TArray< int32 > StaticMeshFaceCounts;
-		StaticMeshFaceCounts.Init(3, Part.faceCount);
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetFaceCounts(
-			FHoudiniEngine::Get().GetSession(),
-			NodeId, 0, MeshTriangleVertexCounts.GetData(), 0, MeshTriangleVertexCounts.Num()), false);
+			// Send the array of face vertex counts.
+			TArray< int32 > StaticMeshFaceCounts;
+			StaticMeshFaceCounts.Init(3, Part.faceCount);
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetFaceCounts(
+				FHoudiniEngine::Get().GetSession(),
+				NodeId, 0, MeshTriangleVertexCounts.GetData(), 0, MeshTriangleVertexCounts.Num()), false);
+		}
 
-		// Send material assignments to Houdini
-		if (NumMaterials > 0)
+		// Send material assignments to Houdini, unless the ones already on the node are still valid
+		if (bUploadMaterials && NumMaterials > 0 && bMaterialsAsIndices)
+		{
+			// Send the unique material paths once, and an index for each face.
+			TArray<FString> MaterialTable;
+			TArray<int32> FaceMaterialTableIndices;
+			FUnrealMeshTranslator::CreateFaceMaterialIndexArray(
+				MaterialInterfaces, TriangleMaterialIndices, MaterialTable, FaceMaterialTableIndices);
+
+			if (!FUnrealMeshTranslator::CreateHoudiniMeshMaterialIndexAttributes(
+				NodeId, 0, MaterialTable, FaceMaterialTableIndices))
+			{
+				check(0);
+				return false;
+			}
+		}
+		else if (bUploadMaterials && NumMaterials > 0)
 		{
 			// List of materials, one for each face.
 			TArray<char *> TriangleMaterials;
@@ -2127,6 +2595,19 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		//}
 	}
 
+	if (bKeepGeometry)
+	{
+		// The rest of the geometry is already on the node, only commit the streams we've uploaded
+		if (bUploadUVs || bUploadNormals || bUploadColors || bUploadMaterials)
+		{
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+				FHoudiniEngine::Get().GetSession(), NodeId), false);
+		}
+
+		*InOutStreamHashes = NewStreamHashes;
+		return true;
+	}
+
 	//--------------------------------------------------------------------------------------------------------------------- 
 	// LIGHTMAP RESOLUTION
 	//---------------------------------------------------------------------------------------------------------------------
@@ -2354,6 +2835,9 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
 		FHoudiniEngine::Get().GetSession(), NodeId), false);
 
+	if (InOutStreamHashes)
+		*InOutStreamHashes = NewStreamHashes;
+
 	return true;
 }
 
@@ -3546,6 +4030,47 @@ FUnrealMeshTranslator::DeleteFaceMaterialArray(TArray<char *>& OutStaticMeshFace
 	OutStaticMeshFaceMaterials.Empty();
 }
 
+void
+FUnrealMeshTranslator::CreateFaceMaterialIndexArray(
+	const TArray<UMaterialInterface *>& Materials,
+	const TArray<int32>& FaceMaterialIndices,
+	TArray<FString>& OutMaterialTable,
+	TArray<int32>& OutFaceMaterialTableIndices)
+{
+	UMaterialInterface * DefaultMaterialInterface = Cast<UMaterialInterface>(FHoudiniEngine::Get().GetHoudiniDefaultMaterial().Get());
+	const FString DefaultMaterialName = DefaultMaterialInterface->GetPathName();
+
+	// Find the table index of each material, a material used by several slots is only added once
+	OutMaterialTable.Empty();
+	TArray<int32> MaterialTableIndices;
+	MaterialTableIndices.SetNumUninitialized(Materials.Num());
+	for (int32 MaterialIdx = 0; MaterialIdx < Materials.Num(); MaterialIdx++)
+	{
+		// Null material interface found, add default instead.
+		UMaterialInterface * MaterialInterface = Materials[MaterialIdx];
+		MaterialTableIndices[MaterialIdx] = OutMaterialTable.AddUnique(
+			MaterialInterface ? MaterialInterface->GetPathName() : DefaultMaterialName);
+	}
+
+	// Faces with an invalid material index use the default material
+	int32 DefaultTableIndex = INDEX_NONE;
+	OutFaceMaterialTableIndices.SetNumUninitialized(FaceMaterialIndices.Num());
+	for (int32 FaceIdx = 0; FaceIdx < FaceMaterialIndices.Num(); ++FaceIdx)
+	{
+		const int32 FaceMaterialIdx = FaceMaterialIndices[FaceIdx];
+		if (MaterialTableIndices.IsValidIndex(FaceMaterialIdx))
+		{
+			OutFaceMaterialTableIndices[FaceIdx] = MaterialTableIndices[FaceMaterialIdx];
+			continue;
+		}
+
+		if (DefaultTableIndex == INDEX_NONE)
+			DefaultTableIndex = OutMaterialTable.AddUnique(DefaultMaterialName);
+
+		OutFaceMaterialTableIndices[FaceIdx] = DefaultTableIndex;
+	}
+}
+
 bool
 FUnrealMeshTranslator::CreateInputNodeForBox(
 	HAPI_NodeId& OutNodeId,
@@ -4194,6 +4719,96 @@ FUnrealMeshTranslator::CreateHoudiniMeshAttributes(
 	return bSuccess;
 }
 
+bool
+FUnrealMeshTranslator::CreateHoudiniMeshMaterialIndexAttributes(
+	const int32 & NodeId,
+	const int32 & PartId,
+	const TArray<FString> & MaterialTable,
+	const TArray<int32> & FaceMaterialTableIndices)
+{
+	if (NodeId < 0 || MaterialTable.Num() <= 0)
+		return false;
+
+	// The unique material paths are sent once, as a detail string tuple
+	HAPI_AttributeInfo AttributeInfoMaterialTable;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfoMaterialTable);
+	AttributeInfoMaterialTable.tupleSize = MaterialTable.Num();
+	AttributeInfoMaterialTable.count = 1;
+	AttributeInfoMaterialTable.exists = true;
+	AttributeInfoMaterialTable.owner = HAPI_ATTROWNER_DETAIL;
+	AttributeInfoMaterialTable.storage = HAPI_STORAGETYPE_STRING;
+	AttributeInfoMaterialTable.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(),
+		NodeId, PartId, HAPI_UNREAL_ATTRIB_MATERIAL_TABLE, &AttributeInfoMaterialTable), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::SetAttributeStringData(
+		MaterialTable, NodeId, PartId, HAPI_UNREAL_ATTRIB_MATERIAL_TABLE, AttributeInfoMaterialTable), false);
+
+	// Each face stores the index of its material in the table
+	HAPI_AttributeInfo AttributeInfoMaterialIndex;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfoMaterialIndex);
+	AttributeInfoMaterialIndex.tupleSize = 1;
+	AttributeInfoMaterialIndex.count = FaceMaterialTableIndices.Num();
+	AttributeInfoMaterialIndex.exists = true;
+	AttributeInfoMaterialIndex.owner = HAPI_ATTROWNER_PRIM;
+	AttributeInfoMaterialIndex.storage = HAPI_STORAGETYPE_INT;
+	AttributeInfoMaterialIndex.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(),
+		NodeId, PartId, HAPI_UNREAL_ATTRIB_MATERIAL_INDEX, &AttributeInfoMaterialIndex), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeIntData(
+		FHoudiniEngine::Get().GetSession(),
+		NodeId, PartId, HAPI_UNREAL_ATTRIB_MATERIAL_INDEX, &AttributeInfoMaterialIndex,
+		FaceMaterialTableIndices.GetData(), 0, FaceMaterialTableIndices.Num()), false);
+
+	return true;
+}
+
+bool
+FUnrealMeshTranslator::CreateMaterialIndicesConversionNode(
+	const HAPI_NodeId& InMeshNodeId,
+	const HAPI_NodeId& InParentNodeId,
+	HAPI_NodeId& OutConversionNodeId)
+{
+	// Reads the material table (a table of a single material isn't read as an array),
+	// sets the material of each primitive and removes the table and index attributes
+	static const char* MaterialConversionSnippet =
+		"string table[] = detail(0, \"" HAPI_UNREAL_ATTRIB_MATERIAL_TABLE "\");\n"
+		"if (len(table) == 0)\n"
+		"{\n"
+		"    string single = detail(0, \"" HAPI_UNREAL_ATTRIB_MATERIAL_TABLE "\", 0);\n"
+		"    append(table, single);\n"
+		"}\n"
+		"int index = i@" HAPI_UNREAL_ATTRIB_MATERIAL_INDEX ";\n"
+		"if (index >= 0 && index < len(table))\n"
+		"    s@" HAPI_UNREAL_ATTRIB_MATERIAL " = table[index];\n"
+		"if (@primnum == 0)\n"
+		"{\n"
+		"    removedetailattrib(0, \"" HAPI_UNREAL_ATTRIB_MATERIAL_TABLE "\");\n"
+		"    removeprimattrib(0, \"" HAPI_UNREAL_ATTRIB_MATERIAL_INDEX "\");\n"
+		"}\n";
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::CreateNode(
+		InParentNodeId, TEXT("attribwrangle"), TEXT("materials"), false, &OutConversionNodeId), false);
+
+	// Run over primitives
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmIntValue(
+		FHoudiniEngine::Get().GetSession(), OutConversionNodeId, "class", 0, 1), false);
+
+	HAPI_ParmId SnippetParmId = FHoudiniEngineUtils::HapiFindParameterByNameOrTag(OutConversionNodeId, "snippet");
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmStringValue(
+		FHoudiniEngine::Get().GetSession(), OutConversionNodeId, MaterialConversionSnippet, SnippetParmId, 0), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::ConnectNodeInput(
+		FHoudiniEngine::Get().GetSession(), OutConversionNodeId, 0, InMeshNodeId, 0), false);
+
+	return true;
+}
+
 /*
 bool
 FUnrealMeshTranslator::AddLevelPathAttributeToMesh(
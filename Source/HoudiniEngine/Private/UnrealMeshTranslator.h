@@ -40,12 +40,15 @@ struct FStaticMeshSourceModel;
 struct FStaticMeshLODResources;
 struct FMeshDescription;
 struct FKConvexElem;
+struct FHoudiniMeshStreamHashes;
 
 struct HOUDINIENGINE_API FUnrealMeshTranslator
 {
 	public:
 
 		// HAPI : Marshaling, extract geometry and create input asset for it - return true on success
+		// If InOutUploadedDataKey is provided, it is used to keep track of the data uploaded to the input node,
+		// so unchanged meshes aren't uploaded again and changed meshes are updated in the existing node when possible.
 		static bool HapiCreateInputNodeForStaticMesh(
 			UStaticMesh * Mesh,
 			HAPI_NodeId& InputObjectNodeId,
@@ -53,16 +56,73 @@ struct HOUDINIENGINE_API FUnrealMeshTranslator
 			class UStaticMeshComponent* StaticMeshComponent = nullptr,
 			const bool& ExportAllLODs = false,
 			const bool& ExportSockets = false,
-			const bool& ExportColliders = false);
+			const bool& ExportColliders = false,
+			FString* InOutUploadedDataKey = nullptr);
+
+		// Returns the uploaded data key of an input node, for a data key returned by FHoudiniInputNodeCache::GetStaticMeshKey()
+		static FString GetInputNodeDataKey(const HAPI_NodeId& InNodeId, const FString& InDataKey);
+
+		// Tries to update an existing input node with the static mesh's new data.
+		// bOutUpdated is false if the input node needs to be recreated instead.
+		static bool UpdateInputNodeForStaticMesh(
+			UStaticMesh* StaticMesh,
+			const HAPI_NodeId& InputNodeId,
+			UStaticMeshComponent* StaticMeshComponent,
+			const FString& InDataKey,
+			const FString& InPreviousInputNodeDataKey,
+			const bool& DoExportLODs,
+			const bool& DoExportSockets,
+			const bool& DoExportColliders,
+			const bool& bMaterialsAsIndices,
+			bool& bOutUpdated);
+
+		// Uploads the streams that changed to the LOD nodes of a static mesh input node created by CreateInputNodeForStaticMeshData(),
+		// keeping its merge network. bOutUpdated is false if the network doesn't match the static mesh anymore and needs to be recreated.
+		static bool UpdateStaticMeshDataLODs(
+			UStaticMesh* StaticMesh,
+			const HAPI_NodeId& InNodeId,
+			UStaticMeshComponent* StaticMeshComponent,
+			const bool& DoExportLODs,
+			const bool& DoExportSockets,
+			const bool& DoExportColliders,
+			const bool& bMaterialsAsIndices,
+			bool& bOutUpdated);
+
+		// Creates a new input node and uploads the static mesh's LODs, colliders and sockets to it
+		static bool CreateInputNodeForStaticMeshData(
+			UStaticMesh* StaticMesh,
+			HAPI_NodeId& OutNewNodeId,
+			const FString& InputNodeName,
+			UStaticMeshComponent* StaticMeshComponent,
+			const bool& DoExportLODs,
+			const bool& DoExportSockets,
+			const bool& DoExportColliders,
+			const bool& bMaterialsAsIndices);
+
+		// Uploads a LOD of the static mesh to an input node, using the mesh export method
+		// If InOutStreamHashes is provided, it holds the streams previously uploaded to the node, and receives the new ones.
+		static bool CreateInputNodeForStaticMeshLOD(
+			const HAPI_NodeId& NodeId,
+			UStaticMesh* StaticMesh,
+			const int32& LODIndex,
+			const bool& DoExportLODs,
+			UStaticMeshComponent* StaticMeshComponent,
+			const bool& bMaterialsAsIndices = false,
+			FHoudiniMeshStreamHashes* InOutStreamHashes = nullptr);
 
 		// Convert the Mesh using FStaticMeshLODResources
+		// If bMaterialsAsIndices is true, the materials are sent with CreateHoudiniMeshMaterialIndexAttributes()
+		// If InOutStreamHashes holds valid hashes of the data uploaded to the node, and the LOD's geometry hasn't changed,
+		// only the normals/UVs/colors/materials streams that changed are uploaded, and the rest of the node's geometry is kept.
 		static bool CreateInputNodeForStaticMeshLODResources(
 			const HAPI_NodeId& NodeId,
 			const FStaticMeshLODResources& LODResources,
 			const int32& LODIndex,
 			const bool&	DoExportLODs,
 			UStaticMesh* StaticMesh,
-			UStaticMeshComponent* StaticMeshComponent);
+			UStaticMeshComponent* StaticMeshComponent,
+			const bool& bMaterialsAsIndices = false,
+			FHoudiniMeshStreamHashes* InOutStreamHashes = nullptr);
 
 		// Convert the Mesh using FMeshDescription
 		static bool CreateInputNodeForMeshDescription(
@@ -152,6 +212,28 @@ struct HOUDINIENGINE_API FUnrealMeshTranslator
 		// Clean up the memory allocated by CreateFaceMaterialArray()
 		static void DeleteFaceMaterialArray(TArray<char *> & OutStaticMeshFaceMaterials);
 
+		// Helper function to extract the unique material paths used by a given mesh, and the index of each face's material in them.
+		// Unlike CreateFaceMaterialArray(), this doesn't allocate a string per face.
+		static void CreateFaceMaterialIndexArray(
+			const TArray<UMaterialInterface *>& Materials,
+			const TArray<int32>& FaceMaterialIndices,
+			TArray<FString>& OutMaterialTable,
+			TArray<int32>& OutFaceMaterialTableIndices);
+
+		// Create and set the mesh's material table (detail) and material index (prim) attributes
+		static bool CreateHoudiniMeshMaterialIndexAttributes(
+			const int32 & NodeId,
+			const int32 & PartId,
+			const TArray<FString> & MaterialTable,
+			const TArray<int32> & FaceMaterialTableIndices);
+
+		// Creates a wrangle in the input's OBJ node restoring the per face material attribute from the material table 
+		// and index attributes of the mesh node, so HDAs receive the same attributes as with per face material paths.
+		static bool CreateMaterialIndicesConversionNode(
+			const HAPI_NodeId& InMeshNodeId,
+			const HAPI_NodeId& InParentNodeId,
+			HAPI_NodeId& OutConversionNodeId);
+
 		// Create and set mesh material attribute and material (scalar, vector and texture) parameters attributes
 		static bool CreateHoudiniMeshAttributes(
 			const int32 & NodeId,
@@ -28,6 +28,7 @@
 
 #include "HoudiniEngineEditorPrivatePCH.h"
 #include "HoudiniAsset.h"
+#include "HoudiniAssetLibraryCache.h"
 
 #include "EditorFramework/AssetImportData.h"
 #include "Misc/FileHelper.h"
@@ -193,6 +194,9 @@ UHoudiniAssetFactory::Reimport(UObject * Obj)
 		{
 			HOUDINI_LOG_MESSAGE(TEXT("Houdini Asset reimported successfully."));
 
+			// Make sure the new version of the HDA gets loaded in the sessions
+			FHoudiniAssetLibraryCache::Invalidate(HoudiniAsset);
+
 			if (HoudiniAsset->GetOuter())
 				HoudiniAsset->GetOuter()->MarkPackageDirty();
 			else
@@ -132,6 +132,9 @@ FHoudiniEngineBakeUtils::BakeHoudiniAssetComponent(
 	if (!IsValid(InHACToBake))
 		return false;
 
+	// Any HAPI call made while baking must go to the session of the component
+	FHoudiniEngineSessionScope SessionScope(InHACToBake->GetSessionIndex());
+
 	// Handle proxies: if the output has any current proxies, first refine them
 	bool bHACNeedsToReCook;
 	if (!CheckForAndRefineHoudiniProxyMesh(InHACToBake, bInReplacePreviousBake, InBakeOption, bInRemoveHACOutputOnSuccess, bHACNeedsToReCook))
@@ -241,6 +244,8 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToActors(
 	if (!HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill())
 		return false;
 
+	FHoudiniEngineSessionScope SessionScope(HoudiniAssetComponent->GetSessionIndex());
+
 	AActor* OwnerActor = HoudiniAssetComponent->GetOwner();
 	if (!IsValid(OwnerActor))
 		return false;
@@ -476,6 +481,8 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToFoliage(UHoudiniAssetComponent* Houdi
 	if (!HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill())
 		return false;
 
+	FHoudiniEngineSessionScope SessionScope(HoudiniAssetComponent->GetSessionIndex());
+
 	AActor * OwnerActor = HoudiniAssetComponent->GetOwner();
 	if (!OwnerActor || OwnerActor->IsPendingKill())
 		return false;
@@ -2200,6 +2207,8 @@ FHoudiniEngineBakeUtils::BakeBlueprints(
 	if (!HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill())
 		return false;
 
+	FHoudiniEngineSessionScope SessionScope(HoudiniAssetComponent->GetSessionIndex());
+
 	AActor* OwnerActor = HoudiniAssetComponent->GetOwner();
 	const bool bIsOwnerActorValid = IsValid(OwnerActor);
 	
@@ -4974,6 +4983,8 @@ FHoudiniEngineBakeUtils::CheckForAndRefineHoudiniProxyMesh(
 	{
 		return false;
 	}
+
+	FHoudiniEngineSessionScope SessionScope(InHoudiniAssetComponent->GetSessionIndex());
 		
 	// Handle proxies: if the output has any current proxies, first refine them
 	bOutNeedsReCook = false;
@@ -29,6 +29,7 @@
 #include "HoudiniEngineEditorPrivatePCH.h"
 
 #include "HoudiniEngine.h"
+#include "HoudiniEngineManager.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineBakeUtils.h"
 #include "HoudiniEngineEditorUtils.h"
@@ -150,7 +151,21 @@ FHoudiniEngineCommands::SaveHIPFile()
 		std::string HIPPathConverted(TCHAR_TO_UTF8(*SaveFilenames[0]));
 
 		// Save HIP file through Engine.
-		FHoudiniApi::SaveHIPFile(FHoudiniEngine::Get().GetSession(), HIPPathConverted.c_str(), false);
+		FHoudiniApi::SaveHIPFile(FHoudiniEngine::Get().GetSession(0), HIPPathConverted.c_str(), false);
+
+		// The assets cooked by the other sessions of the pool are saved next to it, in their own HIP file
+		for (int32 SessionIndex = 1; SessionIndex < FHoudiniEngine::Get().GetSessionCount(); SessionIndex++)
+		{
+			const HAPI_Session* PoolSession = FHoudiniEngine::Get().GetSession(SessionIndex);
+			if (!PoolSession)
+				continue;
+
+			FString PoolHIPPath = FPaths::Combine(FPaths::GetPath(SaveFilenames[0]),
+				FString::Printf(TEXT("%s_%d.hip"), *FPaths::GetBaseFilename(SaveFilenames[0]), SessionIndex));
+			std::string PoolHIPPathConverted(TCHAR_TO_UTF8(*PoolHIPPath));
+			if (HAPI_RESULT_SUCCESS == FHoudiniApi::SaveHIPFile(PoolSession, PoolHIPPathConverted.c_str(), false))
+				HOUDINI_LOG_MESSAGE(TEXT("Saved the Houdini scene of session %d to %s"), SessionIndex, *PoolHIPPath);
+		}
 	}
 }
 
@@ -170,9 +185,13 @@ FHoudiniEngineCommands::OpenInHoudini()
 		TEXT("HoudiniEngine"), TEXT(".hip"));
 
 	// Save HIP file through Engine.
+	// Only the main session is opened, the assets cooked by the other sessions of the pool won't be in it
+	if (FHoudiniEngine::Get().GetSessionCount() > 1)
+		HOUDINI_LOG_WARNING(TEXT("Only the main session is opened in Houdini, the assets cooked in the other sessions of the pool are missing."));
+
 	std::string TempPathConverted(TCHAR_TO_UTF8(*UserTempPath));
 	FHoudiniApi::SaveHIPFile(
-		FHoudiniEngine::Get().GetSession(),
+		FHoudiniEngine::Get().GetSession(0),
 		TempPathConverted.c_str(), false);
 
 	if (!FPaths::FileExists(UserTempPath))
@@ -1531,14 +1550,22 @@ FHoudiniEngineCommands::RefineTriagedHoudiniProxyMesehesToStaticMeshes(
 		if (!bInSilent)
 			TaskProgress->MakeDialog(/*bShowCancelButton=*/true);
 
-		// Iterate over the components for which we can build UStaticMesh, and build the meshes
+		// Iterate over the components for which we can build UStaticMesh, and build the meshes.
+		// Outputs already refined by the background refinement queue don't have current proxies anymore and are skipped,
+		// so we only wait for what remains.
+		FHoudiniEngineManager* const EngineManager = FHoudiniEngine::Get().GetHoudiniEngineManager();
 		bool bCancelled = false;
 		for (uint32 ComponentIndex = 0; ComponentIndex < NumComponentsToRefine; ++ComponentIndex)
 		{
 			UHoudiniAssetComponent* HoudiniAssetComponent = InComponentsToRefine[ComponentIndex];
 			TaskProgress->EnterProgressFrame(1.0f);
 			const bool bDestroyProxies = true;
-			FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(HoudiniAssetComponent, bDestroyProxies);
+			{
+				FHoudiniEngineSessionScope SessionScope(HoudiniAssetComponent->GetSessionIndex());
+				FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(HoudiniAssetComponent, bDestroyProxies);
+			}
+			if (EngineManager)
+				EngineManager->DequeueProxyMeshRefinement(HoudiniAssetComponent);
 
 			SuccessfulComponents.Add(HoudiniAssetComponent);
 
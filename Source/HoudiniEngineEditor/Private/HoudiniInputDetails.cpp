@@ -4510,6 +4510,70 @@ FHoudiniInputDetails::AddWorldInputUI(
 		CheckBoxBoundAutoUpdate->SetEnabled(MainInput->IsWorldInputBoundSelector());
 	}
 
+	// Checkbox: Bound Selector Update On Move
+	{
+		// Lambda returning a CheckState from the input's current update on move state
+		auto IsCheckedUpdateOnMove = [](UHoudiniInput* InInput)
+		{
+			if (!InInput || InInput->IsPendingKill())
+				return ECheckBoxState::Unchecked;
+
+			return InInput->GetWorldInputBoundSelectorUpdateOnMove() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+		};
+
+		// Lambda for changing the update on move state
+		auto CheckStateChangedBoundUpdateOnMove = [MainInput](TArray<UHoudiniInput*> InInputsToUpdate, ECheckBoxState NewState)
+		{
+			if (!MainInput || MainInput->IsPendingKill())
+				return;
+
+			// Record a transaction for undo/redo
+			FScopedTransaction Transaction(
+				TEXT(HOUDINI_MODULE_EDITOR),
+				LOCTEXT("HoudiniWorldInputChangeUpdateOnMove", "Houdini Input: Changing bound selector update on move state."),
+				MainInput->GetOuter());
+
+			bool bNewState = (NewState == ECheckBoxState::Checked);
+			for (auto CurInput : InInputsToUpdate)
+			{
+				if (!CurInput || CurInput->IsPendingKill())
+					continue;
+
+				if (CurInput->GetWorldInputBoundSelectorUpdateOnMove() == bNewState)
+					continue;
+
+				CurInput->Modify();
+
+				CurInput->SetWorldInputBoundSelectorUpdateOnMove(bNewState);
+				CurInput->MarkChanged(true);
+			}
+		};
+
+		// Checkbox : Update On Move
+		TSharedPtr< SCheckBox > CheckBoxBoundUpdateOnMove;
+		VerticalBox->AddSlot().Padding(2, 2, 5, 2).AutoHeight()
+		[
+			SAssignNew(CheckBoxBoundUpdateOnMove, SCheckBox)
+			.Content()
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("BoundUpdateOnMove", "Update bound selection when the bounds move"))
+				.ToolTipText(LOCTEXT("BoundUpdateOnMoveTip", "If enabled and if this world input is set as a bound selector, the objects selected by the bounds will update when the bound selectors are moved or resized."))
+				.Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")))
+			]
+			.IsChecked_Lambda([IsCheckedUpdateOnMove, MainInput]()
+			{
+				return IsCheckedUpdateOnMove(MainInput);
+			})
+			.OnCheckStateChanged_Lambda([CheckStateChangedBoundUpdateOnMove, InInputs](ECheckBoxState NewState)
+			{
+				return CheckStateChangedBoundUpdateOnMove(InInputs, NewState);
+			})
+		];
+
+		CheckBoxBoundUpdateOnMove->SetEnabled(MainInput->IsWorldInputBoundSelector());
+	}
+
 	// ActorPicker : Bound Selector
 	if(bIsBoundSelector)
 	{
@@ -2419,6 +2419,7 @@ FHoudiniOutputDetails::CreateInstancerOutputWidget(
 		FHoudiniInstanceTranslator::UpdateVariationAssignements(InOutputToUpdate);
 
 		InOutputToUpdate.MarkChanged(true);
+		UHoudiniAssetComponent::MarkOwnerAsNeedProcessing(InOutput);
 
 		FHoudiniEngineUtils::UpdateEditorProperties(InOutput, true);
 	};
@@ -2439,6 +2440,7 @@ FHoudiniOutputDetails::CreateInstancerOutputWidget(
 		FHoudiniInstanceTranslator::UpdateVariationAssignements(InOutputToUpdate);
 
 		InOutputToUpdate.MarkChanged(true);
+		UHoudiniAssetComponent::MarkOwnerAsNeedProcessing(InOutput);
 
 		FHoudiniEngineUtils::UpdateEditorProperties(InOutput, true);
 	};
@@ -2452,6 +2454,7 @@ FHoudiniOutputDetails::CreateInstancerOutputWidget(
 		InOutputToUpdate.VariationObjects[AtIndex] = InObject;
 
 		InOutputToUpdate.MarkChanged(true);
+		UHoudiniAssetComponent::MarkOwnerAsNeedProcessing(InOutput);
 
 		FHoudiniEngineUtils::UpdateEditorProperties(InOutput, true);
 	};
@@ -2466,6 +2469,7 @@ FHoudiniOutputDetails::CreateInstancerOutputWidget(
 			return;
 
 		InOutputToUpdate.MarkChanged(true);
+		UHoudiniAssetComponent::MarkOwnerAsNeedProcessing(InOutput);
 
 		if (GEditor)
 			GEditor->RedrawAllViewports();
@@ -0,0 +1,482 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniActorBoundsIndex.h"
+
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
+#include "UObject/UObjectGlobals.h"
+
+#if WITH_EDITOR
+	#include "Editor.h"
+#endif
+
+// Size of the index's cells, in cm
+#define HOUDINI_ACTOR_BOUNDS_INDEX_CELL_SIZE 5000.0f
+// Actors covering more cells than this are not added to the cells, but tested by every query
+#define HOUDINI_ACTOR_BOUNDS_INDEX_MAX_ACTOR_CELLS 256
+// Queries covering more cells than this test all the indexed actors instead
+#define HOUDINI_ACTOR_BOUNDS_INDEX_MAX_QUERY_CELLS 65536
+// Cell coordinates are clamped to this value, for huge bounds
+#define HOUDINI_ACTOR_BOUNDS_INDEX_MAX_CELL_COORD 1048576.0f
+
+TMap<TWeakObjectPtr<UWorld>, FHoudiniActorBoundsIndex::FWorldIndex> FHoudiniActorBoundsIndex::WorldIndices;
+FDelegateHandle FHoudiniActorBoundsIndex::ActorAddedHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::ActorDeletedHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::ActorMovedHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::ObjectPropertyChangedHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::LevelAddedHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::LevelRemovedHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::WorldCleanupHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::PostUndoRedoHandle;
+bool FHoudiniActorBoundsIndex::bDelegatesBound = false;
+
+void
+FHoudiniActorBoundsIndex::FindActorsIntersecting(UWorld* InWorld, const TArray<FBox>& InBoxes, TArray<AActor*>& OutActors)
+{
+	if (!InWorld || InWorld->IsPendingKill() || InBoxes.Num() <= 0)
+		return;
+
+	// Tests the actor's current bounds against the boxes
+	auto IntersectsBoxes = [&InBoxes](AActor* InActor)
+	{
+		const FBox ActorBounds = InActor->GetComponentsBoundingBox(true);
+		for (const FBox& CurBox : InBoxes)
+		{
+			if (ActorBounds.Intersect(CurBox))
+				return true;
+		}
+		return false;
+	};
+
+	if (!CanIndexWorld(InWorld))
+	{
+		for (TActorIterator<AActor> ActorItr(InWorld); ActorItr; ++ActorItr)
+		{
+			AActor* CurrentActor = *ActorItr;
+			if (!CurrentActor || CurrentActor->IsPendingKill())
+				continue;
+
+			if (IntersectsBoxes(CurrentActor))
+				OutActors.Add(CurrentActor);
+		}
+		return;
+	}
+
+	BindDelegates();
+
+	FWorldIndex& WorldIndex = WorldIndices.FindOrAdd(InWorld);
+	if (WorldIndex.bDirty)
+		BuildIndex(WorldIndex, InWorld);
+	else
+		UpdateMovedActors(WorldIndex);
+
+	// Gather the actors of the cells covered by the boxes
+	TSet<AActor*> Candidates;
+	bool bTestAllActors = false;
+	for (const FBox& CurBox : InBoxes)
+	{
+		FIntPoint Min, Max;
+		if (GetCellRange(CurBox, Min, Max) > HOUDINI_ACTOR_BOUNDS_INDEX_MAX_QUERY_CELLS)
+		{
+			bTestAllActors = true;
+			break;
+		}
+
+		for (int32 X = Min.X; X <= Max.X; X++)
+		{
+			for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+			{
+				const TArray<TWeakObjectPtr<AActor>>* CellActors = WorldIndex.Cells.Find(FIntPoint(X, Y));
+				if (!CellActors)
+					continue;
+
+				for (const TWeakObjectPtr<AActor>& CurActor : *CellActors)
+				{
+					if (CurActor.IsValid())
+						Candidates.Add(CurActor.Get());
+				}
+			}
+		}
+	}
+
+	if (bTestAllActors)
+	{
+		for (auto& Pair : WorldIndex.ActorCells)
+		{
+			if (Pair.Key.IsValid())
+				Candidates.Add(Pair.Key.Get());
+		}
+	}
+	else
+	{
+		for (const TWeakObjectPtr<AActor>& CurActor : WorldIndex.LargeActors)
+		{
+			if (CurActor.IsValid())
+				Candidates.Add(CurActor.Get());
+		}
+	}
+
+	// The indexed bounds might be out of date if a change wasn't broadcast, test the current ones
+	for (AActor* CurrentActor : Candidates)
+	{
+		if (CurrentActor->IsPendingKill())
+			continue;
+
+		if (IntersectsBoxes(CurrentActor))
+			OutActors.Add(CurrentActor);
+	}
+}
+
+void
+FHoudiniActorBoundsIndex::MarkDirty(UWorld* InWorld)
+{
+	FWorldIndex* WorldIndex = WorldIndices.Find(InWorld);
+	if (WorldIndex)
+		WorldIndex->bDirty = true;
+}
+
+void
+FHoudiniActorBoundsIndex::Empty()
+{
+	for (auto& Pair : WorldIndices)
+		ClearIndex(Pair.Value);
+	WorldIndices.Empty();
+
+	if (!bDelegatesBound)
+		return;
+
+#if WITH_EDITOR
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnActorMoved().Remove(ActorMovedHandle);
+	}
+
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+	FEditorDelegates::PostUndoRedo.Remove(PostUndoRedoHandle);
+#endif
+
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+
+	bDelegatesBound = false;
+}
+
+bool
+FHoudiniActorBoundsIndex::CanIndexWorld(UWorld* InWorld)
+{
+#if WITH_EDITOR
+	// Actor moves are only broadcast for editor worlds
+	return GEngine && InWorld && !InWorld->IsGameWorld();
+#else
+	return false;
+#endif
+}
+
+int64
+FHoudiniActorBoundsIndex::GetCellRange(const FBox& InBox, FIntPoint& OutMin, FIntPoint& OutMax)
+{
+	auto ToCell = [](const float& InValue)
+	{
+		return FMath::FloorToInt(FMath::Clamp(
+			InValue / HOUDINI_ACTOR_BOUNDS_INDEX_CELL_SIZE,
+			-HOUDINI_ACTOR_BOUNDS_INDEX_MAX_CELL_COORD, HOUDINI_ACTOR_BOUNDS_INDEX_MAX_CELL_COORD));
+	};
+
+	OutMin = FIntPoint(ToCell(InBox.Min.X), ToCell(InBox.Min.Y));
+	OutMax = FIntPoint(FMath::Max(OutMin.X, ToCell(InBox.Max.X)), FMath::Max(OutMin.Y, ToCell(InBox.Max.Y)));
+
+	return (int64)(OutMax.X - OutMin.X + 1) * (int64)(OutMax.Y - OutMin.Y + 1);
+}
+
+void
+FHoudiniActorBoundsIndex::BuildIndex(FWorldIndex& InWorldIndex, UWorld* InWorld)
+{
+	ClearIndex(InWorldIndex);
+
+	for (TActorIterator<AActor> ActorItr(InWorld); ActorItr; ++ActorItr)
+		AddActor(InWorldIndex, *ActorItr);
+
+	InWorldIndex.bDirty = false;
+}
+
+void
+FHoudiniActorBoundsIndex::ClearIndex(FWorldIndex& InWorldIndex)
+{
+	for (auto& Pair : InWorldIndex.ActorCells)
+	{
+		USceneComponent* RootComponent = Pair.Value.RootComponent.Get();
+		if (RootComponent)
+			RootComponent->TransformUpdated.Remove(Pair.Value.TransformUpdatedHandle);
+	}
+
+	InWorldIndex.Cells.Empty();
+	InWorldIndex.LargeActors.Empty();
+	InWorldIndex.ActorCells.Empty();
+	InWorldIndex.MovedActors.Empty();
+}
+
+void
+FHoudiniActorBoundsIndex::UpdateMovedActors(FWorldIndex& InWorldIndex)
+{
+	if (InWorldIndex.MovedActors.Num() <= 0)
+		return;
+
+	TArray<TWeakObjectPtr<AActor>> MovedActors = InWorldIndex.MovedActors.Array();
+	InWorldIndex.MovedActors.Empty();
+	for (const TWeakObjectPtr<AActor>& MovedActor : MovedActors)
+	{
+		if (MovedActor.IsValid())
+			UpdateActor(MovedActor.Get());
+	}
+}
+
+void
+FHoudiniActorBoundsIndex::AddActor(FWorldIndex& InWorldIndex, AActor* InActor)
+{
+	if (!InActor || InActor->IsPendingKill())
+		return;
+
+	FActorCells ActorCells;
+	const int64 NumCells = GetCellRange(InActor->GetComponentsBoundingBox(true), ActorCells.Min, ActorCells.Max);
+	ActorCells.bLarge = NumCells > HOUDINI_ACTOR_BOUNDS_INDEX_MAX_ACTOR_CELLS;
+
+	// Track the moves of the actor, including the ones that aren't broadcast by the editor
+	USceneComponent* RootComponent = InActor->GetRootComponent();
+	if (RootComponent)
+	{
+		ActorCells.RootComponent = RootComponent;
+		ActorCells.TransformUpdatedHandle = RootComponent->TransformUpdated.AddStatic(&FHoudiniActorBoundsIndex::OnRootComponentTransformUpdated);
+	}
+
+	if (ActorCells.bLarge)
+	{
+		InWorldIndex.LargeActors.Add(InActor);
+	}
+	else
+	{
+		for (int32 X = ActorCells.Min.X; X <= ActorCells.Max.X; X++)
+		{
+			for (int32 Y = ActorCells.Min.Y; Y <= ActorCells.Max.Y; Y++)
+				InWorldIndex.Cells.FindOrAdd(FIntPoint(X, Y)).Add(InActor);
+		}
+	}
+
+	InWorldIndex.ActorCells.Add(InActor, ActorCells);
+}
+
+void
+FHoudiniActorBoundsIndex::RemoveActor(FWorldIndex& InWorldIndex, AActor* InActor)
+{
+	FActorCells ActorCells;
+	if (!InWorldIndex.ActorCells.RemoveAndCopyValue(InActor, ActorCells))
+		return;
+
+	USceneComponent* RootComponent = ActorCells.RootComponent.Get();
+	if (RootComponent)
+		RootComponent->TransformUpdated.Remove(ActorCells.TransformUpdatedHandle);
+
+	const TWeakObjectPtr<AActor> ActorPtr(InActor);
+	InWorldIndex.MovedActors.Remove(ActorPtr);
+	if (ActorCells.bLarge)
+	{
+		InWorldIndex.LargeActors.RemoveSingleSwap(ActorPtr);
+		return;
+	}
+
+	for (int32 X = ActorCells.Min.X; X <= ActorCells.Max.X; X++)
+	{
+		for (int32 Y = ActorCells.Min.Y; Y <= ActorCells.Max.Y; Y++)
+		{
+			const FIntPoint Cell(X, Y);
+			TArray<TWeakObjectPtr<AActor>>* CellActors = InWorldIndex.Cells.Find(Cell);
+			if (!CellActors)
+				continue;
+
+			CellActors->RemoveSingleSwap(ActorPtr);
+			if (CellActors->Num() <= 0)
+				InWorldIndex.Cells.Remove(Cell);
+		}
+	}
+}
+
+void
+FHoudiniActorBoundsIndex::UpdateActor(AActor* InActor)
+{
+	if (!InActor)
+		return;
+
+	FWorldIndex* WorldIndex = WorldIndices.Find(InActor->GetWorld());
+	if (!WorldIndex || WorldIndex->bDirty)
+		return;
+
+	// Nothing to do if the actor still covers the same cells, and still has the same root component
+	const FActorCells* ActorCells = WorldIndex->ActorCells.Find(InActor);
+	if (ActorCells && !InActor->IsPendingKill() && ActorCells->RootComponent.Get() == InActor->GetRootComponent())
+	{
+		FIntPoint Min, Max;
+		GetCellRange(InActor->GetComponentsBoundingBox(true), Min, Max);
+		if (Min == ActorCells->Min && Max == ActorCells->Max)
+			return;
+	}
+
+	RemoveActor(*WorldIndex, InActor);
+	AddActor(*WorldIndex, InActor);
+}
+
+void
+FHoudiniActorBoundsIndex::UpdateActorAndAttachedActors(AActor* InActor)
+{
+	if (!InActor)
+		return;
+
+	// Moving an actor also moves the actors attached to it, without broadcasting their moves
+	TArray<AActor*> Actors;
+	Actors.Add(InActor);
+	for (int32 Index = 0; Index < Actors.Num(); Index++)
+	{
+		AActor* CurrentActor = Actors[Index];
+		UpdateActor(CurrentActor);
+		CurrentActor->GetAttachedActors(Actors, false);
+	}
+}
+
+void
+FHoudiniActorBoundsIndex::BindDelegates()
+{
+	if (bDelegatesBound)
+		return;
+
+#if WITH_EDITOR
+	if (GEngine)
+	{
+		ActorAddedHandle = GEngine->OnLevelActorAdded().AddStatic(&FHoudiniActorBoundsIndex::OnActorAdded);
+		ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddStatic(&FHoudiniActorBoundsIndex::OnActorDeleted);
+		ActorMovedHandle = GEngine->OnActorMoved().AddStatic(&FHoudiniActorBoundsIndex::OnActorMoved);
+	}
+
+	// Catches the bounds changes that aren't moves (components added, meshes changed...)
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&FHoudiniActorBoundsIndex::OnObjectPropertyChanged);
+
+	// Undo/redo can move, add and remove actors without broadcasting it
+	PostUndoRedoHandle = FEditorDelegates::PostUndoRedo.AddStatic(&FHoudiniActorBoundsIndex::OnPostUndoRedo);
+#endif
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddStatic(&FHoudiniActorBoundsIndex::OnLevelAddedOrRemoved);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddStatic(&FHoudiniActorBoundsIndex::OnLevelAddedOrRemoved);
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&FHoudiniActorBoundsIndex::OnWorldCleanup);
+
+	bDelegatesBound = true;
+}
+
+void
+FHoudiniActorBoundsIndex::OnActorAdded(AActor* InActor)
+{
+	UpdateActor(InActor);
+}
+
+void
+FHoudiniActorBoundsIndex::OnActorDeleted(AActor* InActor)
+{
+	if (!InActor)
+		return;
+
+	FWorldIndex* WorldIndex = WorldIndices.Find(InActor->GetWorld());
+	if (WorldIndex && !WorldIndex->bDirty)
+		RemoveActor(*WorldIndex, InActor);
+}
+
+void
+FHoudiniActorBoundsIndex::OnActorMoved(AActor* InActor)
+{
+	UpdateActorAndAttachedActors(InActor);
+}
+
+void
+FHoudiniActorBoundsIndex::OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InPropertyChangedEvent)
+{
+	AActor* Actor = Cast<AActor>(InObject);
+	if (!Actor)
+	{
+		UActorComponent* Component = Cast<UActorComponent>(InObject);
+		Actor = Component ? Component->GetOwner() : nullptr;
+	}
+
+	// Only update actors that are already indexed, new actors are added via OnActorAdded
+	if (!Actor)
+		return;
+
+	FWorldIndex* WorldIndex = WorldIndices.Find(Actor->GetWorld());
+	if (WorldIndex && WorldIndex->ActorCells.Contains(Actor))
+		UpdateActorAndAttachedActors(Actor);
+}
+
+void
+FHoudiniActorBoundsIndex::OnLevelAddedOrRemoved(ULevel* InLevel, UWorld* InWorld)
+{
+	MarkDirty(InWorld);
+}
+
+void
+FHoudiniActorBoundsIndex::OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources)
+{
+	FWorldIndex* WorldIndex = WorldIndices.Find(InWorld);
+	if (WorldIndex)
+		ClearIndex(*WorldIndex);
+
+	WorldIndices.Remove(InWorld);
+}
+
+void
+FHoudiniActorBoundsIndex::OnRootComponentTransformUpdated(USceneComponent* InRootComponent, EUpdateTransformFlags InUpdateTransformFlags, ETeleportType InTeleport)
+{
+	// Transforms can be updated during parallel tasks, the index is only accessed from the game thread
+	if (!InRootComponent || !IsInGameThread())
+		return;
+
+	// Only flag the actor here, as the transform can be updated many times per frame
+	AActor* Owner = InRootComponent->GetOwner();
+	FWorldIndex* WorldIndex = Owner ? WorldIndices.Find(Owner->GetWorld()) : nullptr;
+	if (WorldIndex && !WorldIndex->bDirty)
+		WorldIndex->MovedActors.Add(Owner);
+}
+
+void
+FHoudiniActorBoundsIndex::OnPostUndoRedo()
+{
+	// The transaction doesn't tell which worlds were modified
+	for (auto& Pair : WorldIndices)
+		Pair.Value.bDirty = true;
+}
@@ -0,0 +1,137 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UWorld;
+class ULevel;
+class UObject;
+class USceneComponent;
+struct FPropertyChangedEvent;
+enum class EUpdateTransformFlags : int32;
+enum class ETeleportType : uint8;
+
+// Spatial index of the actors' bounds, used by the world inputs' bound selectors to find the actors 
+// intersecting their bounds without iterating on (and computing the bounds of) all the actors of the world.
+//
+// The actors' bounds are stored in a sparse 2D grid (on X/Y) per world, actors spanning too many cells are
+// kept in a list that is always tested. The index of a world is built on its first query, then kept up to date 
+// from the engine's actor added/deleted/moved delegates, and rebuilt when levels are added or removed or after an undo/redo.
+// Moves that aren't broadcast (scripts, sequencer, attached actors...) are caught with the TransformUpdated event of the
+// indexed actors' root components: the moved actors are flagged, and updated before the next query.
+// Actor moves are only broadcast in the editor, so game worlds are still scanned entirely.
+// Should only be used on the game thread.
+class HOUDINIENGINERUNTIME_API FHoudiniActorBoundsIndex
+{
+	public:
+
+		// Appends the actors of the world whose components bounds intersect one of the boxes.
+		static void FindActorsIntersecting(UWorld* InWorld, const TArray<FBox>& InBoxes, TArray<AActor*>& OutActors);
+
+		// Forces the index of a world to be rebuilt on its next query.
+		static void MarkDirty(UWorld* InWorld);
+
+		// Removes all the indices and unbinds the delegates, needs to be called when the module shuts down.
+		static void Empty();
+
+	private:
+
+		// Range of cells covered by an actor
+		struct FActorCells
+		{
+			FIntPoint Min = FIntPoint::ZeroValue;
+			FIntPoint Max = FIntPoint::ZeroValue;
+			bool bLarge = false;
+			// Root component whose transform updates are tracked
+			TWeakObjectPtr<USceneComponent> RootComponent;
+			FDelegateHandle TransformUpdatedHandle;
+		};
+
+		struct FWorldIndex
+		{
+			// Actors overlapping each cell
+			TMap<FIntPoint, TArray<TWeakObjectPtr<AActor>>> Cells;
+			// Actors spanning too many cells to be added to them
+			TArray<TWeakObjectPtr<AActor>> LargeActors;
+			// Cells of each indexed actor
+			TMap<TWeakObjectPtr<AActor>, FActorCells> ActorCells;
+			// Indicates the index needs to be rebuilt
+			bool bDirty = true;
+			// Actors whose root component moved since the last query
+			TSet<TWeakObjectPtr<AActor>> MovedActors;
+		};
+
+		// Returns true if the actors of this world can be indexed
+		static bool CanIndexWorld(UWorld* InWorld);
+
+		// Returns the number of cells covered by a box
+		static int64 GetCellRange(const FBox& InBox, FIntPoint& OutMin, FIntPoint& OutMax);
+
+		static void BuildIndex(FWorldIndex& InWorldIndex, UWorld* InWorld);
+
+		// Removes all the actors of an index, and stops tracking their root components
+		static void ClearIndex(FWorldIndex& InWorldIndex);
+
+		// Updates the cells of the actors flagged as moved
+		static void UpdateMovedActors(FWorldIndex& InWorldIndex);
+
+		static void AddActor(FWorldIndex& InWorldIndex, AActor* InActor);
+		static void RemoveActor(FWorldIndex& InWorldIndex, AActor* InActor);
+
+		// Updates the cells of an actor of an indexed world
+		static void UpdateActor(AActor* InActor);
+
+		// Updates the cells of an actor and of all the actors attached to it, recursively
+		static void UpdateActorAndAttachedActors(AActor* InActor);
+
+		static void BindDelegates();
+
+		// Delegate handlers
+		static void OnActorAdded(AActor* InActor);
+		static void OnActorDeleted(AActor* InActor);
+		static void OnActorMoved(AActor* InActor);
+		static void OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InPropertyChangedEvent);
+		static void OnLevelAddedOrRemoved(ULevel* InLevel, UWorld* InWorld);
+		static void OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources);
+		static void OnPostUndoRedo();
+		static void OnRootComponentTransformUpdated(USceneComponent* InRootComponent, EUpdateTransformFlags InUpdateTransformFlags, ETeleportType InTeleport);
+
+		// Index of each world
+		static TMap<TWeakObjectPtr<UWorld>, FWorldIndex> WorldIndices;
+
+		static FDelegateHandle ActorAddedHandle;
+		static FDelegateHandle ActorDeletedHandle;
+		static FDelegateHandle ActorMovedHandle;
+		static FDelegateHandle ObjectPropertyChangedHandle;
+		static FDelegateHandle LevelAddedHandle;
+		static FDelegateHandle LevelRemovedHandle;
+		static FDelegateHandle WorldCleanupHandle;
+		static FDelegateHandle PostUndoRedoHandle;
+		static bool bDelegatesBound;
+};
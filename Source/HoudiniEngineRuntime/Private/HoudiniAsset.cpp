@@ -28,6 +28,7 @@
 #include "HoudiniPluginSerializationVersion.h"
 
 #include "Misc/Paths.h"
+#include "Hash/CityHash.h"
 #include "HAL/UnrealMemory.h"
 
 UHoudiniAsset::UHoudiniAsset(const FObjectInitializer & ObjectInitializer)
@@ -37,12 +38,14 @@ UHoudiniAsset::UHoudiniAsset(const FObjectInitializer & ObjectInitializer)
 	, bAssetLimitedCommercial(false)
 	, bAssetNonCommercial(false)
 	, bAssetExpanded(false)
+	, AssetBytesHash(0)
 {}
 
 void
 UHoudiniAsset::CreateAsset(const uint8 * BufferStart, const uint8 * BufferEnd, const FString & InFileName)
 {
 	AssetFileName = InFileName;
+	AssetBytesHash = 0;
 
 	// Calculate buffer size.
 	AssetBytesCount = BufferEnd - BufferStart;
@@ -108,6 +111,15 @@ UHoudiniAsset::GetAssetBytesCount() const
 	return AssetBytesCount;
 }
 
+uint64
+UHoudiniAsset::GetAssetBytesHash() const
+{
+	if (AssetBytesHash == 0 && AssetBytes.Num() > 0)
+		AssetBytesHash = CityHash64(reinterpret_cast<const char*>(AssetBytes.GetData()), AssetBytes.Num());
+
+	return AssetBytesHash;
+}
+
 void
 UHoudiniAsset::Serialize(FArchive & Ar)
 {
@@ -115,6 +127,10 @@ UHoudiniAsset::Serialize(FArchive & Ar)
 	Super::Serialize(Ar);
 	Ar.UsingCustomVersion(FHoudiniCustomSerializationVersion::GUID);
 
+	// The raw data might have changed, the hash will be recomputed when needed
+	if (Ar.IsLoading())
+		AssetBytesHash = 0;
+
 	// Get the version
 	uint32 HoudiniAssetVersion = Ar.CustomVer(FHoudiniCustomSerializationVersion::GUID);
 
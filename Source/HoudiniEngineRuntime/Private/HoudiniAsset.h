@@ -55,6 +55,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
 		// Return the size in bytes of raw Houdini OTL data.
 		uint32 GetAssetBytesCount() const;
 
+		// Return a hash of the raw Houdini OTL data, computed on first use.
+		uint64 GetAssetBytesHash() const;
+
 		// Return true if this asset is a limited commercial asset.
 		bool IsAssetLimitedCommercial() const;
 
@@ -101,4 +104,7 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
 		// Indicates if this is an expanded HDA file
 		UPROPERTY()
 		bool bAssetExpanded;
+
+		// Hash of the raw HDA data, 0 until computed.
+		mutable uint64 AssetBytesHash;
 };
\ No newline at end of file
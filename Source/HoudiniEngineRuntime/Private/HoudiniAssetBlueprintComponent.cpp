@@ -1670,6 +1670,7 @@ UHoudiniAssetBlueprintComponent::ApplyComponentInstanceData(FHoudiniAssetBluepri
 		bHasRegisteredComponentTemplate = InstanceData->bRegisteredComponentTemplate;
 
 		AssetState = InstanceData->AssetState;
+		MarkAsNeedProcessing();
 		
 		SetCanDeleteHoudiniNodes(false);
 
@@ -1794,6 +1795,7 @@ UHoudiniAssetBlueprintComponent::OnFullyLoaded()
 			// The HoudiniAsset has changed, so we need to force the PreviewInstance to re-instantiate
 			AssetState = EHoudiniAssetState::NeedInstantiation;
 			bForceNeedUpdate = true;
+			MarkAsNeedProcessing();
 			bHoudiniAssetChanged = false;
 			// TODO: Make this better?
 			CachedTemplateComponent->bHoudiniAssetChanged = false;
@@ -2021,6 +2023,7 @@ UHoudiniAssetBlueprintComponent::OnTemplateParametersChangedHandler(UHoudiniAsse
 		// to trigger an HDA update) so we are going to force NeedUpdate() to return true
 		// in order to get an initial cook.
 		bForceNeedUpdate = true;
+		MarkAsNeedProcessing();
 	}
 
 	bUpdatedFromTemplate = true;
@@ -2044,7 +2047,7 @@ UHoudiniAssetBlueprintComponent::InvalidateData()
 			Input->InvalidateData();
 		}
 
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(AssetId, true);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(AssetId, true, SessionIndex);
 		AssetId = -1;
 	}
 }
@@ -614,6 +614,7 @@ UHoudiniAssetComponent::UHoudiniAssetComponent(const FObjectInitializer & Object
 	bCookOnAssetInputCook = true;
 
 	AssetId = -1;
+	SessionIndex = 0;
 	AssetState = EHoudiniAssetState::PreInstantiation;
 	AssetStateResult = EHoudiniAssetStateResult::None;
 	AssetCookCount = 0;
@@ -1154,6 +1155,7 @@ UHoudiniAssetComponent::NeedsToWaitForInputHoudiniAssets()
 			{
 				// Tell the input HAC to instantiate
 				InputHAC->AssetState = EHoudiniAssetState::PreInstantiation;
+				InputHAC->MarkAsNeedProcessing();
 
 				// We need to wait
 				return true;
@@ -1224,6 +1226,8 @@ UHoudiniAssetComponent::MarkAsNeedCook()
 
 	// Clear the static mesh bake timer
 	ClearRefineMeshesTimer();
+
+	MarkAsNeedProcessing();
 }
 
 void
@@ -1273,6 +1277,8 @@ UHoudiniAssetComponent::MarkAsNeedRebuild()
 
 	// Clear the static mesh bake timer
 	ClearRefineMeshesTimer();
+
+	MarkAsNeedProcessing();
 }
 
 // Marks the asset as needing to be instantiated
@@ -1339,16 +1345,52 @@ UHoudiniAssetComponent::MarkAsNeedInstantiation()
 
 	// Clear the static mesh bake timer
 	ClearRefineMeshesTimer();
+
+	MarkAsNeedProcessing();
 }
 
 void UHoudiniAssetComponent::MarkAsBlueprintStructureModified()
 {
 	bBlueprintStructureModified = true;
+	MarkAsNeedProcessing();
 }
 
 void UHoudiniAssetComponent::MarkAsBlueprintModified()
 {
 	bBlueprintModified = true;
+	MarkAsNeedProcessing();
+}
+
+void
+UHoudiniAssetComponent::MarkAsNeedProcessing()
+{
+	if (FHoudiniEngineRuntime::IsInitialized())
+		FHoudiniEngineRuntime::Get().MarkHoudiniComponentForProcessing(this);
+}
+
+void
+UHoudiniAssetComponent::MarkOwnerAsNeedProcessing(UObject* InObject)
+{
+	if (!IsValid(InObject))
+		return;
+
+	// Components (curves, handles...) are attached to their HAC
+	USceneComponent* SceneComponent = Cast<USceneComponent>(InObject);
+	while (SceneComponent)
+	{
+		UHoudiniAssetComponent* HAC = Cast<UHoudiniAssetComponent>(SceneComponent);
+		if (HAC)
+		{
+			HAC->MarkAsNeedProcessing();
+			return;
+		}
+		SceneComponent = SceneComponent->GetAttachParent();
+	}
+
+	// Parameters, inputs and outputs are outered to their HAC
+	UHoudiniAssetComponent* OuterHAC = InObject->GetTypedOuter<UHoudiniAssetComponent>();
+	if (OuterHAC)
+		OuterHAC->MarkAsNeedProcessing();
 }
 
 void
@@ -2219,7 +2261,11 @@ UHoudiniAssetComponent::SetHasComponentTransformChanged(const bool& InHasChanged
 	// Only update the value if we're fully loaded
 	// This avoid triggering a recook when loading a level
 	if(bFullyLoaded)
+	{
 		bHasComponentTransformChanged = InHasChanged;
+		if (InHasChanged)
+			MarkAsNeedProcessing();
+	}
 }
 
 void
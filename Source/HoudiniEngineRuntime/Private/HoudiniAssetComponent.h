@@ -217,6 +217,7 @@ public:
 	//------------------------------------------------------------------------------------------------
 	UHoudiniAsset * GetHoudiniAsset() const;
 	int32 GetAssetId() const { return AssetId; };
+	int32 GetSessionIndex() const { return SessionIndex; };
 	EHoudiniAssetState GetAssetState() const { return AssetState; };
 	FString GetAssetStateAsString() const { return FHoudiniEngineRuntimeUtils::EnumToString(TEXT("EHoudiniAssetState"), GetAssetState()); };
 	EHoudiniAssetStateResult GetAssetStateResult() const { return AssetStateResult; };
@@ -310,13 +311,17 @@ public:
 	void MarkAsBlueprintStructureModified();
 	// The blueprint has been modified but not structurally changed.
 	void MarkAsBlueprintModified();
+	// Marks the asset as needing to be processed on the next manager tick
+	void MarkAsNeedProcessing();
+	// Marks the HAC owning the given parameter/input/output or component as needing to be processed
+	static void MarkOwnerAsNeedProcessing(UObject* InObject);
 
 	//
 	void SetAssetCookCount(const int32& InCount) { AssetCookCount = InCount; };
 	//
-	void SetRecookRequested(const bool& InRecook) { bRecookRequested = InRecook; };
+	void SetRecookRequested(const bool& InRecook) { bRecookRequested = InRecook; if (InRecook) MarkAsNeedProcessing(); };
 	//
-	void SetRebuildRequested(const bool& InRebuild) { bRebuildRequested = InRebuild; };
+	void SetRebuildRequested(const bool& InRebuild) { bRebuildRequested = InRebuild; if (InRebuild) MarkAsNeedProcessing(); };
 	//
 	void SetHasComponentTransformChanged(const bool& InHasChanged);
 
@@ -591,6 +596,10 @@ protected:
 	UPROPERTY(DuplicateTransient)
 	int32 AssetId;
 
+	// Index of the Houdini Engine session (in the session pool) the asset is instantiated in.
+	UPROPERTY(Transient, DuplicateTransient)
+	int32 SessionIndex;
+
 	// List of dependent downstream HACs that have us as an asset input
 	UPROPERTY(DuplicateTransient)
 	TSet<UHoudiniAssetComponent*> DownstreamHoudiniAssets;
@@ -29,6 +29,7 @@
 #include "HoudiniRuntimeSettings.h"
 
 #include "HoudiniAssetComponent.h"
+#include "HoudiniActorBoundsIndex.h"
 
 #include "Modules/ModuleManager.h"
 
@@ -72,6 +73,8 @@ void FHoudiniEngineRuntime::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FHoudiniActorBoundsIndex::Empty();
+
 	FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = nullptr;
 }
 
@@ -172,24 +175,70 @@ FHoudiniEngineRuntime::RegisterHoudiniComponent(UHoudiniAssetComponent* HAC, boo
 	{
 		FScopeLock ScopeLock(&CriticalSection);
 		RegisteredHoudiniComponents.Add(HAC);
+		HoudiniComponentsToProcess.Add(HAC);
 	}
 
 	HAC->NotifyHoudiniRegisterCompleted();
 }
 
 
+void
+FHoudiniEngineRuntime::MarkHoudiniComponentForProcessing(UHoudiniAssetComponent* HAC)
+{
+	if (!HAC || HAC->IsPendingKill())
+		return;
+
+	FScopeLock ScopeLock(&CriticalSection);
+	HoudiniComponentsToProcess.Add(HAC);
+}
+
+
+void
+FHoudiniEngineRuntime::MarkAllHoudiniComponentsForProcessing()
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	HoudiniComponentsToProcess.Append(RegisteredHoudiniComponents);
+}
+
+
+void
+FHoudiniEngineRuntime::ConsumeHoudiniComponentsMarkedForProcessing(TSet<TWeakObjectPtr<UHoudiniAssetComponent>>& OutComponents)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	OutComponents.Append(HoudiniComponentsToProcess);
+	HoudiniComponentsToProcess.Empty();
+}
+
+
 void 
-FHoudiniEngineRuntime::MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent)
+FHoudiniEngineRuntime::MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent, const int32& InSessionIndex)
 {
 	if (InNodeId >= 0) 
 	{
 		// FDebug::DumpStackTraceToLog();
+		FScopeLock ScopeLock(&CriticalSection);
 
-		NodeIdsPendingDelete.AddUnique(InNodeId);
+		// Node ids are only unique within a session
+		bool bAlreadyPending = false;
+		for (int32 Idx = 0; Idx < NodeIdsPendingDelete.Num(); Idx++)
+		{
+			if (NodeIdsPendingDelete[Idx] == InNodeId && NodeIdsPendingDeleteSessionIndices[Idx] == InSessionIndex)
+			{
+				bAlreadyPending = true;
+				break;
+			}
+		}
 
-		if (bDeleteParent)
+		if (!bAlreadyPending)
 		{
-			NodeIdsParentPendingDelete.AddUnique(InNodeId);
+			NodeIdsPendingDelete.Add(InNodeId);
+			NodeIdsPendingDeleteSessionIndices.Add(InSessionIndex);
+		}
+
+		if (bDeleteParent && !IsParentNodePendingDelete(InNodeId, InSessionIndex))
+		{
+			NodeIdsParentPendingDelete.Add(InNodeId);
+			NodeIdsParentPendingDeleteSessionIndices.Add(InSessionIndex);
 		}
 	}
 }
@@ -232,7 +281,7 @@ FHoudiniEngineRuntime::UnRegisterHoudiniComponent(const int32& ValidIndex)
 		UHoudiniAssetComponent* HAC = Ptr.Get();
 		if (HAC && HAC->CanDeleteHoudiniNodes())
 		{
-			MarkNodeIdAsPendingDelete(HAC->GetAssetId(), true);
+			MarkNodeIdAsPendingDelete(HAC->GetAssetId(), true, HAC->GetSessionIndex());
 		}
 	}
 	
@@ -267,6 +316,21 @@ FHoudiniEngineRuntime::GetNodeIdsPendingDeleteAt(const int32& Index)
 }
 
 
+int32
+FHoudiniEngineRuntime::GetNodeIdsPendingDeleteSessionIndexAt(const int32& Index)
+{
+	if (!IsInitialized())
+		return 0;
+
+	FScopeLock ScopeLock(&CriticalSection);
+
+	if (!NodeIdsPendingDeleteSessionIndices.IsValidIndex(Index))
+		return 0;
+
+	return NodeIdsPendingDeleteSessionIndices[Index];
+}
+
+
 void
 FHoudiniEngineRuntime::RemoveNodeIdPendingDeleteAt(const int32& Index)
 {
@@ -278,21 +342,63 @@ FHoudiniEngineRuntime::RemoveNodeIdPendingDeleteAt(const int32& Index)
 		return;
 
 	NodeIdsPendingDelete.RemoveAt(Index);
+	NodeIdsPendingDeleteSessionIndices.RemoveAt(Index);
 }
 
 
 bool 
-FHoudiniEngineRuntime::IsParentNodePendingDelete(const int32& NodeId) 
+FHoudiniEngineRuntime::IsParentNodePendingDelete(const int32& NodeId, const int32& InSessionIndex) 
 {
-	return NodeIdsParentPendingDelete.Contains(NodeId);
+	FScopeLock ScopeLock(&CriticalSection);
+
+	for (int32 Idx = 0; Idx < NodeIdsParentPendingDelete.Num(); Idx++)
+	{
+		if (NodeIdsParentPendingDelete[Idx] == NodeId && NodeIdsParentPendingDeleteSessionIndices[Idx] == InSessionIndex)
+			return true;
+	}
+
+	return false;
 }
 
 
 void 
-FHoudiniEngineRuntime::RemoveParentNodePendingDelete(const int32& NodeId) 
+FHoudiniEngineRuntime::RemoveParentNodePendingDelete(const int32& NodeId, const int32& InSessionIndex) 
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	for (int32 Idx = NodeIdsParentPendingDelete.Num() - 1; Idx >= 0; Idx--)
+	{
+		if (NodeIdsParentPendingDelete[Idx] == NodeId && NodeIdsParentPendingDeleteSessionIndices[Idx] == InSessionIndex)
+		{
+			NodeIdsParentPendingDelete.RemoveAt(Idx);
+			NodeIdsParentPendingDeleteSessionIndices.RemoveAt(Idx);
+		}
+	}
+}
+
+
+void
+FHoudiniEngineRuntime::RemoveNodeIdsPendingDeleteInSession(const int32& InSessionIndex)
 {
-	if (NodeIdsParentPendingDelete.Contains(NodeId))
-		NodeIdsParentPendingDelete.Remove(NodeId);
+	FScopeLock ScopeLock(&CriticalSection);
+
+	for (int32 Idx = NodeIdsPendingDelete.Num() - 1; Idx >= 0; Idx--)
+	{
+		if (NodeIdsPendingDeleteSessionIndices[Idx] != InSessionIndex)
+			continue;
+
+		NodeIdsPendingDelete.RemoveAt(Idx);
+		NodeIdsPendingDeleteSessionIndices.RemoveAt(Idx);
+	}
+
+	for (int32 Idx = NodeIdsParentPendingDelete.Num() - 1; Idx >= 0; Idx--)
+	{
+		if (NodeIdsParentPendingDeleteSessionIndices[Idx] != InSessionIndex)
+			continue;
+
+		NodeIdsParentPendingDelete.RemoveAt(Idx);
+		NodeIdsParentPendingDeleteSessionIndices.RemoveAt(Idx);
+	}
 }
 
 
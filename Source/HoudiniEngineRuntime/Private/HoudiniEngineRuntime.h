@@ -66,19 +66,33 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		UHoudiniAssetComponent* GetRegisteredHoudiniComponentAt(const int32& Index);
 
 		virtual TArray<TWeakObjectPtr<UHoudiniAssetComponent>>* GetRegisteredHoudiniComponents() { return &RegisteredHoudiniComponents; };
+
+		// Components that have to be processed by the manager on its next tick:
+		// newly registered components, and components that have been modified since they were last processed.
+		// Idle components that are not marked are not visited by the manager.
+		void MarkHoudiniComponentForProcessing(UHoudiniAssetComponent* HAC);
+		void MarkAllHoudiniComponentsForProcessing();
+
+		// Moves the components marked for processing to OutComponents
+		void ConsumeHoudiniComponentsMarkedForProcessing(TSet<TWeakObjectPtr<UHoudiniAssetComponent>>& OutComponents);
 		
 		//
 		// Node deletion
 		//
-		void MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent = false);
+		// InSessionIndex is the index of the session (in the session pool) the node was created in.
+		void MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent = false, const int32& InSessionIndex = 0);
 
 		int32 GetNodeIdsPendingDeleteCount();
 		int32 GetNodeIdsPendingDeleteAt(const int32& Index);
+		int32 GetNodeIdsPendingDeleteSessionIndexAt(const int32& Index);
 		void RemoveNodeIdPendingDeleteAt(const int32& Index);
 
-		bool IsParentNodePendingDelete(const int32& NodeId);
+		bool IsParentNodePendingDelete(const int32& NodeId, const int32& InSessionIndex = 0);
+
+		void RemoveParentNodePendingDelete(const int32& NodeId, const int32& InSessionIndex = 0);
 
-		void RemoveParentNodePendingDelete(const int32& NodeId);
+		// Forgets the nodes pending delete in a session that has been closed, as they're gone with it.
+		void RemoveNodeIdsPendingDeleteInSession(const int32& InSessionIndex);
 
 		//
 		//
@@ -101,7 +115,16 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		// 
 		TArray<TWeakObjectPtr<UHoudiniAssetComponent>> RegisteredHoudiniComponents;
 
+		// Components to process on the next manager tick
+		TSet<TWeakObjectPtr<UHoudiniAssetComponent>> HoudiniComponentsToProcess;
+
 		TArray<int32> NodeIdsPendingDelete;
 
+		// Session index of each node in NodeIdsPendingDelete
+		TArray<int32> NodeIdsPendingDeleteSessionIndices;
+
 		TArray<int32> NodeIdsParentPendingDelete;
+
+		// Session index of each node in NodeIdsParentPendingDelete
+		TArray<int32> NodeIdsParentPendingDeleteSessionIndices;
 };
\ No newline at end of file
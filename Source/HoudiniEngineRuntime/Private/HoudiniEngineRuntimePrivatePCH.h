@@ -56,6 +56,7 @@ HOUDINIENGINEEDITOR_API DECLARE_LOG_CATEGORY_EXTERN(LogHoudiniEngineEditor, Log,
 #define HAPI_UNREAL_SESSION_SERVER_TIMEOUT                  3000.0f
 #define HAPI_UNREAL_SESSION_SERVER_HOST                     TEXT( "localhost" )
 #define HAPI_UNREAL_SESSION_SERVER_PORT                     9090
+#define HAPI_UNREAL_SESSION_POOL_MAX_SIZE                   16
 #if PLATFORM_MAC
 	#define HAPI_UNREAL_SESSION_SERVER_PIPENAME                 TEXT( "/tmp/hapi" )
 #else
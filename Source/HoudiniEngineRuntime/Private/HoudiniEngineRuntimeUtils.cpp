@@ -27,6 +27,7 @@
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniRuntimeSettings.h"
+#include "HoudiniAssetComponent.h"
 
 #include "EngineUtils.h"
 
@@ -55,6 +56,28 @@ FHoudiniEngineRuntimeUtils::GetLibHAPIName()
 }
 
 
+int32
+FHoudiniEngineRuntimeUtils::GetOwnerSessionIndex(const UObject* InObject)
+{
+	if (!InObject)
+		return 0;
+
+	// Curves and handles are attached to their HAC, parameters and inputs are outered to it
+	const USceneComponent* SceneComponent = Cast<USceneComponent>(InObject);
+	while (SceneComponent)
+	{
+		const UHoudiniAssetComponent* HAC = Cast<UHoudiniAssetComponent>(SceneComponent);
+		if (HAC)
+			return HAC->GetSessionIndex();
+
+		SceneComponent = SceneComponent->GetAttachParent();
+	}
+
+	const UHoudiniAssetComponent* HAC = InObject->GetTypedOuter<UHoudiniAssetComponent>();
+	return HAC ? HAC->GetSessionIndex() : 0;
+}
+
+
 void 
 FHoudiniEngineRuntimeUtils::GetBoundingBoxesFromActors(const TArray<AActor*> InActors, TArray<FBox>& OutBBoxes)
 {
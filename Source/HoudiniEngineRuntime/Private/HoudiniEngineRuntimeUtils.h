@@ -57,6 +57,10 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineRuntimeUtils
 		// Reterurns default SM Generation Properties using the default settings values
 		static FHoudiniStaticMeshGenerationProperties GetDefaultStaticMeshGenerationProperties();
 
+		// Returns the index of the session used by the Houdini Asset Component owning InObject,
+		// 0 (the main session) if the object isn't owned by a Houdini Asset Component.
+		static int32 GetOwnerSessionIndex(const UObject* InObject);
+
 		// -----------------------------------------------
 		// Bounding Box utilities
 		// -----------------------------------------------
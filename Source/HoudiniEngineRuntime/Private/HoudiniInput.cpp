@@ -27,6 +27,7 @@
 #include "HoudiniInput.h"
 
 #include "HoudiniEngineRuntime.h"
+#include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniOutput.h"
 #include "HoudiniSplineComponent.h"
@@ -34,6 +35,7 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniAssetBlueprintComponent.h"
+#include "HoudiniActorBoundsIndex.h"
 
 #include "EngineUtils.h"
 #include "Engine/Brush.h"
@@ -77,6 +79,7 @@ UHoudiniInput::UHoudiniInput()
 	, DefaultCurveOffset(0.f)
 	, bIsWorldInputBoundSelector(false)
 	, bWorldInputBoundSelectorAutoUpdate(false)
+	, bWorldInputBoundSelectorUpdateOnMove(false)
 	, UnrealSplineResolution(50.0f)
 	, bUpdateInputLandscape(false)
 	, LandscapeExportType(EHoudiniLandscapeExportType::Heightfield)
@@ -168,13 +171,13 @@ void UHoudiniInput::PostEditUndo()
 				 for (auto & NextNodeId : CreatedDataNodeIds)
 				 {
 					 if (bCanDeleteHoudiniNodes)
-						FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(NextNodeId, true);
+						FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(NextNodeId, true, FHoudiniEngineRuntimeUtils::GetOwnerSessionIndex(this));
 				 }
 
 				 CreatedDataNodeIds.Empty();
 
 				 if (bCanDeleteHoudiniNodes)
-					FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, true);
+					FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, true, FHoudiniEngineRuntimeUtils::GetOwnerSessionIndex(this));
 				 InputNodeId = -1;
 			 }
 		 }
@@ -905,6 +908,16 @@ UHoudiniInput::CreateNewCurveInputObject(bool& bOutBlueprintStructureModified)
 	return NewCurveInputObject;
 }
 
+void
+UHoudiniInput::MarkChanged(const bool& bInChanged)
+{
+	bHasChanged = bInChanged;
+	SetNeedsToTriggerUpdate(bInChanged);
+
+	if (bInChanged)
+		UHoudiniAssetComponent::MarkOwnerAsNeedProcessing(this);
+}
+
 void
 UHoudiniInput::MarkAllInputObjectsChanged(const bool& bInChanged)
 {
@@ -1053,7 +1066,7 @@ void UHoudiniInput::InvalidateData()
 		if (Type != EHoudiniInputType::Asset)
 		{
 			if (bCanDeleteHoudiniNodes)
-				FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, true);
+				FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, true, FHoudiniEngineRuntimeUtils::GetOwnerSessionIndex(this));
 		}
 		
 		InputNodeId = -1;
@@ -1108,7 +1121,7 @@ void UHoudiniInput::InvalidateData()
 		auto& HoudiniEngineRuntime = FHoudiniEngineRuntime::Get();
 		for(int32 NodeId : CreatedDataNodeIds)
 		{
-			HoudiniEngineRuntime.MarkNodeIdAsPendingDelete(NodeId, true);
+			HoudiniEngineRuntime.MarkNodeIdAsPendingDelete(NodeId, true, FHoudiniEngineRuntimeUtils::GetOwnerSessionIndex(this));
 		}
 	}
 	
@@ -1613,7 +1626,7 @@ UHoudiniInput::DeleteInputObjectAt(const EHoudiniInputType& InType, const int32&
 	if (InputObjectsPtr->Num() == 0 && InputNodeId >= 0)
 	{
 		if (bCanDeleteHoudiniNodes)
-			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId);
+			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, false, FHoudiniEngineRuntimeUtils::GetOwnerSessionIndex(this));
 		InputNodeId = -1;
 	}
 
@@ -1855,7 +1868,7 @@ UHoudiniInput::SetInputObjectsNumber(const EHoudiniInputType& InType, const int3
 	if (InNewCount == 0 && InputNodeId >= 0)
 	{
 		if (bCanDeleteHoudiniNodes)
-			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, true);
+			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, true, FHoudiniEngineRuntimeUtils::GetOwnerSessionIndex(this));
 		InputNodeId = -1;
 	}
 }
@@ -2329,6 +2342,8 @@ UHoudiniInput::UpdateWorldSelectionFromBoundSelectors()
 		AllBBox.Add(CurrentActor->GetComponentsBoundingBox(true, true));
 	}
 
+	LastBoundSelectorBounds = AllBBox;
+
 	//
 	// Select all actors in our bound selectors bounding boxes
 	//
@@ -2337,12 +2352,15 @@ UHoudiniInput::UpdateWorldSelectionFromBoundSelectors()
 	USceneComponent* ParentComponent = Cast<USceneComponent>(GetOuter());
 	AActor* ParentActor = ParentComponent ? ParentComponent->GetOwner() : nullptr;
 
+	// Only look at the actors intersecting the bounds
 	//UWorld* editorWorld = GEditor->GetEditorWorldContext().World();
 	UWorld* MyWorld = GetWorld();
+	TArray<AActor*> IntersectingActors;
+	FHoudiniActorBoundsIndex::FindActorsIntersecting(MyWorld, AllBBox, IntersectingActors);
+
 	TArray<AActor*> NewSelectedActors;
-	for (TActorIterator<AActor> ActorItr(MyWorld); ActorItr; ++ActorItr)
+	for (AActor* CurrentActor : IntersectingActors)
 	{
-		AActor *CurrentActor = *ActorItr;
 		if (!CurrentActor || CurrentActor->IsPendingKill())
 			continue;
 
@@ -2367,21 +2385,32 @@ UHoudiniInput::UpdateWorldSelectionFromBoundSelectors()
 				continue;
 		}
 
-		FBox ActorBounds = CurrentActor->GetComponentsBoundingBox(true);
-		for (auto InBounds : AllBBox)
-		{
-			// Check if both actor's bounds intersects
-			if (!ActorBounds.Intersect(InBounds))
-				continue;
-
-			NewSelectedActors.Add(CurrentActor);
-			break;
-		}
+		NewSelectedActors.Add(CurrentActor);
 	}
 	
 	return UpdateWorldSelection(NewSelectedActors);
 }
 
+bool
+UHoudiniInput::HaveBoundSelectorsMoved() const
+{
+	int32 BoundIdx = 0;
+	for (auto CurrentActor : WorldInputBoundSelectorObjects)
+	{
+		if (!CurrentActor || CurrentActor->IsPendingKill())
+			continue;
+
+		if (!LastBoundSelectorBounds.IsValidIndex(BoundIdx))
+			return true;
+
+		const FBox CurrentBounds = CurrentActor->GetComponentsBoundingBox(true, true);
+		if (!(CurrentBounds == LastBoundSelectorBounds[BoundIdx++]))
+			return true;
+	}
+
+	return BoundIdx != LastBoundSelectorBounds.Num();
+}
+
 bool
 UHoudiniInput::UpdateWorldSelection(const TArray<AActor*>& InNewSelection)
 {
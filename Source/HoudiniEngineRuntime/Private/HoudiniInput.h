@@ -162,6 +162,10 @@ public:
 
 	bool IsWorldInputBoundSelector() const { return bIsWorldInputBoundSelector; };
 	bool GetWorldInputBoundSelectorAutoUpdates() const { return bWorldInputBoundSelectorAutoUpdate; };
+	bool GetWorldInputBoundSelectorUpdateOnMove() const { return bWorldInputBoundSelectorUpdateOnMove; };
+
+	// Returns true if the bound selectors' bounds have changed since the last bound selection update
+	bool HaveBoundSelectorsMoved() const;
 
 	FString GetNodeBaseName() const;
 
@@ -213,11 +217,7 @@ public:
 	// Mutators
 	//------------------------------------------------------------------------------------------------
 
-	void MarkChanged(const bool& bInChanged)
-	{
-		bHasChanged = bInChanged;
-		SetNeedsToTriggerUpdate(bInChanged);
-	};
+	void MarkChanged(const bool& bInChanged);
 	void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
 	void MarkDataUploadNeeded(const bool& bInDataUploadNeeded) { bDataUploadNeeded = bInDataUploadNeeded; };
 	void MarkAllInputObjectsChanged(const bool& bInChanged);
@@ -265,6 +265,7 @@ public:
 	void SetBoundSelectorObjectAt(const int32& AtIndex, AActor* InActor);
 	void SetWorldInputBoundSelector(const bool& InIsBoundSelector) { bIsWorldInputBoundSelector = InIsBoundSelector; };
 	void SetWorldInputBoundSelectorAutoUpdates(const bool& InAutoUpdate) { bWorldInputBoundSelectorAutoUpdate = InAutoUpdate; };
+	void SetWorldInputBoundSelectorUpdateOnMove(const bool& InUpdateOnMove) { bWorldInputBoundSelectorUpdateOnMove = InUpdateOnMove; };
 
 	// Updates the world selection using bound selectors
 	// returns false if the selection hasn't changed
@@ -503,6 +504,14 @@ protected:
 	UPROPERTY()
 	bool bWorldInputBoundSelectorAutoUpdate;
 
+	// Indicates that selected actors by the bound selectors should update when the bound selectors move
+	UPROPERTY()
+	bool bWorldInputBoundSelectorUpdateOnMove;
+
+	// Bounds of the bound selectors used by the last bound selection update
+	UPROPERTY(Transient, DuplicateTransient)
+	TArray<FBox> LastBoundSelectorBounds;
+
 	// Resolution used when converting unreal splines to houdini curves
 	UPROPERTY()
 	float UnrealSplineResolution;
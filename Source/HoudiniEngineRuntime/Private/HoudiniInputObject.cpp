@@ -233,6 +233,16 @@ UHoudiniInputObject::GetObject() const
 	return InputObject.LoadSynchronous();
 }
 
+void
+UHoudiniInputObject::MarkChanged(const bool& bInChanged)
+{
+	bHasChanged = bInChanged;
+	SetNeedsToTriggerUpdate(bInChanged);
+
+	if (bInChanged)
+		UHoudiniAssetComponent::MarkOwnerAsNeedProcessing(this);
+}
+
 UStaticMesh*
 UHoudiniInputStaticMesh::GetStaticMesh() 
 {
@@ -763,6 +773,8 @@ UHoudiniInputObject::Matches(const UHoudiniInputObject& Other) const
 void
 UHoudiniInputObject::InvalidateData()
 {
+	UploadedDataKey.Empty();
+
 	// If valid, mark our input nodes for deletion..	
 	if (this->IsA<UHoudiniInputHoudiniAsset>() || !bCanDeleteHoudiniNodes)
 	{
@@ -775,14 +787,14 @@ UHoudiniInputObject::InvalidateData()
 
 	if (InputNodeId >= 0)
 	{
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, false, FHoudiniEngineRuntimeUtils::GetOwnerSessionIndex(this));
 		InputNodeId = -1;
 	}
 
 	// ... and the parent OBJ as well to clean up
 	if (InputObjectNodeId >= 0)
 	{
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputObjectNodeId);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputObjectNodeId, false, FHoudiniEngineRuntimeUtils::GetOwnerSessionIndex(this));
 		InputObjectNodeId = -1;
 	}
 
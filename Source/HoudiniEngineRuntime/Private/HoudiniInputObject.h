@@ -120,7 +120,7 @@ public:
 	// Indicates if this input needs to trigger an update
 	virtual bool NeedsToTriggerUpdate() const { return bNeedsToTriggerUpdate; };
 
-	virtual void MarkChanged(const bool& bInChanged) { bHasChanged = bInChanged; SetNeedsToTriggerUpdate(bInChanged); };
+	virtual void MarkChanged(const bool& bInChanged);
 	void MarkTransformChanged(const bool& bInChanged) { bTransformChanged = bInChanged; SetNeedsToTriggerUpdate(bInChanged); };
 	virtual void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
 
@@ -171,6 +171,10 @@ public:
 	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
 	int32 InputObjectNodeId;
 
+	// Identifies the data last uploaded to InputNodeId, so unchanged data isn't uploaded again
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	FString UploadedDataKey;
+
 	// Guid that uniquely identifies this input object.
 	// Also useful to correlate inputs between blueprint component templates and instances.
 	UPROPERTY(DuplicateTransient)
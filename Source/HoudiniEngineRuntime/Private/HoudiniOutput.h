@@ -339,6 +339,20 @@ struct HOUDINIENGINERUNTIME_API FHoudiniOutputObject
 		UPROPERTY()
 		FString BakeName;
 
+		// Hash of the part geometry that generated the output object, relative to its pivot.
+		// Identical parts share the same static mesh, see FHoudiniMeshTranslator.
+		UPROPERTY()
+		uint64 GeometryHash = 0;
+
+		// Pivot of the part geometry that generated the output object
+		UPROPERTY()
+		FVector GeometryPivot = FVector::ZeroVector;
+
+		// Offset applied to the output component, when the static mesh was built
+		// for an identical part at another location
+		UPROPERTY()
+		FVector MeshOffset = FVector::ZeroVector;
+
 		UPROPERTY()
 		FHoudiniCurveOutputProperties CurveOutputProperty;
 
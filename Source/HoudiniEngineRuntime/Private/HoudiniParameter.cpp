@@ -26,6 +26,8 @@
 
 #include "HoudiniParameter.h"
 
+#include "HoudiniAssetComponent.h"
+
 UHoudiniParameter::UHoudiniParameter(const FObjectInitializer & ObjectInitializer)
 	: Super(ObjectInitializer)
 	, ParmType(EHoudiniParameterType::Invalid)
@@ -73,6 +75,16 @@ UHoudiniParameter::IsChildParameter() const
 	return ParentParmId >= 0;
 }
 
+void
+UHoudiniParameter::MarkChanged(const bool& bInChanged)
+{
+	bHasChanged = bInChanged;
+	SetNeedsToTriggerUpdate(bInChanged);
+
+	if (bInChanged)
+		UHoudiniAssetComponent::MarkOwnerAsNeedProcessing(this);
+}
+
 void
 UHoudiniParameter::RevertToDefault()
 {
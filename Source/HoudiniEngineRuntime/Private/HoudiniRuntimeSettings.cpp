@@ -65,6 +65,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	ServerPipeName = HAPI_UNREAL_SESSION_SERVER_PIPENAME;
 	bStartAutomaticServer = HAPI_UNREAL_SESSION_SERVER_AUTOSTART;
 	AutomaticServerTimeout = HAPI_UNREAL_SESSION_SERVER_TIMEOUT;
+	SessionPoolSize = 1;
 
 	bSyncWithHoudiniCook = true;
 	bCookUsingHoudiniTime = true;
@@ -78,6 +79,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	// Cooking options.
 	bPauseCookingOnStart = false;
 	bDisplaySlateCookingNotifications = true;
+	ComponentProcessingTimeBudget = 4.0f;
 	DefaultTemporaryCookFolder = HAPI_UNREAL_DEFAULT_TEMP_COOK_FOLDER;
 	DefaultBakeFolder = HAPI_UNREAL_DEFAULT_BAKE_FOLDER;
 
@@ -101,13 +103,18 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	// Spline marshalling
 	MarshallingSplineResolution = 50.0f;
 
+	// Material marshalling
+	MarshallingMaterialsAsIndices = false;
+
 	// Static mesh proxy refinement settings
 	bEnableProxyStaticMesh = false;
 	bShowDefaultMesh = true;
 	bEnableProxyStaticMeshRefinementByTimer = true;
 	ProxyMeshAutoRefineTimeoutSeconds = 10.0f;
+	ProxyMeshRefinementTimeBudget = 10.0f;
 	bEnableProxyStaticMeshRefinementOnPreSaveWorld = true;
 	bEnableProxyStaticMeshRefinementOnPreBeginPIE = true;
+	bEnableProxyStaticMeshCompactStorage = false;
 
 	// Generated StaticMesh settings.
 	bDoubleSidedGeometry = false;
@@ -367,6 +374,8 @@ UHoudiniRuntimeSettings::UpdateSessionUI()
 	SetPropertyReadOnly(TEXT("ServerPipeName"), true);
 	SetPropertyReadOnly(TEXT("bStartAutomaticServer"), true);
 	SetPropertyReadOnly(TEXT("AutomaticServerTimeout"), true);
+	SetPropertyReadOnly(TEXT("SessionReplayFilePath"), true);
+	SetPropertyReadOnly(TEXT("SessionPoolSize"), true);
 
 	bool bServerType = false;
 
@@ -387,6 +396,12 @@ UHoudiniRuntimeSettings::UpdateSessionUI()
 		break;
 	}
 
+	case HRSST_Replay:
+	{
+		SetPropertyReadOnly(TEXT("SessionReplayFilePath"), false);
+		break;
+	}
+
 	default:
 		break;
 	}
@@ -395,6 +410,7 @@ UHoudiniRuntimeSettings::UpdateSessionUI()
 	{
 		SetPropertyReadOnly(TEXT("bStartAutomaticServer"), false);
 		SetPropertyReadOnly(TEXT("AutomaticServerTimeout"), false);
+		SetPropertyReadOnly(TEXT("SessionPoolSize"), false);
 	}
 }
 
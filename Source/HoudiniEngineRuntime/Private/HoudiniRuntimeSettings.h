@@ -51,6 +51,9 @@ enum EHoudiniRuntimeSettingsSessionType
 	// No session, prevents license/Engine cook
 	HRSST_None UMETA(DisplayName = "None"),
 
+	// Replays a trace of HAPI calls recorded with Houdini.ApiRecord, without a Houdini Engine server.
+	HRSST_Replay UMETA(DisplayName = "Replay (recorded trace)"),
+
 	HRSST_MAX
 };
 
@@ -188,6 +191,16 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Session)
 		float AutomaticServerTimeout;
 
+		// HAPI trace file used by the Replay session type.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Session)
+		FString SessionReplayFilePath;
+
+		// Number of Houdini Engine sessions used to instantiate and cook assets in parallel.
+		// The additional sessions are started automatically, using ServerPipeName_N or ServerPort + N.
+		// Assets connected by inputs always share the same session.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Session, meta = (ClampMin = "1", ClampMax = "16", UIMin = "1", UIMax = "16"))
+		int32 SessionPoolSize;
+
 		// If enabled, changes made in Houdini, when connected to Houdini running in Session Sync mode will be automatically be pushed to Unreal.
 		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Session)
 		bool bSyncWithHoudiniCook;
@@ -229,6 +242,13 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
 		bool bDisplaySlateCookingNotifications;
 
+		// Time budget (in ms) used for processing Houdini Asset Components on each editor tick.
+		// Components that are instantiating/cooking/processing are processed first, then idle components are visited
+		// until the budget is exhausted. At least one component is processed per tick.
+		// A value of 0 restores the previous behavior of processing a single component per tick.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Cooking, meta = (DisplayName = "Component Processing Time Budget (ms)", ClampMin = "0.0", UIMin = "0.0", UIMax = "33.0"))
+		float ComponentProcessingTimeBudget;
+
 		// Default content folder storing all the temporary cook data (Static meshes, materials, textures, landscape layer infos...)
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
 		FString DefaultTemporaryCookFolder;
@@ -275,6 +295,11 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = "GeometryMarshalling")
 		float MarshallingSplineResolution;
 
+		// If true, the materials of input static meshes are sent as a table of unique material paths and a per-face index
+		// instead of one material path per face. The unreal_material attribute is restored by a wrangle in the input's network.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "GeometryMarshalling")
+		bool MarshallingMaterialsAsIndices;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Static Mesh Options
 		//-------------------------------------------------------------------------------------------------------------
@@ -295,6 +320,11 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Proxy Mesh Auto Refine Timeout Seconds", EditCondition = "bEnableProxyStaticMesh && bEnableProxyStaticMeshRefinementByTimer"))
 		float ProxyMeshAutoRefineTimeoutSeconds;
 
+		// Proxy meshes refined after the timeout are converted progressively in the background.
+		// This is the time (in ms) that can be spent refining them on each tick. At least one output is refined per tick.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Proxy Mesh Refinement Time Budget (ms)", EditCondition = "bEnableProxyStaticMesh", ClampMin = "0.0", UIMin = "0.0", UIMax = "100.0"))
+		float ProxyMeshRefinementTimeBudget;
+
 		// Automatically refine proxy meshes to UStaticMesh before the map is saved
 		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Refine Proxy Static Meshes When Saving a Map", EditCondition = "bEnableProxyStaticMesh"))
 		bool bEnableProxyStaticMeshRefinementOnPreSaveWorld;
@@ -303,6 +333,11 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Refine Proxy Static Meshes On PIE", EditCondition = "bEnableProxyStaticMesh"))
 		bool bEnableProxyStaticMeshRefinementOnPreBeginPIE;
 
+		// Store proxy meshes with a compact layout (shared vertices, packed normals/tangents and half precision UVs)
+		// to reduce their memory usage and serialized size
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Use Compact Storage For Proxy Static Meshes", EditCondition = "bEnableProxyStaticMesh"))
+		bool bEnableProxyStaticMeshCompactStorage;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Generated StaticMesh settings.
 		//-------------------------------------------------------------------------------------------------------------
@@ -651,6 +651,9 @@ void UHoudiniSplineComponent::MarkChanged(const bool& Changed)
 {
 	bHasChanged = Changed;
 	bNeedsToTriggerUpdate = Changed;
+
+	if (Changed)
+		UHoudiniAssetComponent::MarkOwnerAsNeedProcessing(this);
 }
 
 // UHoudiniAssetComponent* 
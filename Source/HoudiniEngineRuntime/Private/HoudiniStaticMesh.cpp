@@ -26,6 +26,12 @@
 
 #include "HoudiniStaticMesh.h"
 
+#include "HoudiniPluginSerializationVersion.h"
+
+#include "Async/ParallelFor.h"
+#include "Misc/Crc.h"
+#include "Serialization/CustomVersion.h"
+
 UHoudiniStaticMesh::UHoudiniStaticMesh(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
 {
@@ -34,10 +40,28 @@ UHoudiniStaticMesh::UHoudiniStaticMesh(const FObjectInitializer& ObjectInitializ
 	bHasColors = false;
 	NumUVLayers = false;
 	bHasPerFaceMaterials = false;
+	bUseCompactStorage = false;
+	bIsCompacted = false;
+	TopologyHash = 0;
+	PositionsHash = 0;
+	AttributesHash = 0;
 }
 
 void UHoudiniStaticMesh::Initialize(uint32 InNumVertices, uint32 InNumTriangles, uint32 InNumUVLayers, uint32 InInitialNumStaticMaterials, bool bInHasNormals, bool bInHasTangents, bool bInHasColors, bool bInHasPerFaceMaterials)
 {
+	// The hashes are updated once the mesh has been built
+	TopologyHash = 0;
+	PositionsHash = 0;
+	AttributesHash = 0;
+
+	// Discard the compact data, the mesh is built with the full precision layout
+	bIsCompacted = false;
+	CompactVertexInstanceIndices.Empty();
+	CompactTangentsX.Empty();
+	CompactTangentsZ.Empty();
+	CompactColors.Empty();
+	CompactUVs.Empty();
+
 	// Initialize the vertex positions and triangle indices arrays
 	VertexPositions.Init(FVector::ZeroVector, InNumVertices);
 	TriangleIndices.Init(FIntVector(-1, -1, -1), InNumTriangles);
@@ -218,8 +242,106 @@ void UHoudiniStaticMesh::SetStaticMaterial(uint32 InMaterialIndex, const FStatic
 	StaticMaterials[InMaterialIndex] = InStaticMaterial;
 }
 
+void UHoudiniStaticMesh::SetVertexPositions(uint32 InFirstVertexIndex, TArrayView<const FVector> InPositions)
+{
+	check(InFirstVertexIndex + InPositions.Num() <= (uint32)VertexPositions.Num());
+
+	FMemory::Memcpy(VertexPositions.GetData() + InFirstVertexIndex, InPositions.GetData(), InPositions.Num() * sizeof(FVector));
+}
+
+void UHoudiniStaticMesh::SetTriangleVertexIndices(uint32 InFirstTriangleIndex, TArrayView<const FIntVector> InTriangleVertexIndices)
+{
+	check(InFirstTriangleIndex + InTriangleVertexIndices.Num() <= (uint32)TriangleIndices.Num());
+#if DO_GUARD_SLOW
+	for (const FIntVector& TriangleVertexIndices : InTriangleVertexIndices)
+	{
+		checkSlow(VertexPositions.IsValidIndex(TriangleVertexIndices[0]));
+		checkSlow(VertexPositions.IsValidIndex(TriangleVertexIndices[1]));
+		checkSlow(VertexPositions.IsValidIndex(TriangleVertexIndices[2]));
+	}
+#endif
+
+	FMemory::Memcpy(TriangleIndices.GetData() + InFirstTriangleIndex, InTriangleVertexIndices.GetData(), InTriangleVertexIndices.Num() * sizeof(FIntVector));
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceNormals(uint32 InFirstVertexInstanceIndex, TArrayView<const FVector> InNormals)
+{
+	if (!bHasNormals)
+	{
+		return;
+	}
+
+	check(InFirstVertexInstanceIndex + InNormals.Num() <= (uint32)VertexInstanceNormals.Num());
+
+	FMemory::Memcpy(VertexInstanceNormals.GetData() + InFirstVertexInstanceIndex, InNormals.GetData(), InNormals.Num() * sizeof(FVector));
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceUTangents(uint32 InFirstVertexInstanceIndex, TArrayView<const FVector> InUTangents)
+{
+	if (!bHasTangents)
+	{
+		return;
+	}
+
+	check(InFirstVertexInstanceIndex + InUTangents.Num() <= (uint32)VertexInstanceUTangents.Num());
+
+	FMemory::Memcpy(VertexInstanceUTangents.GetData() + InFirstVertexInstanceIndex, InUTangents.GetData(), InUTangents.Num() * sizeof(FVector));
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceVTangents(uint32 InFirstVertexInstanceIndex, TArrayView<const FVector> InVTangents)
+{
+	if (!bHasTangents)
+	{
+		return;
+	}
+
+	check(InFirstVertexInstanceIndex + InVTangents.Num() <= (uint32)VertexInstanceVTangents.Num());
+
+	FMemory::Memcpy(VertexInstanceVTangents.GetData() + InFirstVertexInstanceIndex, InVTangents.GetData(), InVTangents.Num() * sizeof(FVector));
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceColors(uint32 InFirstVertexInstanceIndex, TArrayView<const FColor> InColors)
+{
+	if (!bHasColors)
+	{
+		return;
+	}
+
+	check(InFirstVertexInstanceIndex + InColors.Num() <= (uint32)VertexInstanceColors.Num());
+
+	FMemory::Memcpy(VertexInstanceColors.GetData() + InFirstVertexInstanceIndex, InColors.GetData(), InColors.Num() * sizeof(FColor));
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceUVs(uint8 InUVLayer, uint32 InFirstVertexInstanceIndex, TArrayView<const FVector2D> InUVs)
+{
+	if (InUVLayer >= NumUVLayers)
+	{
+		return;
+	}
+
+	check(InFirstVertexInstanceIndex + InUVs.Num() <= GetNumVertexInstances());
+	const uint32 FirstVertexInstanceUVIndex = InUVLayer * GetNumVertexInstances() + InFirstVertexInstanceIndex;
+
+	FMemory::Memcpy(VertexInstanceUVs.GetData() + FirstVertexInstanceUVIndex, InUVs.GetData(), InUVs.Num() * sizeof(FVector2D));
+}
+
+void UHoudiniStaticMesh::SetTriangleMaterialIDs(uint32 InFirstTriangleIndex, TArrayView<const int32> InMaterialIDs)
+{
+	if (!bHasPerFaceMaterials)
+	{
+		return;
+	}
+
+	check(InFirstTriangleIndex + InMaterialIDs.Num() <= (uint32)MaterialIDsPerTriangle.Num());
+
+	FMemory::Memcpy(MaterialIDsPerTriangle.GetData() + InFirstTriangleIndex, InMaterialIDs.GetData(), InMaterialIDs.Num() * sizeof(int32));
+}
+
 void UHoudiniStaticMesh::Optimize()
 {
+	if (bUseCompactStorage && !bIsCompacted)
+		Compact();
+
 	VertexPositions.Shrink();
 	TriangleIndices.Shrink();
 	VertexInstanceColors.Shrink();
@@ -229,6 +351,227 @@ void UHoudiniStaticMesh::Optimize()
 	VertexInstanceUVs.Shrink();
 	MaterialIDsPerTriangle.Shrink();
 	StaticMaterials.Shrink();
+	CompactVertexInstanceIndices.Shrink();
+	CompactTangentsX.Shrink();
+	CompactTangentsZ.Shrink();
+	CompactColors.Shrink();
+	CompactUVs.Shrink();
+
+	UpdateHashes();
+}
+
+// Chains the CRC of an array's content with a previous CRC
+template<typename TYPE>
+static uint32
+HashMeshData(const TArray<TYPE>& InData, uint32 InCRC)
+{
+	const int32 Num = InData.Num();
+	InCRC = FCrc::MemCrc32(&Num, sizeof(int32), InCRC);
+	return FCrc::MemCrc32(InData.GetData(), Num * sizeof(TYPE), InCRC);
+}
+
+void UHoudiniStaticMesh::UpdateHashes()
+{
+	const uint32 Flags = (bHasNormals ? 1 : 0) | (bHasTangents ? 2 : 0) | (bHasColors ? 4 : 0) | (bHasPerFaceMaterials ? 8 : 0) | (bIsCompacted ? 16 : 0);
+	TopologyHash = FCrc::MemCrc32(&Flags, sizeof(uint32));
+	TopologyHash = FCrc::MemCrc32(&NumUVLayers, sizeof(uint32), TopologyHash);
+	TopologyHash = HashMeshData(TriangleIndices, TopologyHash);
+	TopologyHash = HashMeshData(MaterialIDsPerTriangle, TopologyHash);
+	TopologyHash = HashMeshData(CompactVertexInstanceIndices, TopologyHash);
+	const int32 NumStaticMaterials = StaticMaterials.Num();
+	TopologyHash = FCrc::MemCrc32(&NumStaticMaterials, sizeof(int32), TopologyHash);
+
+	PositionsHash = HashMeshData(VertexPositions, 0);
+
+	AttributesHash = HashMeshData(VertexInstanceNormals, 0);
+	AttributesHash = HashMeshData(VertexInstanceUTangents, AttributesHash);
+	AttributesHash = HashMeshData(VertexInstanceVTangents, AttributesHash);
+	AttributesHash = HashMeshData(VertexInstanceColors, AttributesHash);
+	AttributesHash = HashMeshData(VertexInstanceUVs, AttributesHash);
+	AttributesHash = HashMeshData(CompactTangentsX, AttributesHash);
+	AttributesHash = HashMeshData(CompactTangentsZ, AttributesHash);
+	AttributesHash = HashMeshData(CompactColors, AttributesHash);
+	AttributesHash = HashMeshData(CompactUVs, AttributesHash);
+
+	// 0 is used for unknown hashes
+	TopologyHash = TopologyHash != 0 ? TopologyHash : 1;
+	PositionsHash = PositionsHash != 0 ? PositionsHash : 1;
+	AttributesHash = AttributesHash != 0 ? AttributesHash : 1;
+}
+
+uint32 UHoudiniStaticMesh::GetNumCompactVertices() const
+{
+	if (!bIsCompacted)
+		return 0;
+
+	// Not all compact arrays are populated (no normals/colors/UVs), so use the highest referenced index
+	uint32 NumCompactVertices = 0;
+	for (const uint32 CompactVertexIdx : CompactVertexInstanceIndices)
+		NumCompactVertices = FMath::Max(NumCompactVertices, CompactVertexIdx + 1);
+
+	return NumCompactVertices;
+}
+
+void UHoudiniStaticMesh::Compact()
+{
+	const uint32 NumVertexInstances = GetNumVertexInstances();
+	if (NumVertexInstances == 0)
+		return;
+
+	// Pack the data of each vertex instance in a fixed size record: position index, tangent U, normal, color and one
+	// half precision UV per layer. Vertex instances with identical records can then share the same compact vertex.
+	// The packed formats are the ones used by the render buffers, so no precision is lost when rendering.
+	const uint32 RecordSize = 4 + NumUVLayers;
+	TArray<uint32> Records;
+	Records.SetNumUninitialized(NumVertexInstances * RecordSize);
+	ParallelFor(NumVertexInstances, [&](uint32 VertexInstanceIdx)
+	{
+		uint32* Record = &Records[VertexInstanceIdx * RecordSize];
+		Record[0] = TriangleIndices[VertexInstanceIdx / 3][VertexInstanceIdx % 3];
+
+		FPackedNormal TangentX;
+		FPackedNormal TangentZ;
+		if (bHasNormals)
+		{
+			const FVector& Normal = VertexInstanceNormals[VertexInstanceIdx];
+			if (bHasTangents)
+			{
+				const FVector& UTangent = VertexInstanceUTangents[VertexInstanceIdx];
+				const FVector& VTangent = VertexInstanceVTangents[VertexInstanceIdx];
+				const float VTangentSign = ((Normal ^ UTangent) | VTangent) < 0.0f ? -1.0f : 1.0f;
+				TangentX = FPackedNormal(UTangent);
+				TangentZ = FPackedNormal(FVector4(Normal, VTangentSign));
+			}
+			else
+			{
+				TangentZ = FPackedNormal(Normal);
+			}
+		}
+		Record[1] = TangentX.Vector.Packed;
+		Record[2] = TangentZ.Vector.Packed;
+		Record[3] = bHasColors ? VertexInstanceColors[VertexInstanceIdx].DWColor() : 0;
+
+		for (uint32 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
+		{
+			const FVector2DHalf UV(VertexInstanceUVs[UVLayerIdx * NumVertexInstances + VertexInstanceIdx]);
+			FMemory::Memcpy(&Record[4 + UVLayerIdx], &UV, sizeof(uint32));
+		}
+	});
+
+	// Find the unique records. On a hash collision the vertex instance simply isn't shared.
+	TArray<uint32> CompactVertexSources;
+	TMap<uint32, uint32> CompactVertexByHash;
+	CompactVertexByHash.Reserve(NumVertexInstances / 2);
+	CompactVertexInstanceIndices.SetNumUninitialized(NumVertexInstances);
+	for (uint32 VertexInstanceIdx = 0; VertexInstanceIdx < NumVertexInstances; ++VertexInstanceIdx)
+	{
+		const uint32* Record = &Records[VertexInstanceIdx * RecordSize];
+		const uint32 Hash = FCrc::MemCrc32(Record, RecordSize * sizeof(uint32));
+
+		const uint32* FoundCompactVertex = CompactVertexByHash.Find(Hash);
+		if (FoundCompactVertex
+			&& FMemory::Memcmp(Record, &Records[CompactVertexSources[*FoundCompactVertex] * RecordSize], RecordSize * sizeof(uint32)) == 0)
+		{
+			CompactVertexInstanceIndices[VertexInstanceIdx] = *FoundCompactVertex;
+			continue;
+		}
+
+		const uint32 CompactVertexIdx = CompactVertexSources.Add(VertexInstanceIdx);
+		if (!FoundCompactVertex)
+			CompactVertexByHash.Add(Hash, CompactVertexIdx);
+
+		CompactVertexInstanceIndices[VertexInstanceIdx] = CompactVertexIdx;
+	}
+
+	// Fill the compact arrays from the unique records
+	const uint32 NumCompactVertices = CompactVertexSources.Num();
+	CompactTangentsX.SetNumZeroed(bHasTangents ? NumCompactVertices : 0);
+	CompactTangentsZ.SetNumZeroed(bHasNormals ? NumCompactVertices : 0);
+	CompactColors.SetNumZeroed(bHasColors ? NumCompactVertices : 0);
+	CompactUVs.SetNumZeroed(NumUVLayers * NumCompactVertices);
+	ParallelFor(NumCompactVertices, [&](uint32 CompactVertexIdx)
+	{
+		const uint32* Record = &Records[CompactVertexSources[CompactVertexIdx] * RecordSize];
+		if (bHasTangents)
+			CompactTangentsX[CompactVertexIdx].Vector.Packed = Record[1];
+		if (bHasNormals)
+			CompactTangentsZ[CompactVertexIdx].Vector.Packed = Record[2];
+		if (bHasColors)
+			CompactColors[CompactVertexIdx] = FColor(Record[3]);
+
+		for (uint32 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
+		{
+			FMemory::Memcpy(&CompactUVs[UVLayerIdx * NumCompactVertices + CompactVertexIdx], &Record[4 + UVLayerIdx], sizeof(uint32));
+		}
+	});
+
+	// The full precision data isn't needed anymore
+	VertexInstanceNormals.Empty();
+	VertexInstanceUTangents.Empty();
+	VertexInstanceVTangents.Empty();
+	VertexInstanceColors.Empty();
+	VertexInstanceUVs.Empty();
+
+	bIsCompacted = true;
+}
+
+void UHoudiniStaticMesh::GetVertexInstanceTangents(uint32 InVertexInstanceIndex, FVector& OutUTangent, FVector& OutVTangent, FVector& OutNormal) const
+{
+	OutNormal = FVector(0, 0, 1);
+	if (bIsCompacted)
+	{
+		const uint32 CompactVertexIdx = CompactVertexInstanceIndices[InVertexInstanceIndex];
+		if (bHasNormals)
+		{
+			const FVector4 TangentZ = CompactTangentsZ[CompactVertexIdx].ToFVector4();
+			OutNormal = FVector(TangentZ);
+			if (bHasTangents)
+			{
+				OutUTangent = CompactTangentsX[CompactVertexIdx].ToFVector();
+				OutVTangent = (OutNormal ^ OutUTangent) * TangentZ.W;
+				return;
+			}
+		}
+	}
+	else
+	{
+		if (bHasNormals)
+			OutNormal = VertexInstanceNormals[InVertexInstanceIndex];
+
+		if (bHasTangents)
+		{
+			OutUTangent = VertexInstanceUTangents[InVertexInstanceIndex];
+			OutVTangent = VertexInstanceVTangents[InVertexInstanceIndex];
+			return;
+		}
+	}
+
+	OutNormal.FindBestAxisVectors(OutUTangent, OutVTangent);
+}
+
+FColor UHoudiniStaticMesh::GetVertexInstanceColor(uint32 InVertexInstanceIndex, const FColor& InDefaultColor) const
+{
+	if (!bHasColors)
+		return InDefaultColor;
+
+	if (bIsCompacted)
+		return CompactColors[CompactVertexInstanceIndices[InVertexInstanceIndex]];
+
+	return VertexInstanceColors[InVertexInstanceIndex];
+}
+
+FVector2D UHoudiniStaticMesh::GetVertexInstanceUV(uint32 InVertexInstanceIndex, uint8 InUVLayer) const
+{
+	if (InUVLayer >= NumUVLayers)
+		return FVector2D::ZeroVector;
+
+	if (bIsCompacted)
+	{
+		const uint32 NumCompactVertices = CompactUVs.Num() / NumUVLayers;
+		return CompactUVs[InUVLayer * NumCompactVertices + CompactVertexInstanceIndices[InVertexInstanceIndex]];
+	}
+
+	return VertexInstanceUVs[InUVLayer * GetNumVertexInstances() + InVertexInstanceIndex];
 }
 
 FBox UHoudiniStaticMesh::CalcBounds() const
@@ -275,6 +618,8 @@ int32 UHoudiniStaticMesh::GetMaterialIndex(FName InMaterialSlotName) const
 
 void UHoudiniStaticMesh::Serialize(FArchive &InArchive)
 {
+	InArchive.UsingCustomVersion(FHoudiniCustomSerializationVersion::GUID);
+
 	Super::Serialize(InArchive);
 
 	VertexPositions.Shrink();
@@ -300,4 +645,23 @@ void UHoudiniStaticMesh::Serialize(FArchive &InArchive)
 
 	MaterialIDsPerTriangle.Shrink();
 	MaterialIDsPerTriangle.BulkSerialize(InArchive);
+
+	// The compact layout arrays were added after the initial version
+	if (InArchive.IsLoading() && InArchive.CustomVer(FHoudiniCustomSerializationVersion::GUID) < VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_V2_HOUDINI_STATIC_MESH_COMPACT_STORAGE)
+		return;
+
+	CompactVertexInstanceIndices.Shrink();
+	CompactVertexInstanceIndices.BulkSerialize(InArchive);
+
+	CompactTangentsX.Shrink();
+	CompactTangentsX.BulkSerialize(InArchive);
+
+	CompactTangentsZ.Shrink();
+	CompactTangentsZ.BulkSerialize(InArchive);
+
+	CompactColors.Shrink();
+	CompactColors.BulkSerialize(InArchive);
+
+	CompactUVs.Shrink();
+	CompactUVs.BulkSerialize(InArchive);
 }
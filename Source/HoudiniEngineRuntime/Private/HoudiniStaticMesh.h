@@ -28,12 +28,18 @@
 
 #include "CoreMinimal.h"
 #include "Engine/StaticMesh.h"
+#include "Math/Vector2DHalf.h"
+#include "PackedNormal.h"
 
 #include "HoudiniStaticMesh.generated.h"
 
 /**
  * This is a simple static mesh that is meant to be built in one go, without modifications afterwards.
  * The number of vertices and triangles must be known before hand.
+ *
+ * The per vertex instance data is stored with full precision while the mesh is being built. If compact storage is
+ * enabled, Optimize() then converts it to the compact layout: vertex instances with identical data are shared between
+ * triangles, normals and tangents are packed and UVs are stored with half precision.
  */
 UCLASS()
 class HOUDINIENGINERUNTIME_API UHoudiniStaticMesh : public UObject
@@ -121,11 +127,53 @@ public:
 	UFUNCTION()
 	void SetStaticMaterial(uint32 InMaterialIndex, const FStaticMaterial& InStaticMaterial);
 
+	// Bulk setters: copy the values to the consecutive elements starting at the first index.
+	// Each call only writes to its own range, so disjoint ranges can be set from multiple threads.
+	void SetVertexPositions(uint32 InFirstVertexIndex, TArrayView<const FVector> InPositions);
+
+	void SetTriangleVertexIndices(uint32 InFirstTriangleIndex, TArrayView<const FIntVector> InTriangleVertexIndices);
+
+	void SetVertexInstanceNormals(uint32 InFirstVertexInstanceIndex, TArrayView<const FVector> InNormals);
+
+	void SetVertexInstanceUTangents(uint32 InFirstVertexInstanceIndex, TArrayView<const FVector> InUTangents);
+
+	void SetVertexInstanceVTangents(uint32 InFirstVertexInstanceIndex, TArrayView<const FVector> InVTangents);
+
+	void SetVertexInstanceColors(uint32 InFirstVertexInstanceIndex, TArrayView<const FColor> InColors);
+
+	void SetVertexInstanceUVs(uint8 InUVLayer, uint32 InFirstVertexInstanceIndex, TArrayView<const FVector2D> InUVs);
+
+	void SetTriangleMaterialIDs(uint32 InFirstTriangleIndex, TArrayView<const int32> InMaterialIDs);
+
+	UFUNCTION()
+	bool UsesCompactStorage() const { return bUseCompactStorage; }
+
+	// Enables/disables the conversion to the compact layout in Optimize()
+	UFUNCTION()
+	void SetUseCompactStorage(bool bInUseCompactStorage) { bUseCompactStorage = bInUseCompactStorage; }
+
+	// Returns true if the mesh data has been converted to the compact layout.
+	// A compacted mesh must be initialized again before being modified.
+	UFUNCTION()
+	bool IsCompacted() const { return bIsCompacted; }
+
+	// Index of the shared compact vertex used by each vertex instance, empty if the mesh isn't compacted
+	const TArray<uint32>& GetCompactVertexInstanceIndices() const { return CompactVertexInstanceIndices; }
+
+	uint32 GetNumCompactVertices() const;
+
+	// Hashes of the mesh data, updated by Optimize() and 0 if unknown.
+	// Used by the scene proxy to only update the vertex streams that changed when the topology is the same.
+	// The topology hash covers the triangles, materials and vertex sharing.
+	uint32 GetTopologyHash() const { return TopologyHash; }
+	uint32 GetPositionsHash() const { return PositionsHash; }
+	uint32 GetAttributesHash() const { return AttributesHash; }
+
 	UFUNCTION()
 	uint32 AddStaticMaterial(const FStaticMaterial& InStaticMaterial) { return StaticMaterials.Add(InStaticMaterial); }
 
 	// Meant to be called after the mesh data arrays are populated.
-	// Currently only calls Shrink on the arrays
+	// Shrinks the arrays, and converts the mesh to the compact layout if compact storage is enabled.
 	UFUNCTION()
 	void Optimize();
 
@@ -138,6 +186,8 @@ public:
 	UFUNCTION()
 	const TArray<FIntVector>& GetTriangleIndices() const { return TriangleIndices; }
 
+	// The full precision vertex instance arrays are empty once the mesh has been compacted,
+	// use the per vertex instance accessors below to read the data regardless of the layout.
 	UFUNCTION()
 	const TArray<FColor>& GetVertexInstanceColors() const { return VertexInstanceColors; }
 
@@ -156,6 +206,15 @@ public:
 	UFUNCTION()
 	const TArray<int32>& GetMaterialIDsPerTriangle() const { return MaterialIDsPerTriangle; }
 
+	// Returns the tangent basis of a vertex instance. Default normals are used if the mesh has none,
+	// and the tangents are generated from the normal if the mesh has no tangents.
+	void GetVertexInstanceTangents(uint32 InVertexInstanceIndex, FVector& OutUTangent, FVector& OutVTangent, FVector& OutNormal) const;
+
+	// Returns the color of a vertex instance, or InDefaultColor if the mesh has no colors
+	FColor GetVertexInstanceColor(uint32 InVertexInstanceIndex, const FColor& InDefaultColor) const;
+
+	FVector2D GetVertexInstanceUV(uint32 InVertexInstanceIndex, uint8 InUVLayer) const;
+
 	UFUNCTION()
 	const TArray<FStaticMaterial>& GetStaticMaterials() const { return StaticMaterials; }
 
@@ -170,6 +229,12 @@ public:
 
 protected:
 
+	// Converts the full precision vertex instance data to the compact layout
+	void Compact();
+
+	// Updates the topology/positions/attributes hashes
+	void UpdateHashes();
+
 	UPROPERTY()
 	bool bHasNormals;
 
@@ -223,4 +288,34 @@ protected:
 	/** The materials of the mesh. Index by MaterialID (MaterialIndex). */
 	UPROPERTY()
 	TArray<FStaticMaterial> StaticMaterials;
+
+	/** If true, Optimize() converts the mesh to the compact layout. */
+	UPROPERTY()
+	bool bUseCompactStorage;
+
+	/** Indicates that the vertex instance data is stored in the compact arrays below. */
+	UPROPERTY()
+	bool bIsCompacted;
+
+	// The compact layout arrays are not UPROPERTYs (packed types), they are serialized in Serialize().
+
+	/** Compact layout: index of the shared compact vertex used by each vertex instance. Index 3 * TriangleID + LocalTriangleVertexIndex. */
+	TArray<uint32> CompactVertexInstanceIndices;
+
+	/** Compact layout: packed U tangent per compact vertex, only if the mesh has tangents. */
+	TArray<FPackedNormal> CompactTangentsX;
+
+	/** Compact layout: packed normal per compact vertex, W holds the sign of the V tangent. */
+	TArray<FPackedNormal> CompactTangentsZ;
+
+	/** Compact layout: color per compact vertex. */
+	TArray<FColor> CompactColors;
+
+	/** Compact layout: half precision UVs. Index: UVLayerIndex * (NumCompactVertices) + CompactVertexIndex. */
+	TArray<FVector2DHalf> CompactUVs;
+
+	// Transient hashes of the mesh data, see GetTopologyHash()
+	uint32 TopologyHash;
+	uint32 PositionsHash;
+	uint32 AttributesHash;
 };
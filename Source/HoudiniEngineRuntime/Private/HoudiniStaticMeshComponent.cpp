@@ -128,7 +128,13 @@ void UHoudiniStaticMeshComponent::SetHoudiniIconVisible(bool bInHoudiniIconVisib
 
 void UHoudiniStaticMeshComponent::NotifyMeshUpdated()
 {
-	MarkRenderStateDirty();
+	// If only the positions or attributes of the mesh changed, update the existing proxy's buffers instead of
+	// recreating the proxy
+	FHoudiniStaticMeshSceneProxy* const Proxy = static_cast<FHoudiniStaticMeshSceneProxy*>(SceneProxy);
+	const bool bUpdatedProxy = Proxy && !IsRenderStateDirty() && Proxy->UpdateVertexStreams(Mesh);
+	if (!bUpdatedProxy)
+		MarkRenderStateDirty();
+
 	if (Mesh)
 	{
 		LocalBounds = Mesh->CalcBounds();
@@ -143,6 +149,10 @@ void UHoudiniStaticMeshComponent::NotifyMeshUpdated()
 #endif
 
 	UpdateBounds();
+
+	// Send the new bounds to the proxy
+	if (bUpdatedProxy)
+		MarkRenderTransformDirty();
 }
 
 #if WITH_EDITORONLY_DATA
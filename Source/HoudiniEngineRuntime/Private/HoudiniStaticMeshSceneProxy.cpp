@@ -62,6 +62,10 @@ FHoudiniStaticMeshRenderBufferSet::~FHoudiniStaticMeshRenderBufferSet()
 		{
 			TriangleIndexBuffer.ReleaseResource();
 		}
+		if (TriangleIndexBuffer16.IsInitialized())
+		{
+			TriangleIndexBuffer16.ReleaseResource();
+		}
 	}
 }
 
@@ -87,12 +91,87 @@ void FHoudiniStaticMeshRenderBufferSet::CopyBuffers()
 	LocalVertexFactory.SetData(Data);
 	InitOrUpdateResource(&LocalVertexFactory);
 
-	if (TriangleIndexBuffer.Indices.Num() > 0)
+	if (bUse16BitIndices)
+	{
+		if (TriangleIndexBuffer16.Indices.Num() > 0)
+		{
+			TriangleIndexBuffer16.InitResource();
+		}
+	}
+	else if (TriangleIndexBuffer.Indices.Num() > 0)
 	{
 		TriangleIndexBuffer.InitResource();
 	}
 }
 
+// Copy InData to the CPU side data of a vertex buffer and to its RHI buffer
+static void
+UpdateVertexBufferData(FVertexBuffer& InVertexBuffer, void* InCPUData, const void* InData, uint32 InSize)
+{
+	if (InSize == 0)
+		return;
+
+	FMemory::Memcpy(InCPUData, InData, InSize);
+
+	if (!InVertexBuffer.VertexBufferRHI.IsValid())
+		return;
+
+	void* DestData = RHILockVertexBuffer(InVertexBuffer.VertexBufferRHI, 0, InSize, RLM_WriteOnly);
+	FMemory::Memcpy(DestData, InData, InSize);
+	RHIUnlockVertexBuffer(InVertexBuffer.VertexBufferRHI);
+}
+
+void FHoudiniStaticMeshRenderBufferSet::UpdateVertexStreams(FPositionVertexBuffer* InPositions, FStaticMeshVertexBuffer* InAttributes, FColorVertexBuffer* InColors)
+{
+	check(IsInRenderingThread());
+
+	if (NumTriangles == 0)
+	{
+		return;
+	}
+
+	if (InPositions)
+	{
+		check(InPositions->GetNumVertices() == PositionVertexBuffer.GetNumVertices());
+		UpdateVertexBufferData(
+			PositionVertexBuffer, PositionVertexBuffer.GetVertexData(), InPositions->GetVertexData(),
+			PositionVertexBuffer.GetNumVertices() * PositionVertexBuffer.GetStride());
+	}
+
+	if (InAttributes)
+	{
+		check(InAttributes->GetNumVertices() == StaticMeshVertexBuffer.GetNumVertices());
+		check(InAttributes->GetNumTexCoords() == StaticMeshVertexBuffer.GetNumTexCoords());
+		UpdateVertexBufferData(
+			StaticMeshVertexBuffer.TangentsVertexBuffer, StaticMeshVertexBuffer.GetTangentData(), InAttributes->GetTangentData(),
+			StaticMeshVertexBuffer.GetTangentSize());
+		UpdateVertexBufferData(
+			StaticMeshVertexBuffer.TexCoordVertexBuffer, StaticMeshVertexBuffer.GetTexCoordData(), InAttributes->GetTexCoordData(),
+			StaticMeshVertexBuffer.GetTexCoordSize());
+	}
+
+	if (InColors)
+	{
+		check(InColors->GetNumVertices() == ColorVertexBuffer.GetNumVertices());
+		UpdateVertexBufferData(
+			ColorVertexBuffer, ColorVertexBuffer.GetVertexData(), InColors->GetVertexData(),
+			ColorVertexBuffer.GetNumVertices() * ColorVertexBuffer.GetStride());
+	}
+}
+
+const FIndexBuffer& FHoudiniStaticMeshRenderBufferSet::GetIndexBuffer() const
+{
+	if (bUse16BitIndices)
+		return TriangleIndexBuffer16;
+
+	return TriangleIndexBuffer;
+}
+
+int32 FHoudiniStaticMeshRenderBufferSet::GetNumIndices() const
+{
+	return bUse16BitIndices ? TriangleIndexBuffer16.Indices.Num() : TriangleIndexBuffer.Indices.Num();
+}
+
 void FHoudiniStaticMeshRenderBufferSet::InitOrUpdateResource(FRenderResource* Resource)
 {
 	check(IsInRenderingThread());
@@ -131,6 +210,10 @@ FHoudiniStaticMeshSceneProxy::FHoudiniStaticMeshSceneProxy(UHoudiniStaticMeshCom
 	, FeatureLevel(InFeatureLevel)
 	, Component(InComponent)
 	, MaterialRelevance(InComponent ? InComponent->GetMaterialRelevance(InFeatureLevel) : FMaterialRelevance())
+	, BuiltMesh(nullptr)
+	, BuiltTopologyHash(0)
+	, BuiltPositionsHash(0)
+	, BuiltAttributesHash(0)
 {
 }
 
@@ -210,6 +293,11 @@ void FHoudiniStaticMeshSceneProxy::Build()
 		UHoudiniStaticMesh *Mesh = Component->GetMesh();
 		if (Mesh)
 		{
+			BuiltMesh = Mesh;
+			BuiltTopologyHash = Mesh->GetTopologyHash();
+			BuiltPositionsHash = Mesh->GetPositionsHash();
+			BuiltAttributesHash = Mesh->GetAttributesHash();
+
 			if (NumMaterials > 1 && Mesh->HasPerFaceMaterials())
 			{
 				BuildBufferSetsByMaterial();
@@ -222,6 +310,77 @@ void FHoudiniStaticMeshSceneProxy::Build()
 	}
 }
 
+bool FHoudiniStaticMeshSceneProxy::UpdateVertexStreams(const UHoudiniStaticMesh* InMesh)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniStaticMeshSceneProxy::UpdateVertexStreams"));
+
+	check(IsInGameThread());
+
+	// Unknown hashes (0) mean that we cannot tell what changed
+	if (!InMesh || InMesh != BuiltMesh || BuiltTopologyHash == 0 || InMesh->GetTopologyHash() != BuiltTopologyHash)
+		return false;
+
+	// The buffer sets are built per material, the materials must be the same
+	const uint32 NumMaterials = GetNumMaterials();
+	if (NumMaterials == 0)
+	{
+		if (BufferSets.Num() != 1 || BufferSets[0]->Material != UMaterial::GetDefaultMaterial(MD_Surface))
+			return false;
+	}
+	else
+	{
+		if ((uint32)BufferSets.Num() != NumMaterials)
+			return false;
+
+		for (uint32 MaterialIdx = 0; MaterialIdx < NumMaterials; ++MaterialIdx)
+		{
+			if (BufferSets[MaterialIdx]->Material != GetMaterial(MaterialIdx))
+				return false;
+		}
+	}
+
+	const bool bPositionsChanged = InMesh->GetPositionsHash() != BuiltPositionsHash;
+	const bool bAttributesChanged = InMesh->GetAttributesHash() != BuiltAttributesHash;
+	if (!bPositionsChanged && !bAttributesChanged)
+		return true;
+
+	// Staging buffers, filled here and copied to the existing buffers on the render thread
+	struct FVertexStreams
+	{
+		FPositionVertexBuffer Positions;
+		FStaticMeshVertexBuffer Attributes;
+		FColorVertexBuffer Colors;
+	};
+
+	for (FHoudiniStaticMeshRenderBufferSet* Buffers : BufferSets)
+	{
+		if (!Buffers || Buffers->NumTriangles == 0)
+			continue;
+
+		FVertexStreams* Streams = new FVertexStreams();
+		PopulateVertexStreams(
+			InMesh, Buffers->VertexInstances,
+			bPositionsChanged ? &Streams->Positions : nullptr,
+			bAttributesChanged ? &Streams->Attributes : nullptr,
+			bAttributesChanged ? &Streams->Colors : nullptr);
+
+		ENQUEUE_RENDER_COMMAND(FHoudiniStaticMeshSceneProxy_UpdateVertexStreams)(
+			[Buffers, Streams, bPositionsChanged, bAttributesChanged](FRHICommandListImmediate& RHICmdList)
+		{
+			Buffers->UpdateVertexStreams(
+				bPositionsChanged ? &Streams->Positions : nullptr,
+				bAttributesChanged ? &Streams->Attributes : nullptr,
+				bAttributesChanged ? &Streams->Colors : nullptr);
+			delete Streams;
+		});
+	}
+
+	BuiltPositionsHash = InMesh->GetPositionsHash();
+	BuiltAttributesHash = InMesh->GetAttributesHash();
+
+	return true;
+}
+
 void FHoudiniStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const
 {
 	const bool bRenderAsWireframe = (AllowDebugViewmodes() && ViewFamily.EngineShowFlags.Wireframe);
@@ -270,7 +429,7 @@ void FHoudiniStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<const FSc
 			DynamicPrimitiveUniformBuffer.Set(
 				GetLocalToWorld(), PreviousLocalToWorld, GetBounds(), GetLocalBounds(), true, bHasPrecomputedVolumetricLightmap, DrawsVelocity(), bOutputVelocity);
 
-			if (BufferSet->TriangleIndexBuffer.Indices.Num() > 0)
+			if (BufferSet->GetNumIndices() > 0)
 			{
 				FMeshBatch& Mesh = Collector.AllocateMesh();
 				if (PopulateMeshElement(Mesh, *BufferSet, MaterialProxy, false, DepthPriority, ViewIdx, DynamicPrimitiveUniformBuffer))
@@ -300,7 +459,7 @@ bool FHoudiniStaticMeshSceneProxy::PopulateMeshElement(
 	FDynamicPrimitiveUniformBuffer& DynamicPrimitiveUniformBuffer) const
 {
 	FMeshBatchElement& BatchElement = InMeshBatch.Elements[0];
-	BatchElement.IndexBuffer = &Buffers.TriangleIndexBuffer;
+	BatchElement.IndexBuffer = &Buffers.GetIndexBuffer();
 	InMeshBatch.bWireframe = bRenderAsWireframe;
 	InMeshBatch.VertexFactory = &Buffers.LocalVertexFactory;
 	InMeshBatch.MaterialRenderProxy = Material;
@@ -351,78 +510,122 @@ void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InM
 
 	const uint32 NumTriangles = InTriangleIDs ? InNumTrianglesInGroup : InMesh->GetNumTriangles();
 	InBuffers->NumTriangles = NumTriangles;
+	InBuffers->VertexInstances.Reset();
 
 	if (NumTriangles == 0)
 		return;
 
-	const uint32 NumVertices = NumTriangles * 3;
+	// Find the vertices of the buffers and the index of the vertex used by each triangle corner
+	const uint32 NumIndices = NumTriangles * 3;
+	TArray<uint32> Indices;
+	Indices.SetNumUninitialized(NumIndices);
+	if (InMesh->IsCompacted())
+	{
+		// Vertex instances that use the same compact vertex have identical data and can share a vertex
+		const TArray<uint32>& CompactVertexInstanceIndices = InMesh->GetCompactVertexInstanceIndices();
+		TArray<uint32> VertexByCompactVertex;
+		VertexByCompactVertex.Init(MAX_uint32, InMesh->GetNumCompactVertices());
+		InBuffers->VertexInstances.Reserve(NumIndices);
+		for (uint32 TriangleIDIdx = 0; TriangleIDIdx < NumTriangles; ++TriangleIDIdx)
+		{
+			const uint32 TriangleID = InTriangleIDs ? (*InTriangleIDs)[InTriangleGroupStartIdx + TriangleIDIdx] : TriangleIDIdx;
+			for (uint8 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
+			{
+				const uint32 MeshVtxInstanceIdx = TriangleID * 3 + TriVertIdx;
+				uint32& VertIdx = VertexByCompactVertex[CompactVertexInstanceIndices[MeshVtxInstanceIdx]];
+				if (VertIdx == MAX_uint32)
+					VertIdx = InBuffers->VertexInstances.Add(MeshVtxInstanceIdx);
+				Indices[TriangleIDIdx * 3 + TriVertIdx] = VertIdx;
+			}
+		}
+		InBuffers->VertexInstances.Shrink();
+	}
+	else
+	{
+		// Each triangle corner has its own vertex
+		InBuffers->VertexInstances.SetNumUninitialized(NumIndices);
+		ParallelFor(NumTriangles, [&](uint32 TriangleIDIdx)
+		{
+			const uint32 TriangleID = InTriangleIDs ? (*InTriangleIDs)[InTriangleGroupStartIdx + TriangleIDIdx] : TriangleIDIdx;
+			for (uint8 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
+			{
+				const uint32 VertIdx = TriangleIDIdx * 3 + TriVertIdx;
+				InBuffers->VertexInstances[VertIdx] = TriangleID * 3 + TriVertIdx;
+				Indices[VertIdx] = VertIdx;
+			}
+		});
+	}
+
+	// Use 16 bit indices when possible, this halves the size of the index buffer
+	const uint32 NumVertices = InBuffers->VertexInstances.Num();
+	InBuffers->bUse16BitIndices = NumVertices <= (uint32)MAX_uint16 + 1;
+	if (InBuffers->bUse16BitIndices)
+	{
+		InBuffers->TriangleIndexBuffer16.Indices.SetNumUninitialized(NumIndices);
+		uint16* Indices16 = InBuffers->TriangleIndexBuffer16.Indices.GetData();
+		for (uint32 Idx = 0; Idx < NumIndices; ++Idx)
+			Indices16[Idx] = (uint16)Indices[Idx];
+	}
+	else
+	{
+		InBuffers->TriangleIndexBuffer.Indices = MoveTemp(Indices);
+	}
+
+	PopulateVertexStreams(InMesh, InBuffers->VertexInstances, &InBuffers->PositionVertexBuffer, &InBuffers->StaticMeshVertexBuffer, &InBuffers->ColorVertexBuffer);
+}
+
+void FHoudiniStaticMeshSceneProxy::PopulateVertexStreams(const UHoudiniStaticMesh *InMesh, const TArray<uint32>& InVertexInstances, FPositionVertexBuffer* OutPositions, FStaticMeshVertexBuffer* OutAttributes, FColorVertexBuffer* OutColors) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniStaticMeshSceneProxy::PopulateVertexStreams"));
+
+	check(InMesh);
+
+	const uint32 NumVertices = InVertexInstances.Num();
 	const uint32 NumUVLayers = InMesh->GetNumUVLayers();
 
-	InBuffers->PositionVertexBuffer.Init(NumVertices);
+	if (OutPositions)
+		OutPositions->Init(NumVertices);
 	// There must be at least one UV layer
 	// TODO: Would it be possible to have no UV layers and bind to a dummy 0/black SRV?
-	InBuffers->StaticMeshVertexBuffer.Init(NumVertices, NumUVLayers > 0 ? NumUVLayers : 1);
-	InBuffers->ColorVertexBuffer.Init(NumVertices);
-	InBuffers->TriangleIndexBuffer.Indices.AddUninitialized(NumTriangles * 3);
+	if (OutAttributes)
+		OutAttributes->Init(NumVertices, NumUVLayers > 0 ? NumUVLayers : 1);
+	if (OutColors)
+		OutColors->Init(NumVertices);
 
 	const TArray<FVector>& VertexPositions = InMesh->GetVertexPositions();
 	const TArray<FIntVector>& TriangleIndices = InMesh->GetTriangleIndices();
-	const TArray<FColor>& VertexInstanceColors = InMesh->GetVertexInstanceColors();
-	const TArray<FVector>& VertexInstanceNormals = InMesh->GetVertexInstanceNormals();
-	const TArray<FVector>& VertexInstanceUTangents = InMesh->GetVertexInstanceUTangents();
-	const TArray<FVector>& VertexInstanceVTangents = InMesh->GetVertexInstanceVTangents();
-	const TArray<FVector2D>& VertexInstanceUVs = InMesh->GetVertexInstanceUVs();
-
-	const bool bHasColors = InMesh->HasColors();
-	const bool bHasNormals = InMesh->HasNormals();
-	const bool bHasTangents = InMesh->HasTangents();
-
-	FThreadSafeCounter VertCounter(0);
-	//for (uint32 TriangleIDIdx = 0; TriangleIDIdx < NumTriangles; ++TriangleIDIdx)
-	ParallelFor(NumTriangles, [&](uint32 TriangleIDIdx)
-	{
-		const uint32 TriangleID = InTriangleIDs ? (*InTriangleIDs)[InTriangleGroupStartIdx + TriangleIDIdx] : TriangleIDIdx;
-		const FIntVector &TriIndices = TriangleIndices[TriangleID];
 
-		FVector TangentU;
-		FVector TangentV;
-		uint32 VertIdx = VertCounter.Add(3);
-		for (uint8 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
-		{
-			const uint32 MeshVtxIdx = TriIndices[TriVertIdx];
-			const uint32 MeshVtxInstanceIdx = TriangleID * 3 + TriVertIdx;
+	// The vertex instance data is read via the mesh's accessors, which support both the full precision and compact layouts
+	ParallelFor(NumVertices, [&](uint32 VertIdx)
+	{
+		const uint32 MeshVtxInstanceIdx = InVertexInstances[VertIdx];
 
-			InBuffers->PositionVertexBuffer.VertexPosition(VertIdx) = VertexPositions[TriIndices[TriVertIdx]];
+		if (OutPositions)
+			OutPositions->VertexPosition(VertIdx) = VertexPositions[TriangleIndices[MeshVtxInstanceIdx / 3][MeshVtxInstanceIdx % 3]];
 
-			FVector Normal = bHasNormals ? VertexInstanceNormals[MeshVtxInstanceIdx] : FVector(0, 0, 1);
-			if (bHasTangents)
-			{
-				TangentU = VertexInstanceUTangents[MeshVtxInstanceIdx];
-				TangentV = VertexInstanceVTangents[MeshVtxInstanceIdx];
-			}
-			else
-			{
-				Normal.FindBestAxisVectors(TangentU, TangentV);
-			}
-			InBuffers->StaticMeshVertexBuffer.SetVertexTangents(VertIdx, TangentU, TangentV, Normal);
+		if (OutAttributes)
+		{
+			FVector TangentU;
+			FVector TangentV;
+			FVector Normal;
+			InMesh->GetVertexInstanceTangents(MeshVtxInstanceIdx, TangentU, TangentV, Normal);
+			OutAttributes->SetVertexTangents(VertIdx, TangentU, TangentV, Normal);
 
 			if (NumUVLayers > 0)
 			{
 				for (uint8 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
 				{
-					InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVLayerIdx, VertexInstanceUVs[MeshVtxInstanceIdx]);
+					OutAttributes->SetVertexUV(VertIdx, UVLayerIdx, InMesh->GetVertexInstanceUV(MeshVtxInstanceIdx, UVLayerIdx));
 				}
 			}
 			else
 			{
-				InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, 0, FVector2D::ZeroVector);
+				OutAttributes->SetVertexUV(VertIdx, 0, FVector2D::ZeroVector);
 			}
-
-			InBuffers->ColorVertexBuffer.VertexColor(VertIdx) = bHasColors ? VertexInstanceColors[MeshVtxInstanceIdx] : DefaultVertexColor;
-
-			InBuffers->TriangleIndexBuffer.Indices[VertIdx] = VertIdx;
-			VertIdx++;
 		}
+
+		if (OutColors)
+			OutColors->VertexColor(VertIdx) = InMesh->GetVertexInstanceColor(MeshVtxInstanceIdx, DefaultVertexColor);
 	});
 }
 
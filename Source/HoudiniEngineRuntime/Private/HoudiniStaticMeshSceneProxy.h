@@ -58,6 +58,15 @@ public:
 	/** The triangle indices buffer. */
 	FDynamicMeshIndexBuffer32 TriangleIndexBuffer;
 
+	/** The triangle indices buffer used when the vertex count fits in 16 bits. */
+	FDynamicMeshIndexBuffer16 TriangleIndexBuffer16;
+
+	/** True if TriangleIndexBuffer16 is used instead of TriangleIndexBuffer. */
+	bool bUse16BitIndices = false;
+
+	/** The mesh vertex instance that each vertex of the buffers was built from. */
+	TArray<uint32> VertexInstances;
+
 	/** The color buffer */
 	FColorVertexBuffer ColorVertexBuffer;
 
@@ -84,6 +93,18 @@ public:
 	 */
 	void InitOrUpdateResource(FRenderResource* Resource);
 
+	/**
+	 * Copy new vertex data to the existing buffers, the buffers that are null are left untouched.
+	 * The new buffers must have the same number of vertices (and UV layers) as the current ones.
+	 * @warning Render thread only.
+	 */
+	void UpdateVertexStreams(FPositionVertexBuffer* InPositions, FStaticMeshVertexBuffer* InAttributes, FColorVertexBuffer* InColors);
+
+	// The index buffer in use
+	const FIndexBuffer& GetIndexBuffer() const;
+
+	int32 GetNumIndices() const;
+
 protected:
 	friend class FHoudiniStaticMeshSceneProxy;
 
@@ -108,6 +129,11 @@ public:
 	// Build buffer sets to render the mesh.
 	virtual void Build();
 
+	// Update the vertex buffers with the mesh's new positions and/or attributes, without rebuilding the proxy.
+	// Returns false if the mesh's topology or materials have changed: the proxy must be recreated in that case.
+	// @warning Game thread only.
+	bool UpdateVertexStreams(const UHoudiniStaticMesh* InMesh);
+
 	// FPrimitiveSceneProxy
 	virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const override;
 
@@ -133,6 +159,9 @@ public:
 protected:
 	void PopulateBuffers(const UHoudiniStaticMesh *InMesh, FHoudiniStaticMeshRenderBufferSet *InBuffers, const TArray<uint32>* InTriangleIDs=nullptr, uint32 InTriangleGroupStartIdx=0u, uint32 InNumTrianglesInGroup=0u);
 
+	// Fill the vertex buffers that are not null from the mesh's vertex instances
+	void PopulateVertexStreams(const UHoudiniStaticMesh *InMesh, const TArray<uint32>& InVertexInstances, FPositionVertexBuffer* OutPositions, FStaticMeshVertexBuffer* OutAttributes, FColorVertexBuffer* OutColors) const;
+
 	// Virtual function for creating a new buffer set instances.
 	// Subclasses can overwrite this is they use a different buffer set with 
 	// different instantiation requirements.
@@ -165,4 +194,10 @@ protected:
 
 	FMaterialRelevance MaterialRelevance;
 
+	// The mesh and mesh hashes the buffer sets were built from
+	const UHoudiniStaticMesh* BuiltMesh;
+	uint32 BuiltTopologyHash;
+	uint32 BuiltPositionsHash;
+	uint32 BuiltAttributesHash;
+
 };
\ No newline at end of file